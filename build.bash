@@ -8,19 +8,35 @@ INSTALL_DIR="$HOME/.local/share/applications"
 BUILD_DIR="build"
 
 # 1. Compilează Raylib (dacă nu e deja construit)
+# Alocările Raylib trec prin contorul din src/arena.c (vezi profilerul F3)
+RAYLIB_CFLAGS="-DRL_MALLOC=CountedMalloc -DRL_CALLOC=CountedCalloc -DRL_REALLOC=CountedRealloc -DRL_FREE=CountedFree"
 echo "Compilare Raylib..."
 cd raylib/src
-make PLATFORM=PLATFORM_DESKTOP  # Linux (X11) implicit
+# Recompilează de la zero dacă s-au schimbat flag-urile
+if [ "$(cat .dino_cflags 2>/dev/null)" != "$RAYLIB_CFLAGS" ]; then
+    make clean
+    echo "$RAYLIB_CFLAGS" > .dino_cflags
+fi
+make PLATFORM=PLATFORM_DESKTOP CUSTOM_CFLAGS="$RAYLIB_CFLAGS"  # Linux (X11) implicit
 cd ../..
 
 # 2. Compilează jocul (link-uit la biblioteca Raylib)
 echo "Compilare joc..."
 mkdir -p $BUILD_DIR
 
-SRC_FILES="main.c src/game.c src/window.c src/menu.c src/draw.c src/utils.c src/sound.c"
+CORE_FILES="src/game.c src/window.c src/menu.c src/draw.c src/utils.c src/sound.c src/rng.c src/replay.c src/env.c src/autopilot.c src/collision.c src/scheduler.c src/particles.c src/boss.c src/render.c src/simthread.c src/input.c src/livestate.c src/telemetry.c src/leaderboard.c src/animation.c src/tween.c src/lighting.c src/softraster.c src/video.c src/ui.c src/arena.c src/netplay.c src/spectator.c src/broadcast.c src/tuning.c"
+SRC_FILES="main.c $CORE_FILES"
 INCLUDE_DIRS="-I. -I./src -I./raylib/src"
 LIBS="./raylib/src/libraylib.a -lm -lpthread -ldl -lrt -lX11"
 
+# Împachetează sprite-urile în atlas și regenerează src/atlas.h și src/atlas_mask.h
+cc tools/atlas_packer.c src/arena.c $INCLUDE_DIRS $LIBS -o $BUILD_DIR/AtlasPacker && ./$BUILD_DIR/AtlasPacker
+
+if [ $? -ne 0 ]; then
+    echo "Eroare la generarea atlasului!"
+    exit 1
+fi
+
 # Compilează toate fișierele sursă
 cc $SRC_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/$EXECUTABLE
 
@@ -30,6 +46,28 @@ if [ $? -ne 0 ]; then
     exit 1
 fi
 
+# Compilează utilitarele din linia de comandă
+echo "Compilare utilitare..."
+cc tools/replay_verifier.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/ReplayVerifier && \
+cc tools/env_benchmark.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/EnvBenchmark && \
+cc tools/autopilot_soak.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/AutopilotSoak && \
+cc tools/particle_benchmark.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/ParticleBenchmark && \
+cc tools/boss_benchmark.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/BossBenchmark && \
+cc tools/telemetry_summary.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/TelemetrySummary && \
+cc tools/render_capture.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/RenderCapture && \
+cc tools/replay_video.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/ReplayVideo && \
+cc tools/netplay_soak.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/NetplaySoak && \
+cc tools/broadcast_benchmark.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/BroadcastBenchmark && \
+cc tools/difficulty_tuner.c $CORE_FILES $INCLUDE_DIRS $LIBS -o $BUILD_DIR/DifficultyTuner && \
+cc tools/spectator.c src/spectator.c $INCLUDE_DIRS $LIBS -o $BUILD_DIR/Spectator && \
+cc tools/live_monitor.c src/livestate.c -I. -lrt -o $BUILD_DIR/LiveMonitor && \
+cc tools/leaderboard_server.c -o $BUILD_DIR/LeaderboardServer
+
+if [ $? -ne 0 ]; then
+    echo "Eroare la compilarea utilitarelor!"
+    exit 1
+fi
+
 # 3. Creează fișier .desktop
 echo "Creare $DESKTOP_FILE..."
 cat > $BUILD_DIR/$DESKTOP_FILE <<EOL
@@ -6,24 +6,77 @@
 #include "src/draw.h"
 #include "src/utils.h"
 #include "src/sound.h"
+#include "src/replay.h"
+#include "src/scheduler.h"
+#include "src/particles.h"
+#include "src/simthread.h"
+#include "src/input.h"
+#include "src/telemetry.h"
+#include "src/render.h"
+#include "src/arena.h"
+#include "src/netplay.h"
+#include "src/tuning.h"
 
 #include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
 
 int main(void) {
     InitWindow(BASE_RESOLUTION.x, BASE_RESOLUTION.y, "DinoGame");
     SetTargetFPS(60);
+    // DINO_RENDERER=software draws on the CPU and only presents through the GPU
+    const char* renderer = getenv("DINO_RENDERER");
+    bool software = renderer && strcmp(renderer, "software") == 0;
+    InitRenderBackend(software ? RENDER_BACKEND_SOFTWARE : RENDER_BACKEND_GPU, BASE_RESOLUTION.x, BASE_RESOLUTION.y);
+
+    // Difficulty from TUNING_FILE when there is one (see tools/difficulty_tuner.c)
+    TuningParams tuning;
+    LoadTuning(TUNING_FILE, &tuning);
+    SetTuning(&tuning);
 
     WindowState window = {0};
     GameState game = {0};
+    ObstacleScheduler scheduler = {0};
+    game.scheduler = &scheduler;
+    game.particles = CreateParticleSystem();
     
     InitWindowState(&window);
     InitGameState(&game);
-    RescaleGame(&game, &window);
+    RescaleGame(&window);
+    if (game.particles) LoadParticleTextures(game.particles);
+    game.telemetry = StartTelemetry(TELEMETRY_FILE);
+    InputQueue inputQueue = {0};
+    game.input = &inputQueue;
+    SimThread sim = {0};
+    sim.live = OpenLiveStateWriter(LIVE_STATE_NAME);
+    sim.leaderboard = StartLeaderboard(getenv("DINO_LEADERBOARD"));
+    // DINO_BROADCAST=port streams the game to spectator clients
+    sim.broadcast = StartBroadcast(getenv("DINO_BROADCAST"));
+    // DINO_VERSUS=listen[:port] hosts a versus match, DINO_VERSUS=host[:port]
+    // joins one; DINO_NETSIM=latency,jitter,loss% degrades what we send
+    game.netplay = StartNetplay(getenv("DINO_VERSUS"), getenv("DINO_NETSIM"));
+    StartSimThread(&sim, &game);
+    // DINO_ALLOC_CHECK=1 asserts (debug builds) when a frame hits the heap
+    SetStrictAllocations(getenv("DINO_ALLOC_CHECK") != NULL);
 
+    // This thread owns the window, input and GPU; gameplay ticks on the sim
+    // thread and is drawn from the newest published snapshot. From here on
+    // `game` belongs to the sim: this thread reads frames and posts commands.
     while (!WindowShouldClose()) {
+        BeginMemoryFrame();
         float deltaTime = GetFrameTime();
+        const GameState* view = AcquireSimFrame(&sim);
         
-        HandleInput(&window, &game);
+        // In a versus match this machine only ever drives its own dino
+        bool versus = IsSimVersus(&sim);
+        SampleInput(&inputQueue, versus ? ReadPlayerInput() : ReadPlayerInputs(view->playerCount));
+        HandleInput(&window, view, &sim);
+        if (TakeSimMatchStart(&sim)) window.gameState = GAME_STATE_PLAYING;
+        if (window.gameState == GAME_STATE_PLAYING && view->gameWon) window.gameState = GAME_STATE_GAME_OVER;
+        SetSimStepping(&sim, window.gameState == GAME_STATE_PLAYING);
+        SyncSimFrame(&sim);
+        RunSimFrame(&sim, deltaTime);
+        DrainSimEffects(&sim, game.particles);
         
         switch (window.gameState) {
             case GAME_STATE_MENU:
@@ -35,56 +88,30 @@ int main(void) {
                 break;
                 
             case GAME_STATE_PLAYING:
-                if (!game.gameOver && !game.pauseMenu.isPaused) {
-                    UpdatePhysics(&game, &window, deltaTime);
-                    UpdateScore(&game, deltaTime);
-                    UpdateObstacles(&game, &window, deltaTime);
-                    UpdateBossFight(&game, &window, deltaTime);
-                    UpdateClouds(&game, &window, deltaTime);
-                    if (game.gameWon) {
-                        window.gameState = GAME_STATE_GAME_OVER;
-                        PlayWinSound(&game);
-                    }
-                    if (game.gameOver && !game.gameWon) {
-                        PlayGameOverSound(&game);
-                    }
-                    if (!game.isNight) {
-                        game.dayCycleTimer += deltaTime;
-                        if (game.score >= 200 && game.dayCycleTimer >= DAY_DURATION) {
-                            game.nightModeActive = true;
-                            game.nightCycleTimer = 0.0f;
-                            game.nightAlpha = 0.0f;
-                            game.isNight = true;
-                        }
-                    }
-                    if (game.nightModeActive) {
-                        game.nightCycleTimer += deltaTime;
-                        if (game.nightCycleTimer < FADE_DURATION) {
-                            game.nightAlpha = game.nightCycleTimer / FADE_DURATION;
-                        } else if (game.nightCycleTimer < (FADE_DURATION + NIGHT_DURATION)) {
-                            game.nightAlpha = 1.0f;
-                        } else if (game.nightCycleTimer < (FADE_DURATION + NIGHT_DURATION + FADE_DURATION)) {
-                            game.nightAlpha = 1.0f - (game.nightCycleTimer - FADE_DURATION - NIGHT_DURATION) / FADE_DURATION;
-                        } else {
-                            game.nightModeActive = false;
-                            game.nightCycleTimer = 0.0f;
-                            game.nightAlpha = 0.0f;
-                            game.isNight = false;
-                            game.dayCycleTimer = 0.0f;
-                        }
-                    }
+            case GAME_STATE_GAME_OVER: {
+                const GameState* frame = AcquireSimFrame(&sim);
+                if (window.gameState == GAME_STATE_PLAYING && !frame->gameOver && !frame->pauseMenu.isPaused) {
+                    if (game.particles) UpdateParticles(game.particles, deltaTime);
                 }
-                UpdateAnimation(&game, &window, deltaTime);
-                DrawGame(&window, &game);
-                break;
-                
-            case GAME_STATE_GAME_OVER:
-                DrawGame(&window, &game);
+                DrawGame(&window, frame);
+                RecordPresent(&inputQueue, frame->inputTime);
                 break;
+            }
         }
+        EndMemoryFrame();
     }
 
+    StopSimThread(&sim);
+    StopNetplay(game.netplay);
+    CloseLiveState(sim.live);
+    StopLeaderboard(sim.leaderboard);
+    StopBroadcast(sim.broadcast);
+    StopTelemetry(game.telemetry);
+    StopObstacleScheduler(&scheduler);
+    DestroyParticleSystem(game.particles);
+    FreeReplayRecorder(&game.replay);
     UnloadSounds(&game);
+    CloseRenderBackend();
     CloseWindow();
     return 0;
 }
@@ -0,0 +1,62 @@
+#include "animation.h"
+
+// Every animated sprite in the game. Adding an animated entity means a clip
+// here and an animator slot, not another hand-rolled frame timer.
+static const AnimClip ANIM_CLIPS[ANIM_CLIP_COUNT] = {
+    [ANIM_CLIP_RUN] = { { { SPRITE_RUN_1, FRAME_DELAY }, { SPRITE_RUN_2, FRAME_DELAY } }, 2, ANIM_LOOP },
+    [ANIM_CLIP_CROUCH] = { { { SPRITE_CROUCH_1, FRAME_DELAY }, { SPRITE_CROUCH_2, FRAME_DELAY } }, 2, ANIM_LOOP },
+    [ANIM_CLIP_CACTUS_1] = { { { SPRITE_CACTUS_1, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_CACTUS_2] = { { { SPRITE_CACTUS_2, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_CACTUS_3] = { { { SPRITE_CACTUS_3, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_CACTUS_4] = { { { SPRITE_CACTUS_4, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_CACTUS_5] = { { { SPRITE_CACTUS_5, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_CACTUS_6] = { { { SPRITE_CACTUS_6, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_BIRD] = { { { SPRITE_BIRD_1, BIRD_ANIM_DELAY }, { SPRITE_BIRD_2, BIRD_ANIM_DELAY } }, 2, ANIM_LOOP },
+    [ANIM_CLIP_METEOR_FALL] = { { { SPRITE_METEOR_FALL_1, 0.0f } }, 1, ANIM_ONCE },
+    [ANIM_CLIP_METEOR_IMPACT] = { {
+        { SPRITE_METEOR_IMPACT_1, METEOR_ANIM_DELAY * 1.5f },
+        { SPRITE_METEOR_IMPACT_2, METEOR_ANIM_DELAY * 1.5f },
+        { SPRITE_METEOR_IMPACT_3, METEOR_ANIM_DELAY * 1.5f }
+    }, METEOR_IMPACT_FRAMES, ANIM_ONCE }
+};
+
+// `elapsed` is time already played, for animators started after this
+// tick's UpdateAnimators() pass.
+void PlayAnimation(Animator* animator, AnimClipId clip, float elapsed) {
+    *animator = (Animator){ .clip = clip, .frame = 0, .active = true, .stepped = false, .time = elapsed };
+}
+
+// Swaps to a clip with the same timing without restarting it, e.g. the dino
+// ducking mid-jump keeps its stride.
+void SwitchAnimation(Animator* animator, AnimClipId clip) {
+    animator->clip = clip;
+    if (animator->frame >= ANIM_CLIPS[clip].frameCount) animator->frame = ANIM_CLIPS[clip].frameCount - 1;
+}
+
+void StopAnimation(Animator* animator) {
+    animator->active = false;
+    animator->stepped = false;
+}
+
+void UpdateAnimators(Animator* animators, int count, float deltaTime) {
+    for (int i = 0; i < count; i++) {
+        Animator* animator = &animators[i];
+        animator->stepped = false;
+        if (!animator->active) continue;
+        const AnimClip* clip = &ANIM_CLIPS[animator->clip];
+        float duration = clip->frames[animator->frame].duration;
+        animator->time += deltaTime;
+        if (duration <= 0.0f || animator->time < duration) continue;
+        animator->time = 0.0f;
+        animator->stepped = true;
+        if (animator->frame + 1 < clip->frameCount) {
+            animator->frame++;
+        } else if (clip->mode == ANIM_LOOP) {
+            animator->frame = 0;
+        }
+    }
+}
+
+SpriteId GetAnimatorSprite(const Animator* animator) {
+    return ANIM_CLIPS[animator->clip].frames[animator->frame].sprite;
+}
@@ -0,0 +1,11 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+#include "types.h"
+
+void PlayAnimation(Animator* animator, AnimClipId clip, float elapsed);
+void SwitchAnimation(Animator* animator, AnimClipId clip);
+void StopAnimation(Animator* animator);
+void UpdateAnimators(Animator* animators, int count, float deltaTime);
+SpriteId GetAnimatorSprite(const Animator* animator);
+
+#endif
@@ -0,0 +1,97 @@
+#include "arena.h"
+#include <assert.h>
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// build.bash compiles raylib with RL_MALLOC, RL_CALLOC, RL_REALLOC and
+// RL_FREE pointing at the calls below, and the render path's own buffers
+// use them too, so every heap allocation a frame can cause is counted.
+static atomic_long allocations;
+static atomic_size_t allocatedBytes;
+
+static void CountAllocation(size_t size) {
+    atomic_fetch_add_explicit(&allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&allocatedBytes, size, memory_order_relaxed);
+}
+
+void* CountedMalloc(size_t size) {
+    CountAllocation(size);
+    return malloc(size);
+}
+
+void* CountedCalloc(size_t count, size_t size) {
+    CountAllocation(count * size);
+    return calloc(count, size);
+}
+
+void* CountedRealloc(void* pointer, size_t size) {
+    if (size > 0) CountAllocation(size);
+    return realloc(pointer, size);
+}
+
+void CountedFree(void* pointer) {
+    free(pointer);
+}
+
+// Frame arena: main thread only. Whatever is allocated from it lives until
+// the next BeginMemoryFrame().
+static alignas(16) unsigned char arena[FRAME_ARENA_BYTES];
+static size_t arenaUsed;
+static long frameStartAllocations;
+static size_t frameStartBytes;
+static bool allocationsExpected;
+static bool strictAllocations;
+static MemoryStats stats;
+
+// NULL once the arena is full; the caller drops what it was building
+void* FrameAlloc(size_t size) {
+    size_t start = (arenaUsed + 15) & ~(size_t)15;
+    if (start > FRAME_ARENA_BYTES || size > FRAME_ARENA_BYTES - start) return NULL;
+    arenaUsed = start + size;
+    return arena + start;
+}
+
+const char* FrameCopyText(const char* text) {
+    size_t length = strlen(text) + 1;
+    char* copy = FrameAlloc(length);
+    if (copy) memcpy(copy, text, length);
+    return copy;
+}
+
+// Top of every frame: empties the arena and starts counting allocations
+void BeginMemoryFrame(void) {
+    arenaUsed = 0;
+    allocationsExpected = false;
+    frameStartAllocations = atomic_load_explicit(&allocations, memory_order_relaxed);
+    frameStartBytes = atomic_load_explicit(&allocatedBytes, memory_order_relaxed);
+}
+
+// For frames that legitimately reach the heap, e.g. a resize recreating
+// its render targets
+void ExpectFrameAllocations(void) {
+    allocationsExpected = true;
+}
+
+void EndMemoryFrame(void) {
+    stats.frames++;
+    stats.lastAllocations = (int)(atomic_load_explicit(&allocations, memory_order_relaxed) - frameStartAllocations);
+    stats.lastBytes = atomic_load_explicit(&allocatedBytes, memory_order_relaxed) - frameStartBytes;
+    stats.arenaUsed = arenaUsed;
+    if (arenaUsed > stats.arenaPeak) stats.arenaPeak = arenaUsed;
+    if (stats.lastAllocations > 0 && !allocationsExpected) {
+        stats.allocatingFrames++;
+        assert(!strictAllocations && "heap allocation in a steady-state frame");
+    }
+}
+
+// Strict mode turns an unexpected allocation into a failed assertion
+// (debug builds); otherwise it is only counted for the profiler
+void SetStrictAllocations(bool strict) {
+    strictAllocations = strict;
+}
+
+const MemoryStats* GetMemoryStats(void) {
+    return &stats;
+}
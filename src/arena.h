@@ -0,0 +1,20 @@
+#ifndef ARENA_H
+#define ARENA_H
+#include "types.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+void* CountedMalloc(size_t size);
+void* CountedCalloc(size_t count, size_t size);
+void* CountedRealloc(void* pointer, size_t size);
+void CountedFree(void* pointer);
+
+void* FrameAlloc(size_t size);
+const char* FrameCopyText(const char* text);
+void BeginMemoryFrame(void);
+void ExpectFrameAllocations(void);
+void EndMemoryFrame(void);
+void SetStrictAllocations(bool strict);
+const MemoryStats* GetMemoryStats(void);
+
+#endif
@@ -0,0 +1,30 @@
+// Generated by tools/atlas_packer.c from resources/sprite.png; do not edit.
+#ifndef ATLAS_H
+#define ATLAS_H
+#include "types.h"
+
+#define ATLAS_PATH "resources/atlas.png"
+#define ATLAS_WIDTH 512
+#define ATLAS_HEIGHT 512
+
+static const AtlasSprite ATLAS_SPRITES[SPRITE_COUNT] = {
+    [SPRITE_RUN_1] = { { 88, 94 }, { 0, 6 }, { 102, 120, 88, 88 }, { 0, 6, 88, 88 } },
+    [SPRITE_RUN_2] = { { 88, 94 }, { 0, 6 }, { 192, 120, 88, 88 }, { 0, 6, 88, 88 } },
+    [SPRITE_CROUCH_1] = { { 118, 60 }, { 0, 2 }, { 93, 283, 118, 58 }, { 0, 2, 118, 58 } },
+    [SPRITE_CROUCH_2] = { { 118, 60 }, { 0, 2 }, { 213, 283, 118, 58 }, { 0, 2, 118, 58 } },
+    [SPRITE_CACTUS_1] = { { 34, 68 }, { 0, 2 }, { 131, 214, 34, 66 }, { 0, 2, 34, 66 } },
+    [SPRITE_CACTUS_2] = { { 68, 68 }, { 0, 2 }, { 167, 214, 68, 66 }, { 0, 2, 68, 66 } },
+    [SPRITE_CACTUS_3] = { { 102, 68 }, { 0, 2 }, { 237, 214, 102, 66 }, { 0, 2, 102, 66 } },
+    [SPRITE_CACTUS_4] = { { 50, 94 }, { 2, 2 }, { 370, 0, 48, 92 }, { 2, 2, 48, 92 } },
+    [SPRITE_CACTUS_5] = { { 100, 94 }, { 0, 2 }, { 0, 120, 100, 92 }, { 0, 2, 100, 92 } },
+    [SPRITE_CACTUS_6] = { { 150, 95 }, { 0, 2 }, { 218, 0, 150, 93 }, { 0, 2, 150, 93 } },
+    [SPRITE_BIRD_1] = { { 93, 80 }, { 0, 14 }, { 341, 214, 93, 66 }, { 0, 14, 93, 66 } },
+    [SPRITE_BIRD_2] = { { 93, 80 }, { 0, 2 }, { 0, 283, 91, 60 }, { 0, 2, 91, 60 } },
+    [SPRITE_METEOR_FALL_1] = { { 110, 120 }, { 0, 0 }, { 0, 0, 110, 118 }, { 0, 0, 110, 118 } },
+    [SPRITE_METEOR_FALL_2] = { { 110, 120 }, { 1, 7 }, { 112, 0, 104, 112 }, { 1, 7, 104, 112 } },
+    [SPRITE_METEOR_IMPACT_1] = { { 103, 68 }, { 1, 0 }, { 282, 120, 102, 67 }, { 1, 0, 102, 67 } },
+    [SPRITE_METEOR_IMPACT_2] = { { 129, 74 }, { 0, 0 }, { 0, 214, 129, 67 }, { 0, 0, 129, 67 } },
+    [SPRITE_METEOR_IMPACT_3] = { { 90, 51 }, { 3, 12 }, { 333, 283, 87, 39 }, { 3, 12, 87, 39 } }
+};
+
+#endif
@@ -0,0 +1,524 @@
+// Generated by tools/atlas_packer.c from resources/sprite.png; do not edit.
+#ifndef ATLAS_MASK_H
+#define ATLAS_MASK_H
+#include "atlas.h"
+#include <stdint.h>
+
+#define ATLAS_MASK_WORDS_PER_ROW 8
+
+static const uint64_t ATLAS_MASK_BITS[ATLAS_HEIGHT][ATLAS_MASK_WORDS_PER_ROW] = {
+    { 0, 0x00001ff800000000ULL, 0, 0x03ff0000001fc000ULL, 0, 0x000000003ff00000ULL, 0x000000000000ffc0ULL, 0 },
+    { 0, 0x00003ffc00000000ULL, 0, 0x03ff0000003fe000ULL, 0, 0x000000003ff00000ULL, 0x000000000000ffc0ULL, 0 },
+    { 0, 0x00003ffe00000000ULL, 0, 0x0fffc000007ff000ULL, 0, 0x00000000fffc0000ULL, 0x000000000003fff0ULL, 0 },
+    { 0, 0x00003fff80000000ULL, 0, 0x0fffc00000fff800ULL, 0, 0x00000000fffc0000ULL, 0x000000000003fff0ULL, 0 },
+    { 0, 0x00003fffc0000000ULL, 0, 0x3ffff00000fff800ULL, 0x00000003f0000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0, 0x00003fffe0000000ULL, 0, 0x3ffff00000fffc00ULL, 0x00000003f0000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0, 0x00001ffff0000000ULL, 0xf800000000000000ULL, 0x3ffff00000fffe03ULL, 0x0000000ffc000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0, 0x00001ffff8000000ULL, 0xff00000000000000ULL, 0x3ffff00000ffffc7ULL, 0x0000000ffc000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0, 0x00000ffffc000000ULL, 0xffc0000000000000ULL, 0x3ffff00000ffffefULL, 0x0000003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0, 0x00000ffffe01fc00ULL, 0xfff0000000000000ULL, 0x3ffff000007fffffULL, 0x0000003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0x07e0000000000000ULL, 0x000007fffe03ff00ULL, 0xfffc01fc00000000ULL, 0x3ffff000007fffffULL, 0x0000003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0x0ff0000000000000ULL, 0x000003ffff07ff80ULL, 0xfffe03ffc0000000ULL, 0x3ffff000007fffffULL, 0x0000003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0x1ffc000000000000ULL, 0x000001ffff8fffc0ULL, 0xffff87fff0000000ULL, 0x3ffff000007fffffULL, 0x0000003fff000000ULL, 0x00000003ffff03f0ULL, 0x00000000000ffffcULL, 0 },
+    { 0x3fff000000000000ULL, 0x000001ffffffffe0ULL, 0xffffcffff8000000ULL, 0x3ffff000003fffffULL, 0x0000003fff000000ULL, 0x00000003ffff03f0ULL, 0x00000000000ffffcULL, 0 },
+    { 0x3fff800000000000ULL, 0x000000fffffffff0ULL, 0xfffffffffc000000ULL, 0x3ffff000003fffffULL, 0x0000303fff000000ULL, 0x00000003ffff0ffcULL, 0x00000000000ffffcULL, 0 },
+    { 0x3fffc00000000000ULL, 0x000000fffffffffcULL, 0xfffffffffe000000ULL, 0x3ffff000001fffffULL, 0x0000303fff000000ULL, 0x00000003ffff0ffcULL, 0x00000000000ffffcULL, 0 },
+    { 0x3fffe00000000000ULL, 0x0000007fffffffffULL, 0xffffffffff800000ULL, 0x3ffff000001fffffULL, 0x0000fc3fff000000ULL, 0x00000003ffff3fffULL, 0x00000000000ffffcULL, 0 },
+    { 0xbffff00000000000ULL, 0x0000007fffffffffULL, 0xffffffffffc00000ULL, 0x3ffff000000fffffULL, 0x0000fc3fff000000ULL, 0x00000003ffff3fffULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffc0000000000ULL, 0x0000003fffffffffULL, 0xffffffffffe00000ULL, 0x3ffff000000fffffULL, 0x0003ff3fff000000ULL, 0x00000003ffff3fffULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffe0000000000ULL, 0x0000003fffffffffULL, 0xfffffffffff00000ULL, 0x3ffff000000fffffULL, 0x0003ff3fff000000ULL, 0x00000003ffff3fffULL, 0x00000000000ffffcULL, 0 },
+    { 0xffffff0000000000ULL, 0x0000001fffffffffULL, 0xfffffffffff80000ULL, 0x3ffff0000007ffffULL, 0x0003ff3fff000000ULL, 0x00000003ffff3fffULL, 0x00000000fc0ffffcULL, 0 },
+    { 0xffffff8000000000ULL, 0x0000000fffffffffULL, 0xfffffffffffe0000ULL, 0x3ffff0000007ffffULL, 0x0003ff3fff000000ULL, 0x00000003ffff3fffULL, 0x00000000fc0ffffcULL, 0 },
+    { 0xffffffe000000000ULL, 0x00000007ffffffffULL, 0xffffffffffff0000ULL, 0x3ffff0000003ffffULL, 0x0003ff3fff0000f0ULL, 0x00003f03ffff3fffULL, 0x00000003ff0ffffcULL, 0 },
+    { 0xfffffff000000000ULL, 0x00000007ffffffffULL, 0xffffffffffff8000ULL, 0x3ffff0000001ffffULL, 0x0003ff3fff0000f0ULL, 0x00003f03ffff3fffULL, 0x00000003ff0ffffcULL, 0 },
+    { 0xfffffff800000000ULL, 0x0000003fffffffffULL, 0xffffffffffffc000ULL, 0x3ffff03f0c00ffffULL, 0x0003ff3fff0003fcULL, 0x0fc0ffc3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffc00000000ULL, 0x0000007fffffffffULL, 0xffffffffffffe000ULL, 0x3ffff03f0c07ffffULL, 0x0003ff3fff0003fcULL, 0x0fc0ffc3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffe00000000ULL, 0x000000ffffffffffULL, 0xfffffffffffff000ULL, 0x3ffff0ffcc0fffffULL, 0x0003ff3fff000fffULL, 0x3ff0fff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffff80000000ULL, 0x000001ffffffffffULL, 0xfffffffffffff800ULL, 0x3ffff0ffcc1fffffULL, 0x0003ff3fff000fffULL, 0x3ff0fff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffc0000000ULL, 0x000001ffffffffffULL, 0xfffffffffffffc00ULL, 0x3ffff3fffc3fffffULL, 0x0003ff3fff000fffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffe0000000ULL, 0x000001ffffffffffULL, 0xfffffffffffffe00ULL, 0x3ffff3fffc3fffffULL, 0x0003ff3fff000fffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffff0000000ULL, 0x000001ffffffffffULL, 0xffffffffffffff00ULL, 0x3ffff3fffc3fffffULL, 0x0003ff3fff000fffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffff8000000ULL, 0x000001ffffffffffULL, 0xffffffffffffff80ULL, 0x3ffff3fffc3fffffULL, 0x0003ff3fff000fffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffc000000ULL, 0x000001ffffffffffULL, 0xffffffffffffffc0ULL, 0x3ffff3fffc3fffffULL, 0x0003ff3fff0f0fffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffe000000ULL, 0x000001ffffffffffULL, 0xffffffffffffffe0ULL, 0x3ffff3fffc1fffffULL, 0x0003ff3fff0f0fffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffff000000ULL, 0x000000ffffffffffULL, 0xfffffffffffffff0ULL, 0x3ffff3fffc1fffffULL, 0x0003ffffff3fcfffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffff800000ULL, 0x000000ffffffffffULL, 0xfffffffffffffff8ULL, 0x3ffff3fffc1fffffULL, 0x0003ffffff3fcfffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffc00000ULL, 0x000000ffffffffffULL, 0xfffffffffffffffcULL, 0x3ffff3fffc1fffffULL, 0x0003ffffffffffffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffe00000ULL, 0x0000007fffffffffULL, 0xfffffffffffffffeULL, 0x3ffff3fffc0fffffULL, 0x0003ffffffffffffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffff00000ULL, 0x0000007fffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc0fffffULL, 0x00c0ffffffffffffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffff80000ULL, 0x8000003fffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc07ffffULL, 0x00c0ffffffffffffULL, 0xfffcfff3ffff3fffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffc0000ULL, 0xc000003fffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc07ffffULL, 0x03f03fffffffffffULL, 0xfffcfff3ffffffffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffe0000ULL, 0xe000001fffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc03ffffULL, 0x03f03fffffffffffULL, 0xfffcfff3ffffffffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffff0000ULL, 0xf000001fffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc03ffffULL, 0x0ffc0fffffffffffULL, 0xfffcfff3ffffffffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffff8000ULL, 0xf800000fffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc01ffffULL, 0x0ffc0fffffffffffULL, 0xfffcfff3ffffffffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffffc000ULL, 0xf8000007ffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc01ffffULL, 0x0ffc003fffffffffULL, 0xfffcfff3ffffffffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffffe000ULL, 0xfc000003ffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc00ffffULL, 0x0ffc003fffffffffULL, 0xfffcfff3ffffffffULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffff000ULL, 0xfc000001ffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc007fffULL, 0x0ffc003fffffffffULL, 0xfffcfff3fffffffcULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffff800ULL, 0xfe000001ffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc003fffULL, 0x0ffc003fffffffffULL, 0xfffcfff3fffffffcULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffffc00ULL, 0xfe000001ffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc003fffULL, 0x0ffc303fffffffffULL, 0xfffcfff3fffffff3ULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffffe00ULL, 0xff000000ffffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc003fffULL, 0x0ffc303fffffffffULL, 0xfffcfff3fffffff3ULL, 0x00000003ffcffffcULL, 0 },
+    { 0xfffffffffffffe00ULL, 0xff0000007fffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc001fffULL, 0xcffcfc3fffffffffULL, 0xfffcfff3ffffffcfULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffffff00ULL, 0xff8000003fffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc000fffULL, 0xcffcfc3fffffffffULL, 0xfffcfff3ffffffcfULL, 0x00000003ffcffffcULL, 0 },
+    { 0xffffffffffffff00ULL, 0xffc000001fffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc0007ffULL, 0xffffff3fffffffffULL, 0xfffcfff3ffffff3fULL, 0x00000003ffffffffULL, 0 },
+    { 0xffffffffffffff80ULL, 0xffe000000fffffffULL, 0xffffffffffffffffULL, 0x3ffff3fffc0007ffULL, 0xffffff3fffffffffULL, 0xfffcfff3ffffff3fULL, 0x00000003ffffffffULL, 0 },
+    { 0xffffffffffffff80ULL, 0xffe000000fffffffULL, 0xffffffffffffffffULL, 0xfffffffff00003ffULL, 0xffffff3fffffffffULL, 0xfffcffffffff003fULL, 0x00000003ffffffffULL, 0 },
+    { 0xffffffffffffffc0ULL, 0xfff000000fffffffULL, 0xffffffffffffffffULL, 0xfffffffff00003ffULL, 0xffffff3fffffffffULL, 0xfffcffffffff003fULL, 0x00000003ffffffffULL, 0 },
+    { 0xffffffffffffffc0ULL, 0xfff0000007ffffffULL, 0xffffffffffffffffULL, 0xfffffffff00001ffULL, 0xffffff3ffffff3ffULL, 0xfffc3fffffff003fULL, 0x00000000ffffffffULL, 0 },
+    { 0xffffffffffffffe0ULL, 0xfff0000003ffffffULL, 0xffffffffffffffffULL, 0xfffffffff00001ffULL, 0xffffff3ffffff3ffULL, 0xfffc3fffffff003fULL, 0x00000000ffffffffULL, 0 },
+    { 0xfffffffffffffff0ULL, 0xfff0000001ffffffULL, 0xffffffffffffffffULL, 0xfffffffff00000ffULL, 0xffffff3ffffff0ffULL, 0xfff00fffffff003fULL, 0x000000003fffffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xfff0000001ffffffULL, 0xffffffffffffffffULL, 0xfffffffff00000ffULL, 0xffffff3ffffff0ffULL, 0xfff00fffffff003fULL, 0x000000003fffffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xfff0000000ffffffULL, 0xffffffffffffffffULL, 0xffffffff000000ffULL, 0xffffff3ffffff03fULL, 0xffc003ffffff003fULL, 0x000000000fffffffULL, 0 },
+    { 0xfffffffffffffffcULL, 0xfff0000000ffffffULL, 0xffffffffffffffffULL, 0xffffffff000000ffULL, 0xffffff3ffffff03fULL, 0xffc003ffffff003fULL, 0x000000000fffffffULL, 0 },
+    { 0xfffffffffffffffcULL, 0xfff00000007fffffULL, 0xffffffffffffffffULL, 0xfffffffc0000007fULL, 0xffffff3fffffc00fULL, 0xff0000ffffff003fULL, 0x0000000003ffffffULL, 0 },
+    { 0xfffffffffffffffeULL, 0xfff80000007fffffULL, 0xffffffffffffffffULL, 0xfffffffc0000007fULL, 0xffffff3fffffc00fULL, 0xff0000ffffff003fULL, 0x0000000003ffffffULL, 0 },
+    { 0xfffffffffffffffeULL, 0xfff80000003fffffULL, 0xffffffffffffffffULL, 0x3ffffff00000003fULL, 0xffffff3fffff0000ULL, 0xfc000003ffff003fULL, 0x00000000000fffffULL, 0 },
+    { 0xffffffffffffffffULL, 0xfff80000003fffffULL, 0xffffffffffffffffULL, 0x3ffffff00000003fULL, 0xffffff3fffff0000ULL, 0xfc000003ffff003fULL, 0x00000000000fffffULL, 0 },
+    { 0xffffffffffffffffULL, 0xfffc0000003fffffULL, 0xffffffffffffffffULL, 0x3fffffc00000001fULL, 0xffffff3ffffc0000ULL, 0x00000003ffff003fULL, 0x00000000000ffffcULL, 0 },
+    { 0xffffffffffffffffULL, 0xfffc0000003fffffULL, 0xffffffffffffffffULL, 0x3fffffc00000001fULL, 0xffffff3ffffc0000ULL, 0x00000003ffff003fULL, 0x00000000000ffffcULL, 0 },
+    { 0xffffffffffffffffULL, 0xfffc0000001fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000003fULL, 0xffffff3ffff00000ULL, 0x00000003ffff003fULL, 0x00000000000ffffcULL, 0 },
+    { 0xffffffffffffffffULL, 0xfffe0000001fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xffffff3ffff00000ULL, 0x00000003ffff003fULL, 0x00000000000ffffcULL, 0 },
+    { 0xffffffffffffffffULL, 0xfffe0000000fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xfffffc3fff000000ULL, 0x00000003ffff000fULL, 0x00000000000ffffcULL, 0 },
+    { 0xffffffffffffffffULL, 0xfffe0000000fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xfffffc3fff000000ULL, 0x00000003ffff000fULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffeULL, 0xfffe0000001fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xfffff03fff000000ULL, 0x00000003ffff0003ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffeULL, 0xffff0000003fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xfffff03fff000000ULL, 0x00000003ffff0003ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffeULL, 0xffff0000007fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xffffc03fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffeULL, 0xffff0000007fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000007fULL, 0xffffc03fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffeULL, 0xffff0000007fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000003fULL, 0x0fff003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffeULL, 0xffff0000007fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000001fULL, 0x0fff003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffff0000007fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000001fULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffff0000003fffffULL, 0xffffffffffffffffULL, 0x3ffff0000000000fULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffff0000003fffffULL, 0xffffffffffffffffULL, 0x3ffff00000000007ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xfffe0000001fffffULL, 0xffffffffffffffffULL, 0x3ffff00000000007ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xfffc0000000fffffULL, 0xffffffffffffffffULL, 0x3ffff00000000003ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xfff80000000fffffULL, 0xffffffffffffffffULL, 0x3ffff00000000003ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xfff000000007ffffULL, 0xffffffffffffffffULL, 0x3ffff00000000003ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffe000000003ffffULL, 0xffffffffffffffffULL, 0x3ffff00000000001ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffe000000001ffffULL, 0xffffffffffffffffULL, 0x3ffff00000000001ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffe000000000ffffULL, 0xffffffffffffffffULL, 0x3ffff00000000000ULL, 0x0ffc003fff000000ULL, 0x00000003ffff0000ULL, 0x00000000000ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffe000000000ffffULL, 0xffffffffffffffffULL, 0x3ffff00000000000ULL, 0x0ffc003fff00000cULL, 0x000000c3ffff0000ULL, 0x00000000030ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffc0000000007fffULL, 0x7fffffffffffffffULL, 0x3ffff00000000000ULL, 0x0ffc003fff00000cULL, 0x000000c3ffff0000ULL, 0x00000000030ffffcULL, 0 },
+    { 0xfffffffffffffffcULL, 0xffc0000000003fffULL, 0x3fffffffffffffffULL, 0x3ffff00000000000ULL, 0x0ffc003fff00003fULL, 0x300003f3ffff0000ULL, 0x000000000fcfffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xffc0000000001fffULL, 0x1fffffffffffffffULL, 0x3ffff00000000000ULL, 0x0ffc003fff00003fULL, 0x300003f3ffff0000ULL, 0x000000000fcfffffULL, 0 },
+    { 0xfffffffffffffff0ULL, 0xffc0000000000fffULL, 0x03ffffffffffffffULL, 0x3ffffcc000000000ULL, 0x0ffc003fff00300cULL, 0x000000c3ffffcc00ULL, 0, 0 },
+    { 0xffffffffffffffe0ULL, 0xffc00000000007ffULL, 0x007fffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffffe0ULL, 0xffc00000000003ffULL, 0x003fffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffffc0ULL, 0xffc00000000001ffULL, 0x001fffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffffc0ULL, 0xff800000000001ffULL, 0x000fffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffff80ULL, 0xff000000000001ffULL, 0x000fffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffff80ULL, 0xfe000000000000ffULL, 0x000fffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffff00ULL, 0xfc000000000000ffULL, 0x0007ffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffff00ULL, 0xf80000000000007fULL, 0x0007ffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffffe00ULL, 0xe00000000000007fULL, 0x0007ffffffffffffULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffffe00ULL, 0x000000000000007fULL, 0x0007fffffffffff0ULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffffe00ULL, 0x000000000000003fULL, 0x0003ffffffffffe0ULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffffe00ULL, 0x000000000000001fULL, 0x0001ffffffffffc0ULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffffc00ULL, 0x000000000000001fULL, 0x0000fffbffffff80ULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffff800ULL, 0x000000000000000fULL, 0x00007fc03fffff80ULL, 0, 0, 0, 0, 0 },
+    { 0xfffffffffffff000ULL, 0x0000000000000007ULL, 0x00003f800fffff00ULL, 0, 0, 0, 0, 0 },
+    { 0xffffffffffffe000ULL, 0x0000000000000003ULL, 0x000000000ffffe00ULL, 0, 0, 0, 0, 0 },
+    { 0xffe7ffffffffc000ULL, 0x0000000000000001ULL, 0x0000000007fffc00ULL, 0, 0, 0, 0, 0 },
+    { 0x7e03ffffffff8000ULL, 0, 0x0000000003fff800ULL, 0, 0, 0, 0, 0 },
+    { 0x0001ffffffff0000ULL, 0, 0x0000000001fe0000ULL, 0, 0, 0, 0, 0 },
+    { 0x0000fffffff80000ULL, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x00007fffffe00000ULL, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x000007ffffc00000ULL, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x000003ffff800000ULL, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x000001fffe000000ULL, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x000000fff0000000ULL, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x00000000ffc00000ULL, 0x000000000003ff00ULL, 0x03fffffffffc0000ULL, 0xfffff00000000000ULL, 0xfffe0000000fffffULL, 0x0000003f001fffe3ULL, 0, 0 },
+    { 0x00000000ffc00000ULL, 0x000000000003ff00ULL, 0x03fffffffffc0000ULL, 0xfffff00000000000ULL, 0xfffe07ffc00fffffULL, 0x0000007fc01ffff3ULL, 0, 0 },
+    { 0x00000003fff00000ULL, 0x00000000000fffc0ULL, 0x03fffffffffc0000ULL, 0xfffff00000000000ULL, 0xfffe0fffe00fffffULL, 0x000000ffe01ffff3ULL, 0, 0 },
+    { 0x00000003fff00000ULL, 0x00000000000fffc0ULL, 0x03fffffffffc0000ULL, 0xfffff00000000000ULL, 0xfffe1ffff00fffffULL, 0x000001fff81ffff3ULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0x00000000003ffff0ULL, 0x03ffffffffffc000ULL, 0xffffff0000000000ULL, 0xfffe3ffff80fffffULL, 0x000003fffc1ffff3ULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0x00000000003ffff0ULL, 0x03ffffffffffc000ULL, 0xffffff0000000000ULL, 0xfffc7ffffc0fffffULL, 0x000003fffe1fffffULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0x00000000003ffff0ULL, 0x03ffffffffffc000ULL, 0xffffff0000000000ULL, 0xfff87ffffc0fffffULL, 0x000003ffffffffffULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0x00000000003ffff0ULL, 0x03ffffffffffc000ULL, 0xffffff0000000000ULL, 0xfff07ffffc0fffffULL, 0x000003ffffffffffULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0x00000000003ffff0ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffe07ffffcffffffULL, 0x000003ffffffffffULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0x00000000003ffff0ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffc07ffffcffffffULL, 0x000003ffffffffffULL, 0, 0 },
+    { 0x3f00000ffffc0000ULL, 0x00000000003ffff0ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xff007ffffcffffffULL, 0x1fe003ffffffffffULL, 0, 0 },
+    { 0x3f00000ffffc0000ULL, 0x00000000003ffff0ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xfe003ffff8ffffffULL, 0x3ff001ffffffffffULL, 0, 0 },
+    { 0xffc0000ffffc0000ULL, 0x00000000003ffff0ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xff3ffffff0ffffffULL, 0x7ff800ffffffffffULL, 0, 0 },
+    { 0xffc0000ffffc0000ULL, 0x00000000003ffff0ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffffe0ffffffULL, 0xfffc007fffffffffULL, 0, 0 },
+    { 0xfff0000ffffc0000ULL, 0x00000000003ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffffc0ffffffULL, 0xfffe003fffffffffULL, 0, 0 },
+    { 0xfff0000ffffc0000ULL, 0x00000000003ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffff80ffffffULL, 0xffff000fffffffffULL, 0, 0 },
+    { 0xfff0000ffffc0000ULL, 0x00000000003ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0xffff81fdffffffffULL, 0, 0 },
+    { 0xfff0000ffffc0000ULL, 0x00000000003ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0xffff83ff7fffffffULL, 0, 0 },
+    { 0xfff0000ffffc0000ULL, 0x00000000003ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0xffffc7ffffffffffULL, 0, 0 },
+    { 0xfff0000ffffc0000ULL, 0x00000000003ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0xffffcfffffffffffULL, 0, 0 },
+    { 0xfff03c0ffffc0000ULL, 0x00000003f03ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0xffffdfffffffffffULL, 0, 0 },
+    { 0xfff03c0ffffc0000ULL, 0x00000003f03ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0x7fffdfffffffffffULL, 0, 0 },
+    { 0xfff3ff0ffffc0000ULL, 0x0000000ffc3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0x3fffffffffffffffULL, 0, 0 },
+    { 0xfff3ff0ffffc0000ULL, 0x0000000ffc3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0x1fffffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffc0fc3ULL, 0x0000000fff3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0x07ffffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffc0fc3ULL, 0x0000000fff3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffff8000ffffffULL, 0x03ffffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffc3ff3ULL, 0x0000000fff3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffff00ffffffULL, 0x01ffffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffc3ff3ULL, 0x0000000fff3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffff80ffffffULL, 0x00ffffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0000000fff3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffffc0ffffffULL, 0x007fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0000000fff3ffff3ULL, 0x3fffffffffffc000ULL, 0xffffff0000000000ULL, 0xffffffffe0ffffffULL, 0x007fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003fc0fff3ffff3ULL, 0x003ffffffffffc00ULL, 0xfffffff000000ff0ULL, 0xfffffffff000ffffULL, 0x007fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003fc0fff3ffff3ULL, 0x003ffffffffffc00ULL, 0xfffffff000000ff0ULL, 0xfffffffff800ffffULL, 0x007fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003fc0fff3ffff3ULL, 0x003ffffffffffc00ULL, 0xfffffff000000ff0ULL, 0xfffffffff800ffffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003fc0fff3ffff3ULL, 0x003ffffffffffc00ULL, 0xfffffff000000ff0ULL, 0xfffffffff800ffffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003ffcfff3ffff3ULL, 0x003ffffffffffff0ULL, 0xffffffffc0000fffULL, 0xfffffffff800ffffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003ffcfff3ffff3ULL, 0x003ffffffffffff0ULL, 0xffffffffc0000fffULL, 0xfffffffff800ffffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003ffcfff3ffff3ULL, 0x003ffffffffffff0ULL, 0xffffffffc0000fffULL, 0xfffffffff800ffffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0x0003ffcfff3ffff3ULL, 0x003ffffffffffff0ULL, 0xffffffffc0000fffULL, 0xfffffffff800ffffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0xc003ffcfff3ffff3ULL, 0x00003fffffffffffULL, 0xffffffffff000fffULL, 0xfffffffff00000ffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0xc003ffcfff3ffff3ULL, 0x00003fffffffffffULL, 0xffffffffff000fffULL, 0xffffffffe00000ffULL, 0x003fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0xc003ffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffff000fffULL, 0xffffffffe00000ffULL, 0x001fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0xc003ffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffff000fffULL, 0xffffffffe00000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffffe00000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xfff3ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffffe00000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xffc3ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffffe00000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xffc3ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffffe00000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xff03ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffffe00000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xff03ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffffc00000ffULL, 0x0007ffffffffffffULL, 0, 0 },
+    { 0xfc03ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffff800000ffULL, 0x0007ffffffffffffULL, 0, 0 },
+    { 0xfc03ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffff800000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xf003ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffff800000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xf003ffcffffcffffULL, 0xffffffcfff3fffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffff800000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xc003ffffffffffffULL, 0xffffffcfffffffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffff800000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0xc003ffffffffffffULL, 0xffffffcfffffffffULL, 0x00003fffffffffffULL, 0xffffffffffffffffULL, 0xffffffff800000ffULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0x0000fffffffffffcULL, 0xffffffcffffffff0ULL, 0x0000003fffffffffULL, 0xffffffffffffffffULL, 0xffffffff80000000ULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0x0000fffffffffffcULL, 0xffffffcffffffff0ULL, 0x0000003fffffffffULL, 0xffffffffffffffffULL, 0xffffffff80000000ULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0x00003ffffffffffcULL, 0xffffffc3fffffff0ULL, 0x0000003fffffffffULL, 0xffffffffffffffffULL, 0xffffffff80000000ULL, 0x000fffffffffffffULL, 0, 0 },
+    { 0x00003ffffffffffcULL, 0xffffffc3fffffff0ULL, 0x0000003fffffffffULL, 0xffffffffffffffffULL, 0xffffffff80000000ULL, 0x0007ffffffffffffULL, 0, 0 },
+    { 0x00000ffffffffff0ULL, 0xfffffc00fffffff0ULL, 0x0000003fffffffffULL, 0xfffffffffffffff0ULL, 0xffffffff00000000ULL, 0x0003ffffffffffffULL, 0, 0 },
+    { 0x00000ffffffffff0ULL, 0xfffffc00fffffff0ULL, 0x0000003fffffffffULL, 0xfffffffffffffff0ULL, 0xfffffffe00000000ULL, 0x0003ffffffffffffULL, 0, 0 },
+    { 0x000003ffffffffc0ULL, 0xfffffc003ffffff0ULL, 0x00000003ffffffffULL, 0x0ffffffffffffff0ULL, 0xfffffffc00000000ULL, 0x0003ffffffffffffULL, 0, 0 },
+    { 0x000003ffffffffc0ULL, 0xfffffc003ffffff0ULL, 0x00000003ffffffffULL, 0x0ffffffffffffff0ULL, 0xfffffff800000000ULL, 0x0001ffffffffffffULL, 0, 0 },
+    { 0x0000000fffffff00ULL, 0xffffc0000ffffff0ULL, 0x00000003ffffffffULL, 0x0fffffffffffff00ULL, 0xfffffff000000000ULL, 0x0000ffffffffffffULL, 0, 0 },
+    { 0x0000000fffffff00ULL, 0xffffc0000ffffff0ULL, 0x00000003ffffffffULL, 0x0fffffffffffff00ULL, 0xffffffe000000000ULL, 0x00007fffffffffffULL, 0, 0 },
+    { 0x0000000ffffffc00ULL, 0xffffc000003ffff0ULL, 0x00000003ffffffffULL, 0x0fffffffffffff00ULL, 0xffffffc000000000ULL, 0x00003fffffffffffULL, 0, 0 },
+    { 0x0000000ffffffc00ULL, 0xffffc000003ffff0ULL, 0x00000003ffffffffULL, 0x0fffffffffffff00ULL, 0xffffff8000000000ULL, 0x000007ffffffffffULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfffc0000003ffff0ULL, 0x00000003ffffffffULL, 0x0ffffffffffff000ULL, 0xfffffe0000000000ULL, 0x000001ffffffffffULL, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfffc0000003ffff0ULL, 0x00000003ffffffffULL, 0x0ffffffffffff000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfffc0000003ffff0ULL, 0x00000003ffffffffULL, 0x0ffffffffffff000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfffc0000003ffff0ULL, 0x00000003ffffffffULL, 0x0ffffffffffff000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x000000003fffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x000000003fffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x000000003fffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x000000003fffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x0000000fffffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x0000000fffffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x0000000fffffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xffc00000003ffff0ULL, 0x0000000fffffffffULL, 0x00ffffffffff0000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x00000000ffffc3ffULL, 0x000ffffffff00000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x00000000ffffc3ffULL, 0x000ffffffff00000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x00000000ffffc3ffULL, 0x000ffffffff00000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x00000000ffffc3ffULL, 0x000ffffffff00000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x000000000000003fULL, 0x000fff0fff000000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x000000000000003fULL, 0x000fff0fff000000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x000000000000003fULL, 0x000fff0fff000000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x000000000000003fULL, 0x000fff0fff000000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x00000000000003ffULL, 0x00ffff0000000000ULL, 0, 0, 0, 0 },
+    { 0x0000000ffffc0000ULL, 0xfc000000003ffff0ULL, 0x00000000000003ffULL, 0x00ffff0000000000ULL, 0, 0, 0, 0 },
+    { 0x0000030ffffc0000ULL, 0x000000000c3ffff0ULL, 0, 0, 0, 0, 0, 0 },
+    { 0x0000030ffffc0000ULL, 0x000000000c3ffff0ULL, 0, 0, 0, 0, 0, 0 },
+    { 0xc0000fcfffff3000ULL, 0x000000003f3ffffcULL, 0, 0, 0, 0, 0, 0 },
+    { 0xc0000fcfffff3000ULL, 0x000000003f3ffffcULL, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0xe01fff87fe000000ULL, 0x0000007ffc01ffffULL, 0x07e00000007e0000ULL, 0xf80000001f800000ULL, 0x80000007e0000001ULL, 0x0001fe000000001fULL, 0, 0 },
+    { 0xf01fff83fc000000ULL, 0x000000fffe00ffffULL, 0x07e00000007e0000ULL, 0xf80000001f800000ULL, 0x80000007e0000001ULL, 0x0001fe000000001fULL, 0, 0 },
+    { 0xf81fff81f8000000ULL, 0x000000fffe007fffULL, 0x1ff8000001ff8000ULL, 0xfe0000007fe00000ULL, 0xe000001ff8000007ULL, 0x0001fe000000007fULL, 0, 0 },
+    { 0xfc1fff8000000000ULL, 0x000000fffe003fffULL, 0x1ff8000001ff8000ULL, 0xfe0000007fe00000ULL, 0xe000001ff8000007ULL, 0x0001fe000000007fULL, 0, 0 },
+    { 0xfc1fff8000000000ULL, 0x000000fffe0007ffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0x001fffe0000001ffULL, 0, 0 },
+    { 0xfc0fff0000000000ULL, 0x000000fffe0007ffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0x001fffe0000001ffULL, 0, 0 },
+    { 0xfc07fe0000000000ULL, 0x000000fffe0007ffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf860007ffe18001fULL, 0x001fffe0000001ffULL, 0, 0 },
+    { 0xfc03fc0000000000ULL, 0x0000007ffc0007ffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf860007ffe18001fULL, 0x001fffe0000001ffULL, 0, 0 },
+    { 0xfc00000000000000ULL, 0x0000003ff80003ffULL, 0x7ffe000187ffe000ULL, 0xff800061fff9e018ULL, 0xf9f8007ffe7e061fULL, 0x001ffffe000061ffULL, 0, 0 },
+    { 0xfc00000000000000ULL, 0x1fc0001ff00001ffULL, 0x7ffe000187ffe000ULL, 0xff800061fff9e018ULL, 0xf9f8007ffe7e061fULL, 0x001ffffe000061ffULL, 0, 0 },
+    { 0xf800000000000000ULL, 0x3fe0000fe00000ffULL, 0x7ffe0007e7ffe000ULL, 0xff8001f9fffff87eULL, 0xfffe007fffff9f9fULL, 0x001ffffe0001f9ffULL, 0, 0 },
+    { 0xf000000000000000ULL, 0x7ff000000000007fULL, 0x7ffe0007e7ffe000ULL, 0xff8001f9fffff87eULL, 0xfffe007fffff9f9fULL, 0x001ffffe0001f9ffULL, 0, 0 },
+    { 0xfff0000000000000ULL, 0xfff800000000003fULL, 0xfffe001fffffe000ULL, 0xff8007ffffffffffULL, 0xfffe007fffffffffULL, 0x01ffffffe007ffffULL, 0, 0 },
+    { 0xfff8000000000000ULL, 0xfffc000000000fffULL, 0xfffe001fffffe001ULL, 0xff8007ffffffffffULL, 0xfffe007fffffffffULL, 0x01ffffffe007ffffULL, 0, 0 },
+    { 0xffffc00000000000ULL, 0xfffc000000003fffULL, 0xfffe001fffffe001ULL, 0xff8007ffffffffffULL, 0xfffe187fffffffffULL, 0x01ffffffe007ffffULL, 0, 0 },
+    { 0xfffff00000000000ULL, 0xfffc00000000ffffULL, 0xfffe001fffffe001ULL, 0xff8007ffffffffffULL, 0xfffe187fffffffffULL, 0x01ffffffe007ffffULL, 0, 0 },
+    { 0xffffff80000003f0ULL, 0xfffc00000001ffffULL, 0xfffe181fffffe181ULL, 0xff8607ffffffffffULL, 0xfffe7e7fffffffffULL, 0xfffffffffe07ffffULL, 0x000000000001ffffULL, 0 },
+    { 0xffffffe0000007f8ULL, 0xfffc00000003ffffULL, 0xfffe181fffffe181ULL, 0xff8607ffffffffffULL, 0xfffe7e7fffffffffULL, 0xfffffffffe07ffffULL, 0x000000000001ffffULL, 0 },
+    { 0xfffffff000000ffcULL, 0xfffc00000007ffffULL, 0xfffe7e1fffffe7e1ULL, 0xff9f87ffffffffffULL, 0xffffffffffffffffULL, 0xfffffffffe07ffffULL, 0x000000000001ffffULL, 0 },
+    { 0xfffffff800001ffeULL, 0xfff80000001fffffULL, 0xfffe7e1fffffe7e0ULL, 0xff9f87ffffffffffULL, 0xffffffffffffffffULL, 0xfffffffffe07ffffULL, 0x000000000001ffffULL, 0 },
+    { 0xfffffffc00003fffULL, 0x7ff0000003ffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x00020000001fffffULL, 0 },
+    { 0xfffffffe00003fffULL, 0x3fe0000007ffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x00020000001fffffULL, 0 },
+    { 0xffffffff00003fffULL, 0x1fc000000fffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x00020000001fffffULL, 0 },
+    { 0xffffffff00003fffULL, 0x000000001fffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x00020000001fffffULL, 0 },
+    { 0xffffffff80003fffULL, 0x000000003fffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xffffffff80003fffULL, 0x000000007fffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xffffffffc0001ffeULL, 0x000000007fffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xffffffffc0000ffcULL, 0x00000000ffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xffffffffc00007f8ULL, 0x00000000ffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xfffe00000007ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xffffffffe00003f0ULL, 0x00000001ffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffffffULL, 0xffffffffffffffffULL, 0xfffe00000007ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xffffffffe0000000ULL, 0x00000003ffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7fffffff9ffULL, 0xffffffffffffffffULL, 0xfffe00000007ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xfffffffff8000000ULL, 0x0000000fffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7fffffff9ffULL, 0xffffffffffffffffULL, 0xfffe00000007ffffULL, 0x0001ffffffffffffULL, 0 },
+    { 0xfffffffffc000000ULL, 0x0000001fffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffe1ffULL, 0xffffffffffffffffULL, 0xffe000000007ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xfffffffffe000000ULL, 0x0000003fffffffffULL, 0xffffff9ffffffff8ULL, 0xffffe7ffffffe1ffULL, 0xffffffffffffffffULL, 0xffe000000007ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xffffffffff000000ULL, 0x0000007fffffffffULL, 0xffffff87fffffff8ULL, 0xffffe7ffffff807fULL, 0xffffffffffff9fffULL, 0xffe000000007ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xffffffffff800000ULL, 0x000000ffffffffffULL, 0xffffff87fffffff8ULL, 0xffffe7ffffff807fULL, 0xffffffffffff9fffULL, 0xffe000000007ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xffffffffffc00000ULL, 0x000001ffffffffffULL, 0xffffff81fffffff8ULL, 0xffffe7fffff8001fULL, 0xffe1ffffffff87ffULL, 0xffe000000007ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xffffffffffe00000ULL, 0x000003ffffffffffULL, 0xffffff81fffffff8ULL, 0xffffe7fffff8001fULL, 0xffe1ffffffff87ffULL, 0xffe000000007ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xfffffffffff00000ULL, 0x000003ffffffffffULL, 0xffffff807ffffff8ULL, 0xffffe1fffff80007ULL, 0xff81ffffffff81ffULL, 0xffe000000001ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0xffffff807ffffff8ULL, 0xffffe1fffff80007ULL, 0xff81ffffffff81ffULL, 0xffe000000001ffffULL, 0x00001fffffffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7fffff8007fffff8ULL, 0xffffe07ffff80000ULL, 0xf801ffffffff801fULL, 0xffe0000000007fffULL, 0x000001ffffffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7fffff8007fffff8ULL, 0xffffe07ffff80000ULL, 0xf801ffffffff801fULL, 0xffe0000000007fffULL, 0x000001ffffffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7ffffe0007ffffe0ULL, 0xffff801ffff80000ULL, 0xf801fffffffe001fULL, 0xffe0000000001fffULL, 0x000001ffffffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7ffffe0007ffffe0ULL, 0xffff801ffff80000ULL, 0xf801fffffffe001fULL, 0xffe0000000001fffULL, 0x000001ffffffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7ffff80007ffff80ULL, 0xfffe0001fff80000ULL, 0xf801fffffff8001fULL, 0xffe00000000001ffULL, 0x000000001fffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7ffff80007ffff80ULL, 0xfffe0001fff80000ULL, 0xf801fffffff8001fULL, 0xffe00000000001ffULL, 0x000000001fffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7fffe00007fffe00ULL, 0xfff80001fff80000ULL, 0xf801ffffffe0001fULL, 0xffe00000000001ffULL, 0x000000001fffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7fffe00007fffe00ULL, 0xfff80001fff80000ULL, 0xf801ffffffe0001fULL, 0xffe00000000001ffULL, 0x000000001fffffffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf8007ffffe00001fULL, 0xffe00000000001ffULL, 0x00000000000001ffULL, 0 },
+    { 0xfffffffffff00000ULL, 0x000001ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf8007ffffe00001fULL, 0xffe00000000001ffULL, 0x00000000000001ffULL, 0 },
+    { 0xfffffffffff00000ULL, 0x000001ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf8001ffffe00001fULL, 0xffe00000000001ffULL, 0x00000000000001ffULL, 0 },
+    { 0xfffffffffff80000ULL, 0x000001ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf8001ffffe00001fULL, 0xffe00000000001ffULL, 0x00000000000001ffULL, 0 },
+    { 0xfffffffffffc0000ULL, 0x000001ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf80007fffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xfffffffffffe0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf80007fffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xfffffffffffe0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x000000000000001fULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000003ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x0000000000000001ULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000001ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x0000000000000001ULL, 0 },
+    { 0xffffffffffff0000ULL, 0x000001ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x0000000000000001ULL, 0 },
+    { 0xfffffffffffe0000ULL, 0x000000ffffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0xffe00000000001ffULL, 0x0000000000000001ULL, 0 },
+    { 0xfffffffffffc0000ULL, 0x0000007fffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0x1e000000000001ffULL, 0, 0 },
+    { 0xfffffffffff80000ULL, 0x0000003fffffffffULL, 0x7ffe000007ffe000ULL, 0xff800001fff80000ULL, 0xf800007ffe00001fULL, 0x1e000000000001ffULL, 0, 0 },
+    { 0xfffffffffff00000ULL, 0x0000001fffffffffULL, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0x0000000780000000ULL, 0x000001ffe0000000ULL, 0, 0x00000001ffe00000ULL, 0, 0xffffc00000000000ULL, 0, 0 },
+    { 0x0000000780000000ULL, 0x000001ffe0000000ULL, 0, 0x00000001ffe00000ULL, 0, 0xffffe00000000000ULL, 0x000000000000003fULL, 0 },
+    { 0x0000000780000000ULL, 0x000001ffe0000000ULL, 0xffffff8000000000ULL, 0x00000001ffe07fffULL, 0xffffffff80000000ULL, 0xffffff000000007fULL, 0x00000000000000ffULL, 0 },
+    { 0x0000000780000000ULL, 0x000001ffe0000000ULL, 0xffffff8000000000ULL, 0x00000001ffe07fffULL, 0xffffffff80000000ULL, 0xffffffc00000007fULL, 0x00000000000003ffULL, 0 },
+    { 0x0000007ff8000000ULL, 0xfe01ffffe0000000ULL, 0xffffff87ffffffffULL, 0xfffe01ffffe07fffULL, 0xffffffff87ffffffULL, 0xfffffffe0000007fULL, 0x00000000000007ffULL, 0 },
+    { 0x0000007ff8000000ULL, 0xfe01ffffe0000000ULL, 0xffffff87ffffffffULL, 0xfffe01ffffe07fffULL, 0xffffffff87ffffffULL, 0xffffffff8000007fULL, 0x0000000000000fffULL, 0 },
+    { 0x0000007ff8000000ULL, 0xfe01ffffe0000000ULL, 0xffffffffffffffffULL, 0xfffe01ffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffc00007ffULL, 0x0000000000001fffULL, 0 },
+    { 0x0000007ff8000000ULL, 0xfe01ffffe0000000ULL, 0xffffffffffffffffULL, 0xfffe01ffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffe00007ffULL, 0x0000000000007fffULL, 0 },
+    { 0x000007fff8000000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xfffffffff00007ffULL, 0x00000000000fffffULL, 0 },
+    { 0x000007fff8000000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xfffffffff80007ffULL, 0x00000000001fffffULL, 0 },
+    { 0x000007fff8000000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xfffffffffc0007ffULL, 0x00000000003fffffULL, 0 },
+    { 0x000007fff8000000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xfffffffffc0007ffULL, 0x00000000007fffffULL, 0 },
+    { 0x00007ffffff80000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xfffffffffe0007ffULL, 0x0000000000ffffffULL, 0 },
+    { 0x00007ffffff80000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xfffffffffe0007ffULL, 0x0000000001ffffffULL, 0 },
+    { 0x00007ffffff80000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffff0007ffULL, 0x0000000001ffffffULL, 0 },
+    { 0x00007ffffff80000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffff0007ffULL, 0x0000000003ffffffULL, 0 },
+    { 0x0007ffffffff8000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffff0007ffULL, 0x0000000003ffffffULL, 0 },
+    { 0x0007ffffffff8000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffff8007ffULL, 0x0000000007ffffffULL, 0 },
+    { 0x0007ffffffff8000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffff8007ffULL, 0x000000000fffffffULL, 0 },
+    { 0x0007ffffffff8000ULL, 0xffffffffe0000000ULL, 0xffffffffffffffffULL, 0xffffffffffe7ffffULL, 0xffffffffffffffffULL, 0xffffffffffe007ffULL, 0x000000003fffffffULL, 0 },
+    { 0x007ffffffffff800ULL, 0xfffffffe00000000ULL, 0xffffffffffffffffULL, 0xfffffffffe07ffffULL, 0xffffffffffffffffULL, 0xfffffffffff007ffULL, 0x000000007fffffffULL, 0 },
+    { 0x007ffffffffff800ULL, 0xfffffffe00000000ULL, 0xffffffffffffffffULL, 0xfffffffffe07ffffULL, 0xffffffffffffffffULL, 0xfffffffffff807ffULL, 0x00000000ffffffffULL, 0 },
+    { 0x007ffffffffff800ULL, 0xfffffffe00000000ULL, 0xffffffffffffffffULL, 0xfffffffffe07ffffULL, 0xffffffffffffffffULL, 0xfffffffffffc07ffULL, 0x00000001ffffffffULL, 0 },
+    { 0x007ffffffffff800ULL, 0xfffffffe00000000ULL, 0xffffffffffffffffULL, 0xfffffffffe07ffffULL, 0xffffffffffffffffULL, 0xfffffffffffe07ffULL, 0x00000003ffffffffULL, 0 },
+    { 0x07ffffffffffff80ULL, 0xffffffe000000000ULL, 0xffffffffffffffffULL, 0xffffffffe007ffffULL, 0xffffffffffffffffULL, 0xffffffffffff07ffULL, 0x00000007ffffffffULL, 0 },
+    { 0x07ffffffffffff80ULL, 0xffffffe000000000ULL, 0xffffffffffffffffULL, 0xffffffffe007ffffULL, 0xffffffffffffffffULL, 0xffffffffffff87ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x07ffffffffffff80ULL, 0xffffffe000000000ULL, 0xffffffffffffffffULL, 0xffffffffe007ffffULL, 0xffffffffffffffffULL, 0xffffffffffffc7ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x07ffffffffffff80ULL, 0xffffffe000000000ULL, 0xffffffffffffffffULL, 0xffffffffe007ffffULL, 0xffffffffffffffffULL, 0xffffffffffffe7ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x7ffffffffffffff8ULL, 0xfffffe0000000000ULL, 0xffffffffffffffffULL, 0xfffffffe0007ffffULL, 0xffffffffffffffffULL, 0xffffffffffffe7ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x7ffffffffffffff8ULL, 0xfffffe0000000000ULL, 0xffffffffffffffffULL, 0xfffffffe0007ffffULL, 0xffffffffffffffffULL, 0xffffffffffffe7ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x7ffffffffffffff8ULL, 0xfffffe0000000000ULL, 0xffffffffffffffffULL, 0xfffffffe0007ffffULL, 0xffffffffffffffffULL, 0xffffffffffffe7ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x7ffffffffffffff8ULL, 0xfffffe0000000000ULL, 0xffffffffffffffffULL, 0xfffffffe0007ffffULL, 0xffffffffffffffffULL, 0xffffffffffffe7ffULL, 0x0000000fffffffffULL, 0 },
+    { 0x7fffffffffffffffULL, 0xffffe00000000000ULL, 0xffffffffffffffffULL, 0xffffffe000007fffULL, 0xffffffffffffffffULL, 0xffffffffffffe07fULL, 0x0000000fffffffffULL, 0 },
+    { 0x7fffffffffffffffULL, 0xffffe00000000000ULL, 0xffffffffffffffffULL, 0xffffffe000007fffULL, 0xffffffffffffffffULL, 0xffffffffffffe07fULL, 0x0000000fffffffffULL, 0 },
+    { 0x7fffffffffffffffULL, 0xffffe00000000000ULL, 0xffffffffffffffffULL, 0xffffffe000007fffULL, 0xffffffffffffffffULL, 0xffffffffffffe07fULL, 0x0000000fffffffffULL, 0 },
+    { 0x7fffffffffffffffULL, 0xffffe00000000000ULL, 0xffffffffffffffffULL, 0xffffffe000007fffULL, 0xffffffffffffffffULL, 0xffffffffffffe07fULL, 0x0000000fffffffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xfff80000007fffffULL, 0xfffff87fffffffffULL, 0xfffff800000007ffULL, 0xfffffff87fffffffULL, 0xffffffffffffe007ULL, 0x0000000fffffffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xfff80000007fffffULL, 0xfffff87fffffffffULL, 0xfffff800000007ffULL, 0xfffffff87fffffffULL, 0xffffffffffffc007ULL, 0x00000007ffffffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xfff80000007fffffULL, 0xfffff87fffffffffULL, 0xfffff800000007ffULL, 0xfffffff87fffffffULL, 0xffffffffffffc007ULL, 0x00000007ffffffffULL, 0 },
+    { 0xfffffffffffffff8ULL, 0xfff80000007fffffULL, 0xfffff87fffffffffULL, 0xfffff800000007ffULL, 0xfffffff87fffffffULL, 0x0000000000000007ULL, 0, 0 },
+    { 0xfffffffff8000000ULL, 0xfff8000007ffffffULL, 0x0000007fffffffffULL, 0xfffff80000000000ULL, 0x000000007fffffffULL, 0, 0, 0 },
+    { 0xfffffffff8000000ULL, 0xfff8000007ffffffULL, 0x0000007fffffffffULL, 0xfffff80000000000ULL, 0x000000007fffffffULL, 0, 0, 0 },
+    { 0xfffffffff8000000ULL, 0xffff800007ffffffULL, 0x000007ffff87ffffULL, 0xffffff8000000000ULL, 0x00000007ffffffffULL, 0, 0, 0 },
+    { 0xfffffffff8000000ULL, 0xffff800007ffffffULL, 0x000007ffff87ffffULL, 0xffffff8000000000ULL, 0x00000007ffffffffULL, 0, 0, 0 },
+    { 0xffffffff80000000ULL, 0xffff8000007fffffULL, 0x000007ffff807fffULL, 0x07ffff8000000000ULL, 0x00000007fffffff8ULL, 0, 0, 0 },
+    { 0xffffffff80000000ULL, 0xffff8000007fffffULL, 0x000007ffff807fffULL, 0x07ffff8000000000ULL, 0x00000007fffffff8ULL, 0, 0, 0 },
+    { 0xffffffff80000000ULL, 0xfff80000007fffffULL, 0x0000007fff807fffULL, 0x07fff80000000000ULL, 0x000000007ffffff8ULL, 0, 0, 0 },
+    { 0xffffffff80000000ULL, 0xfff80000007fffffULL, 0x0000007fff807fffULL, 0x07fff80000000000ULL, 0x000000007ffffff8ULL, 0, 0, 0 },
+    { 0xfffffff800000000ULL, 0xfff80000007fffffULL, 0x0000007fff8007ffULL, 0x07fff80000000000ULL, 0x000000007fff8000ULL, 0, 0, 0 },
+    { 0xfffffff800000000ULL, 0xfff80000007fffffULL, 0x0000007fff8007ffULL, 0x07fff80000000000ULL, 0x000000007fff8000ULL, 0, 0, 0 },
+    { 0xfffffff800000000ULL, 0xfff80000007fffffULL, 0x00000000000007ffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xfffffff800000000ULL, 0xfff80000007fffffULL, 0x00000000000007ffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xffffff8000000000ULL, 0x800000000007ffffULL, 0x0000000000007fffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xffffff8000000000ULL, 0x800000000007ffffULL, 0x0000000000007fffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xffffff8000000000ULL, 0x800000000007ffffULL, 0x0000000000007fffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xffffff8000000000ULL, 0x800000000007ffffULL, 0x0000000000007fffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xfffff80000000000ULL, 0x80000000000007ffULL, 0x0000000000007fffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xfffff80000000000ULL, 0x80000000000007ffULL, 0x0000000000007fffULL, 0x07fff80000000000ULL, 0, 0, 0, 0 },
+    { 0xfffff80000000000ULL, 0x00000000000007ffULL, 0, 0, 0, 0, 0, 0 },
+    { 0xfffff80000000000ULL, 0x00000000000007ffULL, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 0, 0, 0, 0, 0, 0 }
+};
+
+#endif
@@ -0,0 +1,401 @@
+#include "autopilot.h"
+#include "collision.h"
+#include "game.h"
+#include "boss.h"
+#include "tuning.h"
+#include <math.h>
+#include <stdbool.h>
+
+// Lookahead bot: it replays a handful of short input plans through the
+// player's jump physics and picks the one that acts as late as possible
+// and still survives the horizon. While that plan keeps surviving it is
+// simply followed; only when it stops working is a new one searched for.
+// It only reads GameState, so it works the same in the windowed game and
+// in headless tools.
+
+typedef struct {
+    float y;
+    float velocity;
+    float chargeTime;
+    bool jumping;
+    bool crouching;
+    bool charging;
+    PlayerInput prevInput;
+} AutopilotBody;
+
+// Threat hitboxes are stored relative to the sprite origin; meteors keep
+// one box per impact frame because the frame changes while they slide.
+// Projectiles fly in a straight line until they reach the ground.
+typedef struct {
+    float x;
+    float y;
+    float speedX;
+    float speedY;
+    float landY;
+    int impactTicks;
+    bool falling;
+    bool meteor;
+    bool projectile;
+    bool spent;
+    Rectangle bounds[METEOR_IMPACT_FRAMES];
+} AutopilotThreat;
+
+#define METEOR_FRAME_TICKS (int)ceilf(METEOR_ANIM_DELAY * 1.5f * SIM_TICK_RATE)
+
+// A plan idles for `wait` ticks, then holds `input` for `hold` ticks and
+// idles again
+typedef struct {
+    int wait;
+    PlayerInput input;
+    int hold;
+} AutopilotPlan;
+
+static const AutopilotPlan AUTOPILOT_ACTIONS[] = {
+    { 0, INPUT_CROUCH, 24 },
+    { 0, INPUT_JUMP,   1 },
+    { 0, INPUT_JUMP,   6 },
+    { 0, INPUT_JUMP,   12 },
+    { 0, INPUT_JUMP,   18 },
+    { 0, INPUT_CROUCH, AUTOPILOT_HORIZON_TICKS },
+};
+#define AUTOPILOT_ACTION_COUNT (int)(sizeof(AUTOPILOT_ACTIONS) / sizeof(AUTOPILOT_ACTIONS[0]))
+#define AUTOPILOT_WAIT_STEP 2
+
+// Mirrors ApplyPlayerInput() followed by UpdatePhysics() for one SIM_DT tick
+static void StepBody(AutopilotBody* body, const GameState* game, PlayerInput input) {
+    bool jumpHeld = (input & INPUT_JUMP) != 0;
+    bool wasJumpHeld = (body->prevInput & INPUT_JUMP) != 0;
+    bool wasCrouching = body->crouching;
+    body->crouching = (input & INPUT_CROUCH) != 0;
+    if (!body->jumping && body->crouching != wasCrouching) {
+        float height = body->crouching ? game->crouchFrameHeight : game->runFrameHeight;
+        body->y = BASE_RESOLUTION.y - GROUND_HEIGHT - height;
+    }
+    if (!body->jumping && !body->crouching && !wasJumpHeld && jumpHeld) {
+        body->jumping = true;
+        body->charging = true;
+        body->chargeTime = 0.0f;
+        body->velocity = JUMP_FORCE;
+    }
+    if (wasJumpHeld && !jumpHeld) body->charging = false;
+    body->prevInput = input;
+    if (body->crouching && body->jumping) body->velocity = FAST_FALL_VELOCITY;
+
+    if (body->jumping) {
+        IntegrateJump(&body->y, &body->velocity, &body->chargeTime, body->charging, SIM_DT);
+        float groundLevel = BASE_RESOLUTION.y - GROUND_HEIGHT -
+            (body->crouching ? game->crouchFrameHeight : game->runFrameHeight);
+        if (body->y >= groundLevel) {
+            body->y = groundLevel;
+            body->jumping = false;
+            body->velocity = 0.0f;
+        }
+    }
+}
+
+// Moves a threat one tick the way UpdateObstacles()/UpdateMeteors() would
+static void StepThreat(AutopilotThreat* threat) {
+    if (threat->projectile) {
+        threat->x += threat->speedX * SIM_DT;
+        threat->y += threat->speedY * SIM_DT;
+        if (threat->y >= threat->landY) threat->spent = true;
+        return;
+    }
+    if (threat->falling) {
+        threat->x -= METEOR_FALL_SPEED_X * SIM_DT;
+        threat->y += METEOR_FALL_SPEED_Y * SIM_DT;
+        if (threat->y >= threat->landY) {
+            threat->falling = false;
+            threat->y = threat->landY;
+            threat->impactTicks = 0;
+        }
+        return;
+    }
+    threat->x -= GetTuning()->obstacleSpeed * SIM_DT;
+    threat->impactTicks++;
+}
+
+static Rectangle ThreatHitbox(const AutopilotThreat* threat) {
+    int frame = 0;
+    if (threat->meteor) {
+        frame = threat->impactTicks / METEOR_FRAME_TICKS;
+        if (frame >= METEOR_IMPACT_FRAMES) frame = METEOR_IMPACT_FRAMES - 1;
+    }
+    const Rectangle* box = &threat->bounds[frame];
+    return (Rectangle){ floorf(threat->x) + box->x, floorf(threat->y) + box->y, box->width, box->height };
+}
+
+// Entry time of a straight-line path into `box`, or -1 if it misses
+// within `horizon` seconds
+static float PathEntryTime(Vector2 position, Vector2 velocity, Rectangle box, float horizon) {
+    float enter = 0.0f;
+    float leave = horizon;
+    const float start[2] = { position.x, position.y };
+    const float speed[2] = { velocity.x, velocity.y };
+    const float low[2] = { box.x, box.y };
+    const float high[2] = { box.x + box.width, box.y + box.height };
+    for (int axis = 0; axis < 2; axis++) {
+        if (speed[axis] == 0.0f) {
+            if (start[axis] < low[axis] || start[axis] > high[axis]) return -1.0f;
+            continue;
+        }
+        float t0 = (low[axis] - start[axis]) / speed[axis];
+        float t1 = (high[axis] - start[axis]) / speed[axis];
+        if (t0 > t1) {
+            float tmp = t0;
+            t0 = t1;
+            t1 = tmp;
+        }
+        if (t0 > enter) enter = t0;
+        if (t1 < leave) leave = t1;
+        if (enter > leave) return -1.0f;
+    }
+    return enter;
+}
+
+// The boss can have thousands of projectiles up; only the ones that cross
+// the column the dino can occupy within the horizon matter, and of those
+// the earliest AUTOPILOT_MAX_PROJECTILES.
+static int CollectProjectileThreats(const GameState* game, AutopilotThreat* threats, int count) {
+    const ProjectilePool* pool = &game->projectiles;
+    if (!game->bossActive || pool->count == 0) return count;
+    const float horizon = AUTOPILOT_HORIZON_TICKS * SIM_DT;
+    const float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
+    const float reach = 900.0f * horizon;
+    const float apex = 260.0f;
+    Rectangle column = {
+        game->players[0].rect.x - PROJECTILE_RADIUS, groundY - apex - PROJECTILE_RADIUS,
+        game->crouchFrames[0].width + 2 * PROJECTILE_RADIUS, apex + PROJECTILE_RADIUS
+    };
+    Rectangle area = { column.x, column.y - reach, column.width + reach, column.height + reach };
+    uint16_t candidates[MAX_PROJECTILES];
+    int found = QueryProjectiles(pool, area, candidates, MAX_PROJECTILES);
+
+    int first = count;
+    float entries[AUTOPILOT_MAX_PROJECTILES];
+    int kept = 0;
+    const Rectangle bounds = GetProjectileMask()->bounds;
+    for (int c = 0; c < found; c++) {
+        int i = candidates[c];
+        Vector2 position = { pool->x[i], pool->y[i] };
+        float entry = PathEntryTime(position, (Vector2){ pool->vx[i], pool->vy[i] }, column, horizon);
+        if (entry < 0.0f) continue;
+        int slot = kept;
+        if (kept == AUTOPILOT_MAX_PROJECTILES) {
+            slot = 0;
+            for (int k = 1; k < kept; k++) if (entries[k] > entries[slot]) slot = k;
+            if (entries[slot] <= entry) continue;
+        } else {
+            kept++;
+        }
+        entries[slot] = entry;
+        AutopilotThreat* threat = &threats[first + slot];
+        *threat = (AutopilotThreat){
+            .x = position.x - PROJECTILE_RADIUS,
+            .y = position.y - PROJECTILE_RADIUS,
+            .speedX = pool->vx[i],
+            .speedY = pool->vy[i],
+            .landY = groundY - 2 * PROJECTILE_RADIUS,
+            .projectile = true
+        };
+        threat->bounds[0] = bounds;
+    }
+    return first + kept;
+}
+
+static int CollectThreats(const GameState* game, AutopilotThreat* threats) {
+    const Rectangle* player = &game->players[0].rect;
+    const float reach = player->x + player->width;
+    const float travel = GetTuning()->obstacleSpeed * SIM_DT * AUTOPILOT_HORIZON_TICKS;
+    const float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
+    int count = 0;
+    for (int i = 0; i < MAX_OBSTACLES; i++) {
+        const Obstacle* obs = &game->obstacles.obstacles[i];
+        if (!obs->active) continue;
+        const Rectangle* box = &obs->collisionRect;
+        if (box->x + box->width < player->x || box->x - travel > reach) continue;
+        AutopilotThreat* threat = &threats[count++];
+        *threat = (AutopilotThreat){ .x = obs->rect.x, .y = obs->rect.y };
+        threat->bounds[0] = (Rectangle){
+            box->x - floorf(obs->rect.x), box->y - floorf(obs->rect.y), box->width, box->height
+        };
+    }
+    count = CollectProjectileThreats(game, threats, count);
+    if (!game->bossActive || game->bossHP <= 1) return count;
+    for (int i = 0; i < MAX_METEORS; i++) {
+        const Meteor* meteor = &game->meteors[i];
+        if (!meteor->active || meteor->state == METEOR_STATE_INACTIVE) continue;
+        if (meteor->state == METEOR_STATE_IMPACT &&
+            (meteor->collisionRect.x + meteor->collisionRect.width < player->x ||
+             meteor->collisionRect.x - travel > reach)) continue;
+        AutopilotThreat* threat = &threats[count++];
+        *threat = (AutopilotThreat){
+            .x = meteor->position.x,
+            .y = meteor->position.y,
+            .landY = groundY - meteor->rect.height,
+            .falling = meteor->state == METEOR_STATE_FALLING,
+            .meteor = true
+        };
+        if (!threat->falling) {
+            const Animator* animator = &game->animators[ANIMATOR_METEORS + i];
+            threat->impactTicks = animator->frame * METEOR_FRAME_TICKS + (int)(animator->time * SIM_TICK_RATE);
+        }
+        for (int frame = 0; frame < METEOR_IMPACT_FRAMES; frame++) {
+            threat->bounds[frame] = GetMeteorImpactMask(frame, (int)meteor->rect.width)->bounds;
+        }
+    }
+    return count;
+}
+
+// Where threats can hit at each tick of the horizon. Threats move the
+// same whatever the dino does, so this is worked out once per decision
+// and every plan is only tested against the boxes. Each tick keeps only
+// the boxes over the dino's column, and none for a threat that can't hit
+// (a falling meteor, a landed projectile).
+typedef struct {
+    Rectangle boxes[AUTOPILOT_HORIZON_TICKS][AUTOPILOT_MAX_THREATS];
+    uint8_t ids[AUTOPILOT_HORIZON_TICKS][AUTOPILOT_MAX_THREATS];
+    int counts[AUTOPILOT_HORIZON_TICKS];
+    bool projectile[AUTOPILOT_MAX_THREATS];
+} ThreatTrack;
+
+_Static_assert(AUTOPILOT_MAX_THREATS <= 64, "a plan marks the projectiles it took in one 64-bit mask");
+
+static void TrackThreats(const GameState* game, AutopilotThreat* threats, int count, ThreatTrack* track) {
+    const float left = game->players[0].rect.x;
+    const float right = left + fmaxf(game->runFrames[0].width, game->crouchFrames[0].width);
+    for (int i = 0; i < count; i++) track->projectile[i] = threats[i].projectile;
+    for (int tick = 0; tick < AUTOPILOT_HORIZON_TICKS; tick++) {
+        int kept = 0;
+        for (int i = 0; i < count; i++) {
+            AutopilotThreat* threat = &threats[i];
+            bool wasFalling = threat->falling;
+            StepThreat(threat);
+            if (wasFalling || threat->falling || threat->spent) continue;
+            Rectangle box = ThreatHitbox(threat);
+            if (box.x >= right || box.x + box.width <= left) continue;
+            track->boxes[tick][kept] = box;
+            track->ids[tick][kept++] = (uint8_t)i;
+        }
+        track->counts[tick] = kept;
+    }
+}
+
+// Returns the tick of the first lethal hit (or the horizon) and counts the
+// projectile hits taken on the way; projectiles only turn lethal once
+// they would use up the dino's remaining HP.
+static int SimulatePlan(const GameState* game, const AutopilotPlan* plan, const ThreatTrack* track,
+                        int* projectileHits) {
+    *projectileHits = 0;
+    const Player* player = &game->players[0];
+    AutopilotBody body = {
+        .y = player->basePosition.y,
+        .velocity = player->baseJumpVelocity,
+        .chargeTime = player->jumpChargeTime,
+        .jumping = player->isJumping,
+        .crouching = player->isCrouching,
+        .charging = player->isJumpCharging,
+        .prevInput = player->prevInput
+    };
+    uint64_t taken = 0;
+
+    const float left = player->rect.x;
+    for (int tick = 0; tick < AUTOPILOT_HORIZON_TICKS; tick++) {
+        bool holding = tick >= plan->wait && tick < plan->wait + plan->hold;
+        StepBody(&body, game, holding ? plan->input : INPUT_NONE);
+        const Rectangle* frame = body.crouching ? &game->crouchFrames[0] : &game->runFrames[0];
+        const float right = left + frame->width;
+        const float top = body.y;
+        const float bottom = body.y + frame->height;
+        for (int k = 0; k < track->counts[tick]; k++) {
+            const Rectangle* box = &track->boxes[tick][k];
+            int id = track->ids[tick][k];
+            if (taken & (1ull << id)) continue;
+            if (left < box->x + box->width && right > box->x &&
+                top < box->y + box->height && bottom > box->y) {
+                if (!track->projectile[id]) return tick;
+                taken |= 1ull << id;
+                (*projectileHits)++;
+                if (*projectileHits * PROJECTILE_DAMAGE >= game->hp) return tick;
+            }
+        }
+    }
+    return AUTOPILOT_HORIZON_TICKS;
+}
+
+// The remembered plan one tick on, or false if there is none to follow
+static bool FollowMemory(const GameState* game, const AutopilotMemory* memory, AutopilotPlan* plan) {
+    if (!memory || !memory->valid || memory->runSeed != game->runSeed || memory->tick + 1 != game->tick) {
+        return false;
+    }
+    *plan = (AutopilotPlan){ memory->wait, memory->input, memory->hold };
+    if (plan->wait > 0) {
+        plan->wait--;
+    } else if (plan->hold > 0) {
+        plan->hold--;
+    }
+    return true;
+}
+
+static PlayerInput Remember(const GameState* game, AutopilotMemory* memory, const AutopilotPlan* plan) {
+    if (memory) {
+        *memory = (AutopilotMemory){
+            .valid = true, .runSeed = game->runSeed, .tick = game->tick,
+            .wait = plan->wait, .input = plan->input, .hold = plan->hold
+        };
+    }
+    return plan->wait == 0 && plan->hold > 0 ? plan->input : INPUT_NONE;
+}
+
+// Keeps following the last plan while it survives without a hit.
+// Otherwise prefers doing nothing, then the latest action that still
+// survives the horizon (so jumps happen as late as possible), taking as
+// few projectile hits as it can; when nothing survives, whatever keeps
+// the dino alive the longest. At most AUTOPILOT_MAX_WAITS start ticks are
+// tried, spread out between the latest one and now.
+PlayerInput ChooseAutopilotInput(const GameState* game, AutopilotMemory* memory) {
+    AutopilotThreat threats[AUTOPILOT_MAX_THREATS];
+    int threatCount = CollectThreats(game, threats);
+    const AutopilotPlan idle = { 0, INPUT_NONE, 0 };
+    if (threatCount == 0) return Remember(game, memory, &idle);
+    ThreatTrack track;
+    TrackThreats(game, threats, threatCount, &track);
+
+    int hits;
+    AutopilotPlan followed;
+    if (FollowMemory(game, memory, &followed) &&
+        SimulatePlan(game, &followed, &track, &hits) == AUTOPILOT_HORIZON_TICKS && hits == 0) {
+        return Remember(game, memory, &followed);
+    }
+
+    int hitTick = SimulatePlan(game, &idle, &track, &hits);
+    if (hitTick == AUTOPILOT_HORIZON_TICKS && hits == 0) return Remember(game, memory, &idle);
+
+    AutopilotPlan best = idle;
+    int bestSurvival = hitTick;
+    int bestHits = hitTick == AUTOPILOT_HORIZON_TICKS ? hits : MAX_PROJECTILES;
+    int wait = hitTick > 0 ? hitTick - 1 : 0;
+    int step = (wait + AUTOPILOT_MAX_WAITS - 2) / (AUTOPILOT_MAX_WAITS - 1);
+    if (step < AUTOPILOT_WAIT_STEP) step = AUTOPILOT_WAIT_STEP;
+    for (;;) {
+        for (int a = 0; a < AUTOPILOT_ACTION_COUNT; a++) {
+            AutopilotPlan plan = AUTOPILOT_ACTIONS[a];
+            plan.wait = wait;
+            int survival = SimulatePlan(game, &plan, &track, &hits);
+            if (survival == AUTOPILOT_HORIZON_TICKS) {
+                if (hits == 0) return Remember(game, memory, &plan);
+                if (bestSurvival < AUTOPILOT_HORIZON_TICKS || hits < bestHits) {
+                    bestSurvival = survival;
+                    bestHits = hits;
+                    best = plan;
+                }
+            } else if (survival > bestSurvival) {
+                bestSurvival = survival;
+                best = plan;
+            }
+        }
+        if (wait == 0) break;
+        wait = wait > step ? wait - step : 0;
+    }
+    return Remember(game, memory, &best);
+}
@@ -0,0 +1,25 @@
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+#include "types.h"
+
+#define AUTOPILOT_HORIZON_TICKS 48
+#define AUTOPILOT_MAX_PROJECTILES 16
+#define AUTOPILOT_MAX_WAITS 6 // start ticks tried per action when re-planning
+#define AUTOPILOT_MAX_THREATS (MAX_OBSTACLES + MAX_METEORS + AUTOPILOT_MAX_PROJECTILES)
+
+// The plan the autopilot is following, so the next tick can carry on with
+// it instead of searching again. It is only trusted on the tick straight
+// after the one it was made on, so a reset or rollback drops it by itself.
+typedef struct {
+    bool valid;
+    uint64_t runSeed;
+    uint32_t tick;
+    int wait;
+    PlayerInput input;
+    int hold;
+} AutopilotMemory;
+
+// `memory` may be NULL to search from scratch every tick
+PlayerInput ChooseAutopilotInput(const GameState* game, AutopilotMemory* memory);
+
+#endif
@@ -0,0 +1,265 @@
+#include "boss.h"
+#include "game.h"
+#include "collision.h"
+#include "rng.h"
+#include "telemetry.h"
+#include <math.h>
+#include <string.h>
+
+// Story-mode boss: a script of projectile patterns that gets denser as
+// the boss loses HP. Projectiles are gameplay state (seeded RNG, fixed
+// tick), and every tick they are bucketed into a uniform grid so the
+// ground and player checks only look at the cells they touch.
+
+#define BOSS_PHASES 3
+#define MAX_PHASE_STEPS 3
+#define RAIN_MIN_X 700.0f
+#define RAIN_MAX_X 1700.0f
+#define RAIN_DRIFT 0.3f
+#define VOLLEY_HIGH_LANE 78.0f
+#define VOLLEY_LOW_LANE 16.0f
+#define MAX_PLAYER_CANDIDATES 256
+#define MAX_GROUND_CANDIDATES MAX_PROJECTILES
+
+// Steps with count == 0 end the phase early
+static const BossPattern BOSS_SCRIPT[BOSS_PHASES][MAX_PHASE_STEPS] = {
+    {
+        { BOSS_PATTERN_RAIN,   4.0f, 0.05f,  6,  480.0f, 300.0f, 260.0f },
+        { BOSS_PATTERN_VOLLEY, 3.0f, 1.2f,   5,  650.0f, 26.0f,  0.0f },
+    },
+    {
+        { BOSS_PATTERN_SPIRAL, 4.0f, 0.05f,  8,  300.0f, 0.0f,   140.0f },
+        { BOSS_PATTERN_VOLLEY, 3.0f, 0.9f,   7,  750.0f, 26.0f,  0.0f },
+        { BOSS_PATTERN_RAIN,   4.0f, 0.033f, 12, 520.0f, 420.0f, 320.0f },
+    },
+    {
+        { BOSS_PATTERN_SPIRAL, 3.0f, 0.033f, 16, 320.0f, 0.0f,   200.0f },
+        { BOSS_PATTERN_RAIN,   3.0f, 0.02f,  28, 560.0f, 600.0f, 380.0f },
+        { BOSS_PATTERN_VOLLEY, 3.0f, 0.7f,   8,  800.0f, 24.0f,  0.0f },
+    },
+};
+
+static int BossPhase(int bossHP) {
+    if (bossHP >= 8) return 0;
+    if (bossHP >= 4) return 1;
+    return 2;
+}
+
+void InitBoss(GameState* game) {
+    game->boss = (BossState){
+        .phase = 0,
+        .sweepX = RAIN_MAX_X,
+        .sweepDirection = -1.0f
+    };
+    game->projectiles.count = 0;
+    game->projectiles.candidatesTested = 0;
+    memset(game->projectiles.cellStart, 0, sizeof(game->projectiles.cellStart));
+}
+
+static void SpawnProjectile(ProjectilePool* pool, float x, float y, float vx, float vy) {
+    if (pool->count >= MAX_PROJECTILES) return;
+    int i = pool->count++;
+    pool->x[i] = x;
+    pool->y[i] = y;
+    pool->vx[i] = vx;
+    pool->vy[i] = vy;
+    pool->alive[i] = true;
+}
+
+static void FirePattern(GameState* game, const BossPattern* pattern) {
+    ProjectilePool* pool = &game->projectiles;
+    BossState* boss = &game->boss;
+    const float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
+    switch (pattern->type) {
+        case BOSS_PATTERN_VOLLEY: {
+            // Head height has to be crouched under, foot height jumped
+            bool high = NextRandomValue(&game->rngState, 0, 1) == 1;
+            float y = groundY - (high ? VOLLEY_HIGH_LANE : VOLLEY_LOW_LANE);
+            for (int k = 0; k < pattern->count; k++) {
+                SpawnProjectile(pool, BASE_RESOLUTION.x + PROJECTILE_RADIUS + k * pattern->spread, y,
+                                -pattern->speed, 0.0f);
+            }
+            break;
+        }
+        case BOSS_PATTERN_SPIRAL: {
+            for (int arm = 0; arm < pattern->count; arm++) {
+                float angle = (boss->angle + arm * 360.0f / pattern->count) * DEG2RAD;
+                SpawnProjectile(pool, BOSS_ORIGIN_X, BOSS_ORIGIN_Y,
+                                cosf(angle) * pattern->speed, sinf(angle) * pattern->speed);
+            }
+            boss->angle = fmodf(boss->angle + pattern->spin * pattern->interval, 360.0f);
+            break;
+        }
+        case BOSS_PATTERN_RAIN: {
+            for (int k = 0; k < pattern->count; k++) {
+                float x = boss->sweepX + (NextRandomFloat(&game->rngState) - 0.5f) * pattern->spread;
+                float y = -2.0f * PROJECTILE_RADIUS - NextRandomFloat(&game->rngState) * 40.0f;
+                SpawnProjectile(pool, x, y, -pattern->speed * RAIN_DRIFT, pattern->speed);
+            }
+            boss->sweepX += boss->sweepDirection * pattern->spin * pattern->interval;
+            if (boss->sweepX < RAIN_MIN_X || boss->sweepX > RAIN_MAX_X) {
+                boss->sweepDirection = -boss->sweepDirection;
+                boss->sweepX = fminf(RAIN_MAX_X, fmaxf(RAIN_MIN_X, boss->sweepX));
+            }
+            break;
+        }
+    }
+}
+
+static void RunScript(GameState* game, float deltaTime) {
+    BossState* boss = &game->boss;
+    int phase = BossPhase(game->bossHP);
+    if (phase != boss->phase) {
+        boss->phase = phase;
+        boss->step = 0;
+        boss->stepTimer = 0.0f;
+        boss->fireTimer = 0.0f;
+    }
+    const BossPattern* pattern = &BOSS_SCRIPT[boss->phase][boss->step];
+    boss->fireTimer += deltaTime;
+    while (boss->fireTimer >= pattern->interval) {
+        boss->fireTimer -= pattern->interval;
+        FirePattern(game, pattern);
+    }
+    boss->stepTimer += deltaTime;
+    if (boss->stepTimer >= pattern->duration) {
+        boss->stepTimer = 0.0f;
+        boss->fireTimer = 0.0f;
+        boss->step++;
+        if (boss->step >= MAX_PHASE_STEPS || BOSS_SCRIPT[boss->phase][boss->step].count == 0) boss->step = 0;
+    }
+}
+
+static bool InsideGrid(float x, float y) {
+    return x >= GRID_ORIGIN_X && x < GRID_ORIGIN_X + GRID_COLUMNS * GRID_CELL_SIZE &&
+           y >= GRID_ORIGIN_Y && y < GRID_ORIGIN_Y + GRID_ROWS * GRID_CELL_SIZE;
+}
+
+static int GridColumn(float x) {
+    int column = (int)((x - GRID_ORIGIN_X) / GRID_CELL_SIZE);
+    return column < 0 ? 0 : (column >= GRID_COLUMNS ? GRID_COLUMNS - 1 : column);
+}
+
+static int GridRow(float y) {
+    int row = (int)((y - GRID_ORIGIN_Y) / GRID_CELL_SIZE);
+    return row < 0 ? 0 : (row >= GRID_ROWS ? GRID_ROWS - 1 : row);
+}
+
+// Moves everything, drops what was spent last tick or left the grid, and
+// keeps the survivors packed. Swap-removal keeps the order deterministic.
+static void MoveProjectiles(ProjectilePool* pool, float deltaTime) {
+    int count = pool->count;
+    for (int i = 0; i < count;) {
+        if (pool->alive[i]) {
+            pool->x[i] += pool->vx[i] * deltaTime;
+            pool->y[i] += pool->vy[i] * deltaTime;
+            if (InsideGrid(pool->x[i], pool->y[i])) {
+                i++;
+                continue;
+            }
+        }
+        count--;
+        pool->x[i] = pool->x[count];
+        pool->y[i] = pool->y[count];
+        pool->vx[i] = pool->vx[count];
+        pool->vy[i] = pool->vy[count];
+        pool->alive[i] = pool->alive[count];
+    }
+    pool->count = count;
+}
+
+// Counting sort by cell: one pass to count, a prefix sum, one pass to fill
+static void BuildProjectileGrid(ProjectilePool* pool) {
+    uint16_t cells[MAX_PROJECTILES];
+    uint16_t cursor[GRID_CELLS];
+    memset(pool->cellStart, 0, sizeof(pool->cellStart));
+    for (int i = 0; i < pool->count; i++) {
+        cells[i] = GridRow(pool->y[i]) * GRID_COLUMNS + GridColumn(pool->x[i]);
+        pool->cellStart[cells[i] + 1]++;
+    }
+    for (int c = 0; c < GRID_CELLS; c++) {
+        pool->cellStart[c + 1] += pool->cellStart[c];
+        cursor[c] = pool->cellStart[c];
+    }
+    for (int i = 0; i < pool->count; i++) {
+        pool->cellEntries[cursor[cells[i]]++] = i;
+    }
+}
+
+// Live projectiles whose centre is in a cell touching `area` grown by the
+// projectile radius; callers do the exact test.
+int QueryProjectiles(const ProjectilePool* pool, Rectangle area, uint16_t* out, int capacity) {
+    int column0 = GridColumn(area.x - PROJECTILE_RADIUS);
+    int column1 = GridColumn(area.x + area.width + PROJECTILE_RADIUS);
+    int row0 = GridRow(area.y - PROJECTILE_RADIUS);
+    int row1 = GridRow(area.y + area.height + PROJECTILE_RADIUS);
+    int found = 0;
+    for (int row = row0; row <= row1; row++) {
+        for (int column = column0; column <= column1; column++) {
+            int cell = row * GRID_COLUMNS + column;
+            for (int e = pool->cellStart[cell]; e < pool->cellStart[cell + 1]; e++) {
+                int i = pool->cellEntries[e];
+                if (!pool->alive[i]) continue;
+                if (found == capacity) return found;
+                out[found++] = i;
+            }
+        }
+    }
+    return found;
+}
+
+static void CheckGroundHits(GameState* game) {
+    ProjectilePool* pool = &game->projectiles;
+    const float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
+    uint16_t candidates[MAX_GROUND_CANDIDATES];
+    Rectangle ground = { GRID_ORIGIN_X, groundY, GRID_COLUMNS * GRID_CELL_SIZE, 0 };
+    int found = QueryProjectiles(pool, ground, candidates, MAX_GROUND_CANDIDATES);
+    pool->candidatesTested += found;
+    for (int c = 0; c < found; c++) {
+        int i = candidates[c];
+        if (pool->y[i] + PROJECTILE_RADIUS < groundY) continue;
+        pool->alive[i] = false;
+        // Leave room in the tick's effect list for the player's own events
+        if (game->effectCount < MAX_EFFECT_EVENTS / 2) {
+            PushEffect(game, EFFECT_PROJECTILE_SPLASH, (Vector2){ pool->x[i], groundY }, 0.0f);
+        }
+    }
+}
+
+static void CheckPlayerHits(GameState* game) {
+    ProjectilePool* pool = &game->projectiles;
+    // The boss fight is single-player
+    const Player* player = &game->players[0];
+    const CollisionMask* playerMask = GetSpriteMask(GetPlayerSprite(game, 0));
+    const CollisionMask* projectileMask = GetProjectileMask();
+    uint16_t candidates[MAX_PLAYER_CANDIDATES];
+    int found = QueryProjectiles(pool, player->rect, candidates, MAX_PLAYER_CANDIDATES);
+    pool->candidatesTested += found;
+    for (int c = 0; c < found; c++) {
+        int i = candidates[c];
+        Vector2 center = { pool->x[i], pool->y[i] };
+        if (!CheckCollisionCircleRec(center, PROJECTILE_RADIUS, player->rect)) continue;
+        Vector2 corner = { center.x - PROJECTILE_RADIUS, center.y - PROJECTILE_RADIUS };
+        if (!CheckMaskCollision(playerMask, player->basePosition, projectileMask, corner)) continue;
+        pool->alive[i] = false;
+        PushEffect(game, EFFECT_PROJECTILE_HIT, center, 0.0f);
+        game->hp -= PROJECTILE_DAMAGE;
+        if (game->hp <= 0) game->hp = 0;
+        RecordTelemetry(game->telemetry, game->tick, TELEMETRY_PLAYER_HIT, 0, game->hp);
+        if (game->hp == 0) {
+            game->gameOver = true;
+            RecordTelemetry(game->telemetry, game->tick, TELEMETRY_DEATH, DEATH_PROJECTILE, -1);
+            return;
+        }
+    }
+}
+
+void UpdateBoss(GameState* game, float deltaTime) {
+    if (game->gameOver || game->gameWon) return;
+    RunScript(game, deltaTime);
+    MoveProjectiles(&game->projectiles, deltaTime);
+    BuildProjectileGrid(&game->projectiles);
+    game->projectiles.candidatesTested = 0;
+    CheckGroundHits(game);
+    CheckPlayerHits(game);
+}
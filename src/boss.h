@@ -0,0 +1,11 @@
+#ifndef BOSS_H
+#define BOSS_H
+#include "raylib.h"
+#include "types.h"
+#include <stdint.h>
+
+void InitBoss(GameState* game);
+void UpdateBoss(GameState* game, float deltaTime);
+int QueryProjectiles(const ProjectilePool* pool, Rectangle area, uint16_t* out, int capacity);
+
+#endif
@@ -0,0 +1,276 @@
+#include "broadcast.h"
+#include "atlas.h"
+#include "game.h"
+#include "livestate.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#define ACCEPT_POLL_SECONDS 0.1 // how soon a spectator is let in while the sim is idle
+#define LISTEN_BACKLOG 16
+
+_Static_assert(MAX_PLAYERS <= SPECTATOR_PLAYER_IDS, "spectator ids cover every player");
+_Static_assert(MAX_OBSTACLES <= SPECTATOR_OBSTACLE_IDS, "spectator ids cover the obstacle pool");
+_Static_assert(MAX_METEORS <= SPECTATOR_METEOR_IDS, "spectator ids cover the meteor pool");
+_Static_assert(SPRITE_COUNT <= SPECTATOR_FADED, "sprite ids leave the faded bit free");
+
+static long long Nanoseconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int16_t Quantize(float value) {
+    float steps = roundf(value / SPECTATOR_QUANTUM);
+    if (steps > INT16_MAX) return INT16_MAX;
+    if (steps < INT16_MIN) return INT16_MIN;
+    return (int16_t)steps;
+}
+
+static SpectatorEntity ToSpectatorEntity(Rectangle rect, int sprite) {
+    return (SpectatorEntity){ (uint8_t)sprite, Quantize(rect.x), Quantize(rect.y),
+                              (uint16_t)Quantize(rect.width), (uint16_t)Quantize(rect.height) };
+}
+
+// Called by the sim thread after every tick. Quantizing here keeps the
+// copy under the lock small; a tick the worker hasn't taken yet is
+// replaced, since spectators only need the newest.
+void SubmitBroadcastFrame(BroadcastServer* server, const GameState* game) {
+    if (!server) return;
+    SpectatorFrame frame = {
+        .tick = game->tick,
+        .score = game->score,
+        .hp = (int16_t)game->hp,
+        .bossHP = (int16_t)game->bossHP,
+        .projectiles = (uint16_t)game->projectiles.count
+    };
+    // In LiveFlags order
+    bool flags[] = { game->gameOver, game->gameWon, game->isStoryMode, game->bossActive,
+                     game->players[0].isJumping, game->players[0].isCrouching, game->nightModeActive, game->pauseMenu.isPaused };
+    for (int i = 0; i < (int)(sizeof(flags) / sizeof(flags[0])); i++) {
+        if (flags[i]) frame.flags |= 1u << i;
+    }
+    // Players go out as the sprite's whole frame, the way draw.c places them
+    for (int i = 0; i < game->playerCount; i++) {
+        const Player* dino = &game->players[i];
+        SpriteId sprite = GetPlayerSprite(game, i);
+        Rectangle rect = { dino->basePosition.x, dino->basePosition.y,
+                           ATLAS_SPRITES[sprite].frame.x, ATLAS_SPRITES[sprite].frame.y };
+        bool faded = !dino->alive && !game->gameOver;
+        frame.entities[i] = ToSpectatorEntity(rect, sprite | (faded ? SPECTATOR_FADED : 0));
+        frame.present |= 1u << i;
+    }
+    for (int i = 0; i < MAX_OBSTACLES; i++) {
+        const Obstacle* obs = &game->obstacles.obstacles[i];
+        if (!obs->active) continue;
+        frame.entities[SPECTATOR_FIRST_OBSTACLE + i] = ToSpectatorEntity(obs->rect, GetObstacleSprite(game, i));
+        frame.present |= 1u << (SPECTATOR_FIRST_OBSTACLE + i);
+    }
+    for (int i = 0; i < MAX_METEORS; i++) {
+        const Meteor* meteor = &game->meteors[i];
+        if (!meteor->active || meteor->state == METEOR_STATE_INACTIVE) continue;
+        frame.entities[SPECTATOR_FIRST_METEOR + i] = ToSpectatorEntity(meteor->rect, GetMeteorSprite(game, i));
+        frame.present |= 1u << (SPECTATOR_FIRST_METEOR + i);
+    }
+
+    pthread_mutex_lock(&server->lock);
+    if (server->fresh) atomic_fetch_add(&server->skipped, 1);
+    server->pending = frame;
+    server->fresh = true;
+    pthread_cond_signal(&server->wake);
+    pthread_mutex_unlock(&server->lock);
+}
+
+static void DropClient(BroadcastServer* server, int index) {
+    SpectatorClient* client = &server->clients[index];
+    close(client->socket);
+    free(client->backlog);
+    server->clients[index] = server->clients[--server->clientCount];
+    atomic_store(&server->spectators, server->clientCount);
+}
+
+static void AcceptSpectators(BroadcastServer* server) {
+    for (;;) {
+        int fd = accept(server->listener, NULL, NULL);
+        if (fd < 0) return;
+        uint8_t* backlog = server->clientCount < BROADCAST_MAX_CLIENTS ? malloc(BROADCAST_BACKLOG_BYTES) : NULL;
+        if (!backlog) {
+            close(fd);
+            continue;
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        // Messages are small and due now; don't let Nagle hold them back
+        int on = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        server->clients[server->clientCount++] = (SpectatorClient){ fd, true, 0, backlog };
+        atomic_store(&server->spectators, server->clientCount);
+    }
+}
+
+// Returns the bytes the socket took, or -1 when the spectator is gone
+static int SendSome(int socket, const uint8_t* data, int length) {
+    ssize_t sent = send(socket, data, length, MSG_NOSIGNAL | MSG_DONTWAIT);
+    if (sent >= 0) return (int)sent;
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR ? 0 : -1;
+}
+
+// Queues behind whatever is still waiting so the stream stays in order.
+// False when the spectator disconnected or fell too far behind.
+static bool SendToClient(BroadcastServer* server, SpectatorClient* client, const uint8_t* data, int length) {
+    if (client->backlogLength > 0) {
+        int sent = SendSome(client->socket, client->backlog, client->backlogLength);
+        if (sent < 0) return false;
+        memmove(client->backlog, client->backlog + sent, client->backlogLength - sent);
+        client->backlogLength -= sent;
+        atomic_fetch_add(&server->bytesSent, sent);
+    }
+    int sent = 0;
+    if (client->backlogLength == 0 && length > 0) {
+        sent = SendSome(client->socket, data, length);
+        if (sent < 0) return false;
+        atomic_fetch_add(&server->bytesSent, sent);
+    }
+    int rest = length - sent;
+    if (client->backlogLength + rest > BROADCAST_BACKLOG_BYTES) {
+        atomic_fetch_add(&server->dropped, 1);
+        return false;
+    }
+    memcpy(client->backlog + client->backlogLength, data + sent, rest);
+    client->backlogLength += rest;
+    return true;
+}
+
+static void BroadcastFrame(BroadcastServer* server, const SpectatorFrame* frame) {
+    bool newcomers = false;
+    for (int i = 0; i < server->clientCount; i++) newcomers |= server->clients[i].needsKey;
+
+    long long start = Nanoseconds();
+    uint8_t delta[SPECTATOR_MAX_MESSAGE];
+    uint8_t key[SPECTATOR_MAX_MESSAGE];
+    int deltaLength = server->hasSent ? EncodeSpectatorDelta(&server->sent, frame, delta) : 0;
+    int keyLength = newcomers ? EncodeSpectatorKey(frame, key) : 0;
+    long long encoded = Nanoseconds();
+    bool changed = !server->hasSent || frame->tick != server->sent.tick || deltaLength > SPECTATOR_EMPTY_DELTA;
+    if (changed) {
+        server->sent = *frame;
+        server->hasSent = true;
+    } else {
+        deltaLength = 0;
+    }
+
+    // Nothing new still gives stalled sockets a chance to drain
+    for (int i = server->clientCount - 1; i >= 0; i--) {
+        SpectatorClient* client = &server->clients[i];
+        bool ok = client->needsKey ? SendToClient(server, client, key, keyLength)
+                                   : SendToClient(server, client, delta, deltaLength);
+        client->needsKey = false;
+        if (!ok) DropClient(server, i);
+    }
+    if (!changed) return;
+    atomic_fetch_add(&server->frames, 1);
+    atomic_fetch_add(&server->encodeNanoseconds, encoded - start);
+    atomic_fetch_add(&server->sendNanoseconds, Nanoseconds() - encoded);
+}
+
+static void* BroadcastWorker(void* arg) {
+    BroadcastServer* server = arg;
+    SpectatorFrame frame;
+    for (;;) {
+        pthread_mutex_lock(&server->lock);
+        if (!server->stopping && !server->fresh) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_nsec += (long)(ACCEPT_POLL_SECONDS * 1e9);
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&server->wake, &server->lock, &deadline);
+        }
+        bool fresh = server->fresh;
+        if (fresh) frame = server->pending;
+        server->fresh = false;
+        bool stopping = server->stopping;
+        pthread_mutex_unlock(&server->lock);
+        if (stopping) break;
+
+        AcceptSpectators(server);
+        // While the sim is idle the last frame is resent, which only
+        // reaches newcomers and backlogs
+        if (fresh) {
+            BroadcastFrame(server, &frame);
+        } else if (server->hasSent) {
+            frame = server->sent;
+            BroadcastFrame(server, &frame);
+        }
+    }
+    return NULL;
+}
+
+static int OpenListener(const char* port) {
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM, .ai_flags = AI_PASSIVE };
+    struct addrinfo* addresses = NULL;
+    if (getaddrinfo(NULL, port, &hints, &addresses) != 0) return -1;
+    int fd = -1;
+    for (struct addrinfo* address = addresses; address; address = address->ai_next) {
+        fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) continue;
+        int on = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        if (bind(fd, address->ai_addr, address->ai_addrlen) == 0 && listen(fd, LISTEN_BACKLOG) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(addresses);
+    if (fd >= 0) fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+// `port` is the TCP port to listen on; NULL or empty leaves broadcasting
+// off. NULL too when the port can't be opened.
+BroadcastServer* StartBroadcast(const char* port) {
+    if (!port || !*port) return NULL;
+    BroadcastServer* server = calloc(1, sizeof(BroadcastServer));
+    if (!server) return NULL;
+    server->listener = OpenListener(port);
+    if (server->listener < 0) {
+        free(server);
+        return NULL;
+    }
+    pthread_mutex_init(&server->lock, NULL);
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&server->wake, &attributes);
+    pthread_condattr_destroy(&attributes);
+    if (pthread_create(&server->thread, NULL, BroadcastWorker, server) != 0) {
+        pthread_cond_destroy(&server->wake);
+        pthread_mutex_destroy(&server->lock);
+        close(server->listener);
+        free(server);
+        return NULL;
+    }
+    return server;
+}
+
+void StopBroadcast(BroadcastServer* server) {
+    if (!server) return;
+    pthread_mutex_lock(&server->lock);
+    server->stopping = true;
+    pthread_cond_signal(&server->wake);
+    pthread_mutex_unlock(&server->lock);
+    pthread_join(server->thread, NULL);
+    while (server->clientCount > 0) DropClient(server, server->clientCount - 1);
+    close(server->listener);
+    pthread_cond_destroy(&server->wake);
+    pthread_mutex_destroy(&server->lock);
+    free(server);
+}
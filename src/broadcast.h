@@ -0,0 +1,50 @@
+#ifndef BROADCAST_H
+#define BROADCAST_H
+#include "types.h"
+#include "spectator.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#define BROADCAST_MAX_CLIENTS 64
+#define BROADCAST_BACKLOG_BYTES 32768 // about ten seconds of deltas
+
+typedef struct {
+    int socket;
+    bool needsKey;
+    int backlogLength;
+    uint8_t* backlog; // what the socket wouldn't take yet
+} SpectatorClient;
+
+// Streams every sim tick to any number of spectators over TCP. The sim
+// thread only quantizes the tick into a mailbox under a short lock; the
+// worker encodes one delta per tick and sends those same bytes to every
+// client, so the cost per spectator is a send() and not an encode.
+// Newcomers get a keyframe first, encoded once per tick however many
+// joined. A client that falls a backlog behind is dropped, not waited on.
+typedef struct {
+    int listener;
+    SpectatorClient clients[BROADCAST_MAX_CLIENTS];
+    int clientCount;
+    SpectatorFrame pending;
+    bool fresh;
+    SpectatorFrame sent; // what the last delta brought clients up to
+    bool hasSent;
+    bool stopping;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t thread;
+    atomic_int spectators;
+    atomic_int frames;         // ticks sent
+    atomic_int skipped;        // ticks replaced in the mailbox before the worker took them
+    atomic_int dropped;        // clients cut off for falling behind
+    atomic_llong bytesSent;    // summed over clients
+    atomic_llong encodeNanoseconds;
+    atomic_llong sendNanoseconds;
+} BroadcastServer;
+
+BroadcastServer* StartBroadcast(const char* port);
+void StopBroadcast(BroadcastServer* server);
+void SubmitBroadcastFrame(BroadcastServer* server, const GameState* game);
+
+#endif
@@ -0,0 +1,147 @@
+#include "collision.h"
+#include "atlas.h"
+#include "atlas_mask.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 1-bit masks built once from the atlas's collision bits, which
+// AtlasPacker generates into atlas_mask.h at build time; no file is read
+// at run time, so every process collides the same whatever its working
+// directory. Bit (x & 63) of word (x >> 6) in a row is pixel x; padding
+// bits past the width are always zero, so rows can be ANDed a whole word
+// at a time.
+
+#define METEOR_SIZE_COUNT (METEOR_MAX_SIZE - METEOR_MIN_SIZE + 1)
+
+static CollisionMask spriteMasks[SPRITE_COUNT];
+static CollisionMask meteorImpactMasks[METEOR_IMPACT_FRAMES][METEOR_SIZE_COUNT];
+static CollisionMask projectileMask;
+static pthread_once_t masksOnce = PTHREAD_ONCE_INIT;
+
+static void AllocateMask(CollisionMask* mask, int width, int height) {
+    mask->width = width;
+    mask->height = height;
+    mask->wordsPerRow = (width + 63) / 64;
+    mask->bits = calloc((size_t)mask->wordsPerRow * height, sizeof(uint64_t));
+}
+
+static void SetMaskBit(CollisionMask* mask, int x, int y) {
+    mask->bits[y * mask->wordsPerRow + (x >> 6)] |= 1ULL << (x & 63);
+}
+
+static void ComputeMaskBounds(CollisionMask* mask) {
+    int minX = mask->width, minY = mask->height, maxX = -1, maxY = -1;
+    for (int y = 0; y < mask->height; y++) {
+        for (int x = 0; x < mask->width; x++) {
+            if (!(mask->bits[y * mask->wordsPerRow + (x >> 6)] & (1ULL << (x & 63)))) continue;
+            if (x < minX) minX = x;
+            if (x > maxX) maxX = x;
+            if (y < minY) minY = y;
+            if (y > maxY) maxY = y;
+        }
+    }
+    mask->bounds = maxX < 0 ? (Rectangle){ 0, 0, 0, 0 }
+                            : (Rectangle){ minX, minY, maxX - minX + 1, maxY - minY + 1 };
+}
+
+// Samples the sprite's untrimmed frame stretched to width x height, the same
+// way DrawTexturePro() maps it onto a destination rectangle. Pixels outside
+// the packed rect were trimmed as fully transparent.
+static void BuildMask(CollisionMask* mask, const AtlasSprite* sprite, int width, int height) {
+    AllocateMask(mask, width, height);
+    for (int y = 0; y < height; y++) {
+        int fy = y * (int)sprite->frame.y / height - (int)sprite->offset.y;
+        if (fy < 0 || fy >= (int)sprite->source.height) continue;
+        const uint64_t* row = ATLAS_MASK_BITS[(int)sprite->source.y + fy];
+        for (int x = 0; x < width; x++) {
+            int fx = x * (int)sprite->frame.x / width - (int)sprite->offset.x;
+            if (fx < 0 || fx >= (int)sprite->source.width) continue;
+            int sx = (int)sprite->source.x + fx;
+            if (row[sx >> 6] & (1ULL << (sx & 63))) SetMaskBit(mask, x, y);
+        }
+    }
+    ComputeMaskBounds(mask);
+}
+
+static void BuildCircleMask(CollisionMask* mask, int radius) {
+    int size = 2 * radius;
+    AllocateMask(mask, size, size);
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            float dx = x + 0.5f - radius;
+            float dy = y + 0.5f - radius;
+            if (dx * dx + dy * dy <= (float)(radius * radius)) SetMaskBit(mask, x, y);
+        }
+    }
+    ComputeMaskBounds(mask);
+}
+
+static void BuildAllMasks(void) {
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        const AtlasSprite* sprite = &ATLAS_SPRITES[i];
+        BuildMask(&spriteMasks[i], sprite, sprite->frame.x, sprite->frame.y);
+    }
+    for (int frame = 0; frame < METEOR_IMPACT_FRAMES; frame++) {
+        const AtlasSprite* sprite = &ATLAS_SPRITES[SPRITE_METEOR_IMPACT_1 + frame];
+        for (int size = METEOR_MIN_SIZE; size <= METEOR_MAX_SIZE; size++) {
+            BuildMask(&meteorImpactMasks[frame][size - METEOR_MIN_SIZE], sprite, size, size);
+        }
+    }
+    BuildCircleMask(&projectileMask, PROJECTILE_RADIUS);
+}
+
+// Safe to call from any thread; the masks are built by whoever gets here first
+void InitCollisionMasks(void) {
+    pthread_once(&masksOnce, BuildAllMasks);
+}
+
+const CollisionMask* GetSpriteMask(SpriteId sprite) {
+    return &spriteMasks[sprite];
+}
+
+const CollisionMask* GetMeteorImpactMask(int frame, int size) {
+    if (frame < 0) frame = 0;
+    if (frame >= METEOR_IMPACT_FRAMES) frame = METEOR_IMPACT_FRAMES - 1;
+    if (size < METEOR_MIN_SIZE) size = METEOR_MIN_SIZE;
+    if (size > METEOR_MAX_SIZE) size = METEOR_MAX_SIZE;
+    return &meteorImpactMasks[frame][size - METEOR_MIN_SIZE];
+}
+
+// Projectiles are circles; the mask's origin is the top-left of the
+// circle's bounding square.
+const CollisionMask* GetProjectileMask(void) {
+    return &projectileMask;
+}
+
+// 64 mask bits starting at `offset` within a row; bits outside are zero
+static uint64_t ReadMaskBits(const uint64_t* row, int wordsPerRow, int offset) {
+    int word = offset >> 6;
+    int shift = offset & 63;
+    uint64_t bits = row[word] >> shift;
+    if (shift && word + 1 < wordsPerRow) bits |= row[word + 1] << (64 - shift);
+    return bits;
+}
+
+bool CheckMaskCollision(const CollisionMask* a, Vector2 positionA, const CollisionMask* b, Vector2 positionB) {
+    int ax = (int)floorf(positionA.x), ay = (int)floorf(positionA.y);
+    int bx = (int)floorf(positionB.x), by = (int)floorf(positionB.y);
+    int x0 = ax > bx ? ax : bx;
+    int x1 = (ax + a->width < bx + b->width) ? ax + a->width : bx + b->width;
+    int y0 = ay > by ? ay : by;
+    int y1 = (ay + a->height < by + b->height) ? ay + a->height : by + b->height;
+    if (x0 >= x1 || y0 >= y1) return false;
+
+    for (int y = y0; y < y1; y++) {
+        const uint64_t* rowA = a->bits + (size_t)(y - ay) * a->wordsPerRow;
+        const uint64_t* rowB = b->bits + (size_t)(y - by) * b->wordsPerRow;
+        for (int x = x0; x < x1; x += 64) {
+            uint64_t overlap = ReadMaskBits(rowA, a->wordsPerRow, x - ax) &
+                               ReadMaskBits(rowB, b->wordsPerRow, x - bx);
+            if (x1 - x < 64) overlap &= (1ULL << (x1 - x)) - 1;
+            if (overlap) return true;
+        }
+    }
+    return false;
+}
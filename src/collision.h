@@ -0,0 +1,13 @@
+#ifndef COLLISION_H
+#define COLLISION_H
+#include "raylib.h"
+#include "types.h"
+#include <stdbool.h>
+
+void InitCollisionMasks(void);
+const CollisionMask* GetSpriteMask(SpriteId sprite);
+const CollisionMask* GetMeteorImpactMask(int frame, int size);
+const CollisionMask* GetProjectileMask(void);
+bool CheckMaskCollision(const CollisionMask* a, Vector2 positionA, const CollisionMask* b, Vector2 positionB);
+
+#endif
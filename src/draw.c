@@ -3,6 +3,15 @@
 #include "game.h"
 #include "menu.h"
 #include "utils.h"
+#include "particles.h"
+#include "render.h"
+#include "input.h"
+#include "atlas.h"
+#include "lighting.h"
+#include "arena.h"
+#include "netplay.h"
+#include "scheduler.h"
+#include "rng.h"
 #include "raylib.h"
 #include "types.h"
 #include <stdbool.h>
@@ -10,52 +19,95 @@
 #include <stdlib.h>
 #include <math.h>
 
-void DrawMeteors(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+// Race colours: the sprite tint (player one keeps the plain sprite) and the
+// label/standings colour
+static const Color PLAYER_TINTS[MAX_PLAYERS] = {
+    WHITE, {255, 120, 120, 255}, {120, 160, 255, 255}, {120, 220, 120, 255},
+    {255, 200, 90, 255}, {220, 130, 255, 255}, {90, 220, 220, 255}, {255, 150, 210, 255}
+};
+static const Color PLAYER_LABELS[MAX_PLAYERS] = {
+    BLACK, RED, BLUE, DARKGREEN, ORANGE, PURPLE, {0, 150, 150, 255}, PINK
+};
+
+// This frame's night lights, gathered before anything is queued so sprites
+// no light reaches can be skipped.
+static LightList lightList;
+// Render thread only. raylib's GetRandomValue() belongs to the sim thread
+// (clouds, run seeds), so the shake draws from its own generator.
+static uint64_t shakeRng;
+
+static bool HiddenInDarkness(Rectangle dest) {
+    if (!IsInDarkness(&lightList, dest)) return false;
+    lightList.hidden++;
+    return true;
+}
+
+// Atlas frames are trimmed, so `dest` covers the whole frame and the packed
+// pixels land at their offset inside it.
+static void PushAtlasSprite(RenderList* list, RenderLayer layer, Texture2D atlas, SpriteId sprite,
+                            Rectangle dest, Color tint) {
+    const AtlasSprite* entry = &ATLAS_SPRITES[sprite];
+    float scaleX = dest.width / entry->frame.x;
+    float scaleY = dest.height / entry->frame.y;
+    Rectangle trimmed = {
+        dest.x + entry->offset.x * scaleX,
+        dest.y + entry->offset.y * scaleY,
+        entry->source.width * scaleX,
+        entry->source.height * scaleY
+    };
+    if (HiddenInDarkness(trimmed)) return;
+    PushSprite(list, layer, atlas, entry->source, trimmed, tint);
+}
+
+void PushMeteors(RenderList* list, const WindowState* window, const GameState* game) {
 #if DEBUG_METEOR_COUNT
     int activeCount = 0;
     for (int i = 0; i < MAX_METEORS; i++) {
         if (game->meteors[i].active) activeCount++;
     }
-    if (game->isStoryMode && game->bossActive) {
-        DrawText(TextFormat("Active Meteors: %d", activeCount), 10, 150, 20, RED);
-    }
+    PushText(list, RENDER_LAYER_HUD, TextFormat("Active Meteors: %d", activeCount), 10, 150, 20, RED);
 #endif
     for (int i = 0; i < MAX_METEORS; i++) {
         const Meteor* meteor = &game->meteors[i];
-        if (!meteor->active) continue;
-        Rectangle source = {0};
-        Color tint = WHITE;
-        if (meteor->state == METEOR_STATE_FALLING) {
-            if (meteor->currentFrame == 0) {
-                source = (Rectangle){ 2158, 6, 110, 120 };
-            } else {
-                source = (Rectangle){ 2275, 6, 110, 120 };
-            }
-        } else if (meteor->state == METEOR_STATE_IMPACT) {
-            if (meteor->currentFrame == 0) {
-                source = (Rectangle){ 2392, 34, 103, 68 };
-            } else if (meteor->currentFrame == 1) {
-                source = (Rectangle){ 2497, 34, 129, 74 };
-            } else {
-                source = (Rectangle){ 2643, 34, 90, 51 };
-            }
-            if (meteor->impactTime > METEOR_GROUND_LIFETIME) {
-                float alpha = 1.0f - (meteor->impactTime - METEOR_GROUND_LIFETIME) / 3.0f;
-                tint = (Color){ 255, 255, 255, (unsigned char)(255 * alpha) };
-            }
-        } else {
-            continue;
-        }
+        if (!meteor->active || meteor->state == METEOR_STATE_INACTIVE) continue;
+        Color tint = (Color){ 255, 255, 255, (unsigned char)(255 * meteor->alpha) };
         Rectangle destRect = {
-            meteor->rect.x + shakeOffset.x,
-            meteor->rect.y + shakeOffset.y,
-            meteor->rect.width,
-            meteor->rect.height
+            meteor->rect.x * window->scaleFactor + list->shakeOffset.x,
+            meteor->rect.y * window->scaleFactor + list->shakeOffset.y,
+            meteor->rect.width * window->scaleFactor,
+            meteor->rect.height * window->scaleFactor
         };
-        DrawTexturePro(game->spriteSheet, source, destRect, (Vector2){0}, 0, tint);
+        PushAtlasSprite(list, RENDER_LAYER_WORLD, game->spriteSheet, GetMeteorSprite(game, i), destRect, tint);
     }
 }
 
+// Thousands of projectiles share one texture, so they go out as one
+// quad batch rather than a DrawTexturePro() call each.
+void DrawProjectiles(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    const ProjectilePool* pool = &game->projectiles;
+    if (pool->count == 0 || game->projectileTexture.id == 0) return;
+    float half = 2 * PROJECTILE_RADIUS * window->scaleFactor;
+    BeginRenderQuads(game->projectileTexture, pool->count);
+    for (int i = 0; i < pool->count; i++) {
+        if (!pool->alive[i]) continue;
+        RenderQuad(pool->x[i] * window->scaleFactor + shakeOffset.x, pool->y[i] * window->scaleFactor + shakeOffset.y,
+                   half, WHITE);
+    }
+    EndRenderQuads();
+}
+
+void DrawPlayerHP(const WindowState* window, const GameState* game) {
+    if (!game->isStoryMode || !game->bossActive) return;
+    const float barWidth = 200 * window->scaleFactor;
+    const float barHeight = 16 * window->scaleFactor;
+    const float startX = 20 * window->scaleFactor;
+    const float startY = window->height - barHeight - 40 * window->scaleFactor;
+    float hpPercent = (float)game->hp / PLAYER_HP_MAX;
+    RenderRect((Rectangle){ startX, startY, barWidth, barHeight }, (Color){40, 40, 40, 220});
+    RenderRect((Rectangle){ startX, startY, barWidth * hpPercent, barHeight }, hpPercent > 0.3f ? SKYBLUE : RED);
+    RenderRectLines((Rectangle){ startX, startY, barWidth, barHeight }, 1, BLACK);
+}
+
 void DrawBossHP(const WindowState* window, const GameState* game) {
     if (!game->isStoryMode || !game->bossActive) return;
     const float barWidth = 500 * window->scaleFactor;
@@ -63,170 +115,221 @@ void DrawBossHP(const WindowState* window, const GameState* game) {
     const float borderRadius = 18 * window->scaleFactor;
     const float startX = (window->width - barWidth) / 2;
     const float startY = window->height - barHeight - 30 * window->scaleFactor;
-    DrawRectangleRounded((Rectangle){ startX, startY, barWidth, barHeight }, 0.5f, 32, (Color){40, 40, 40, 220});
+    RenderRoundedRect((Rectangle){ startX, startY, barWidth, barHeight }, 0.5f, (Color){40, 40, 40, 220});
     float hpPercent = (float)game->bossHP / 10.0f;
     float fillWidth = barWidth * hpPercent;
     Color fillColor = (hpPercent > 0.5f) ? (Color){ 0, 220, 40, 255 } : (hpPercent > 0.2f ? ORANGE : RED);
-    DrawRectangleRounded((Rectangle){ startX, startY, fillWidth, barHeight }, 0.5f, 32, fillColor);
-    DrawRectangleRoundedLines((Rectangle){ startX, startY, barWidth, barHeight }, 0.5f, 32, BLACK);
+    RenderRoundedRect((Rectangle){ startX, startY, fillWidth, barHeight }, 0.5f, fillColor);
+    RenderRoundedRectLines((Rectangle){ startX, startY, barWidth, barHeight }, 0.5f, BLACK);
+}
+
+void SeedScreenShake(uint64_t seed) {
+    SeedRng(&shakeRng, seed);
 }
 
 Vector2 ApplyScreenShake(const GameState* game) {
-    if (game->screenShakeTimer <= 0 || game->screenShakeIntensity <= 0) {
+    if (game->screenShakeIntensity <= 0) {
         return (Vector2){ 0, 0 };
     }
     return (Vector2){
-        GetRandomValue(-game->screenShakeIntensity, game->screenShakeIntensity),
-        GetRandomValue(-game->screenShakeIntensity, game->screenShakeIntensity)
+        NextRandomValue(&shakeRng, -game->screenShakeIntensity, game->screenShakeIntensity),
+        NextRandomValue(&shakeRng, -game->screenShakeIntensity, game->screenShakeIntensity)
     };
 }
 
-void UpdateAnimation(GameState* game, const WindowState* window, float deltaTime) {
-    game->frameTime += deltaTime;
-    if (game->frameTime >= FRAME_DELAY) {
-        game->frameTime = 0;
-        game->currentFrame ^= 1;
-        const Rectangle* frame = game->isCrouching ? &game->crouchFrames[game->currentFrame] : &game->runFrames[game->currentFrame];
-        game->baseSize.x = frame->width;
-        game->baseSize.y = frame->height;
-    }
-}
-
-void DrawClouds(const WindowState* window, const GameState* game) {
+void PushClouds(RenderList* list, const WindowState* window, const GameState* game) {
+    Rectangle source = { 0, 0, game->cloudTexture.width, game->cloudTexture.height };
     for (int i = 0; i < MAX_CLOUDS; i++) {
         if (!game->clouds[i].active) continue;
         
         const Cloud* cloud = &game->clouds[i];
-        
-        Vector2 scaledPos = {
+        float scale = cloud->scale * window->scaleFactor;
+        Rectangle destRect = {
             cloud->position.x * window->scaleFactor,
-            cloud->position.y * window->scaleFactor
+            cloud->position.y * window->scaleFactor,
+            source.width * scale,
+            source.height * scale
         };
-        
-        DrawTextureEx(
-            game->cloudTexture, 
-            scaledPos,
-            0,
-            cloud->scale * window->scaleFactor,
-            Fade(WHITE, cloud->alpha)
-        );
+        if (HiddenInDarkness(destRect)) continue;
+        PushSprite(list, RENDER_LAYER_SKY, game->cloudTexture, source, destRect, Fade(WHITE, cloud->alpha));
     }
 }
 
+static void DrawParticleLayer(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    DrawParticles(game->particles, window, shakeOffset);
+}
+
+static void DrawNightMask(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    DrawLightmap(&lightList, window->lightMask, window);
+}
+
+static void DrawHealthBars(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    DrawBossHP(window, game);
+    DrawPlayerHP(window, game);
+}
+
+static void DrawParticleProfiler(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    DrawParticleStats(game->particles, 20, 60, 20);
+}
+
+static void DrawInputProfiler(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    DrawInputLatency(game->input, 20, 180, 20);
+}
+
+static void DrawPauseLayer(const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    DrawPauseMenu(window, game);
+}
+
+static void PushCenteredText(RenderList* list, RenderLayer layer, const WindowState* window, const char* text,
+                             int posY, int fontSize, Color color) {
+    PushText(list, layer, text, (window->width - MeasureRenderText(text, fontSize)) / 2, posY, fontSize, color);
+}
+
+static RenderList renderList;
+
+// Queues the frame layer by layer, then submits it; see render.c for the
+// culling. The win screen clears to black, so nothing under it is drawn.
 void DrawGame(const WindowState* window, const GameState* game) {
-    BeginDrawing();
-    ClearBackground(WHITE);
-    
-    DrawClouds(window, game);
-    
-    Vector2 shakeOffset = ApplyScreenShake(game);
+    RenderList* list = &renderList;
+    BeginRenderList(list, window, ApplyScreenShake(game));
+    Vector2 shakeOffset = list->shakeOffset;
+    CollectLights(&lightList, window, game, shakeOffset);
+
+    PushClear(list, RENDER_LAYER_SKY, WHITE);
+    PushClouds(list, window, game);
+
     float groundY = (BASE_RESOLUTION.y - GROUND_HEIGHT) * window->scaleFactor;
     float groundHeight = GROUND_HEIGHT * window->scaleFactor;
-    DrawRectangle(0, groundY, window->width, groundHeight, DARKGRAY);
-    const Rectangle* frame = game->isCrouching ? &game->crouchFrames[game->currentFrame] : &game->runFrames[game->currentFrame];
-    Rectangle destRect = {
-        game->screenPosition.x + shakeOffset.x,
-        game->screenPosition.y + shakeOffset.y,
-        frame->width * window->scaleFactor,
-        frame->height * window->scaleFactor
-    };
-    DrawTexturePro(game->spriteSheet, *frame, destRect, (Vector2){0}, 0, WHITE);
+    PushRect(list, RENDER_LAYER_GROUND, (Rectangle){ 0, (int)groundY, window->width, (int)groundHeight }, DARKGRAY);
+
+    bool race = game->playerCount > 1;
+    const NetplaySession* netplay = game->netplay && game->netplay->inMatch ? game->netplay : NULL;
+    for (int i = 0; i < game->playerCount; i++) {
+        const Player* dino = &game->players[i];
+        SpriteId player = GetPlayerSprite(game, i);
+        Rectangle destRect = {
+            dino->basePosition.x * window->scaleFactor + shakeOffset.x,
+            dino->basePosition.y * window->scaleFactor + shakeOffset.y,
+            ATLAS_SPRITES[player].frame.x * window->scaleFactor,
+            ATLAS_SPRITES[player].frame.y * window->scaleFactor
+        };
+        // Knocked-out dinos stay on the field as ghosts until the race ends
+        Color tint = PLAYER_TINTS[i];
+        if (!dino->alive && !game->gameOver) tint = Fade(tint, 0.3f);
+        PushAtlasSprite(list, RENDER_LAYER_WORLD, game->spriteSheet, player, destRect, tint);
+        if (race) {
+            PushText(list, RENDER_LAYER_WORLD, TextFormat("P%d", i + 1), (int)destRect.x + (int)(i * 12 * window->scaleFactor),
+                     (int)(destRect.y - 22 * window->scaleFactor), 20 * window->scaleFactor, PLAYER_LABELS[i]);
+        }
+    }
     for (int i = 0; i < MAX_OBSTACLES; i++) {
         const Obstacle* obs = &game->obstacles.obstacles[i];
         if (obs->active) {
-            Rectangle source = {0};
-            switch (obs->type) {
-                case OBSTACLE_CACTUS_1: source = (Rectangle){446, 0, 34, 68}; break;
-                case OBSTACLE_CACTUS_2: source = (Rectangle){480, 0, 68, 68}; break;
-                case OBSTACLE_CACTUS_3: source = (Rectangle){548, 0, 102, 68}; break;
-                case OBSTACLE_CACTUS_4: source = (Rectangle){650, 0, 50, 94}; break;
-                case OBSTACLE_CACTUS_5: source = (Rectangle){700, 0, 100, 94}; break;
-                case OBSTACLE_CACTUS_6: source = (Rectangle){800, 0, 150, 95}; break;
-                case OBSTACLE_BIRD: source = (Rectangle){260 + obs->currentFrame * 93, 0, 93, 80}; break;
-            }
             Rectangle destRect = {
-                obs->rect.x + shakeOffset.x,
-                obs->rect.y + shakeOffset.y,
-                obs->rect.width,
-                obs->rect.height
+                obs->rect.x * window->scaleFactor + shakeOffset.x,
+                obs->rect.y * window->scaleFactor + shakeOffset.y,
+                obs->rect.width * window->scaleFactor,
+                obs->rect.height * window->scaleFactor
             };
-            DrawTexturePro(game->spriteSheet, source, destRect, (Vector2){0}, 0, WHITE);
+            PushAtlasSprite(list, RENDER_LAYER_WORLD, game->spriteSheet, GetObstacleSprite(game, i), destRect, WHITE);
         }
     }
-    if (game->isStoryMode && game->bossActive) {
-        DrawMeteors(window, game, shakeOffset);
-    }
-    if (game->nightModeActive && game->nightAlpha > 0) {
-        BeginTextureMode(game->lightMask);
-        ClearBackground(BLANK);
-        DrawRectangle(0, 0, window->width, window->height, 
-                      (Color){0, 0, 0, (unsigned char)(game->nightAlpha * NIGHT_ALPHA)});
-        Vector2 playerCenter = {
-            game->screenPosition.x + game->rect.width / 2,
-            game->screenPosition.y + game->rect.height / 2
-        };
-        DrawCircleGradient(
-            (int)playerCenter.x,
-            (int)playerCenter.y,
-            (LIGHT_RADIUS + FADE_DISTANCE) * window->scaleFactor,
-            (Color){0, 0, 0, 0},
-            (Color){0, 0, 0, (unsigned char)(game->nightAlpha * NIGHT_ALPHA)}
-        );
-        EndTextureMode();
-        DrawTextureRec(game->lightMask.texture, 
-                       (Rectangle){ 0, 0, window->width, -window->height }, 
-                       (Vector2){ 0, 0 }, 
-                       WHITE);
-    }
-    if (game->isStoryMode && game->bossActive) {
-        DrawBossHP(window, game);
-    }
-    if (game->gameOver && !game->gameWon) {
-        const char* text = "GAME OVER - Press SPACE to restart";
-        int textWidth = MeasureText(text, 40);
-        DrawText(text, (window->width - textWidth) / 2, window->height / 2, 40, RED);
-    } else if (game->gameWon) {
-        ClearBackground(BLACK);
-        const char* winText = "YOU WON!";
-        int fontSize = 100 * window->scaleFactor;
-        int textWidth = MeasureText(winText, fontSize);
-        DrawText(winText, (window->width - textWidth) / 2, window->height / 2 - fontSize / 2, fontSize, YELLOW);
-        const char* info = "Press SPACE to return to menu";
-        int infoWidth = MeasureText(info, 30);
-        DrawText(info, (window->width - infoWidth) / 2, window->height / 2 + fontSize / 2 + 20, 30, LIGHTGRAY);
-    }
-    const char* scoreText = TextFormat("SCORE: %d", game->score);
-    const char* highScoreText = TextFormat("HIGH SCORE: %d", game->highScore);
-    int scoreWidth = MeasureText(scoreText, 40);
-    int highScoreWidth = MeasureText(highScoreText, 30);
-    DrawText(scoreText, (window->width - scoreWidth) / 2, 20, 40, BLACK);
-    DrawText(highScoreText, (window->width - highScoreWidth) / 2, 70, 30, DARKGRAY);
+    bool bossFight = game->isStoryMode && game->bossActive;
+    if (bossFight) {
+        PushMeteors(list, window, game);
+        if (game->projectiles.count > 0) PushCustom(list, RENDER_LAYER_EFFECTS, DrawProjectiles);
+    }
+    if (game->particles) {
+        PushCustom(list, RENDER_LAYER_EFFECTS, DrawParticleLayer);
+    }
+    if (lightList.darkness > 0) {
+        PushCustom(list, RENDER_LAYER_LIGHTING, DrawNightMask);
+    }
+
+    if (bossFight) {
+        PushCustom(list, RENDER_LAYER_HUD, DrawHealthBars);
+    }
+    PushCenteredText(list, RENDER_LAYER_HUD, window, TextFormat("SCORE: %d", game->score), 20, 40, BLACK);
+    PushCenteredText(list, RENDER_LAYER_HUD, window, TextFormat("HIGH SCORE: %d", game->highScore), 70, 30, DARKGRAY);
     if (game->score == game->highScore && game->score > 0) {
-        DrawText("NEW HIGH SCORE!", (window->width - MeasureText("NEW HIGH SCORE!", 30)) / 2, 110, 30, GREEN);
+        PushCenteredText(list, RENDER_LAYER_HUD, window, "NEW HIGH SCORE!", 110, 30, GREEN);
     }
-    if (game->pauseMenu.isPaused) {
-        DrawPauseMenu(window, game);
+    if (game->autopilotEnabled) {
+        PushText(list, RENDER_LAYER_HUD, "AUTOPILOT", 20, 20, 30, MAROON);
+    }
+    if (game->showProfiler) {
+        if (game->particles) {
+            PushCustom(list, RENDER_LAYER_HUD, DrawParticleProfiler);
+        }
+        if (game->bossActive) {
+            PushText(list, RENDER_LAYER_HUD, TextFormat("projectiles %d, %d broadphase candidates", game->projectiles.count,
+                                                        game->projectiles.candidatesTested), 20, 108, 20, DARKGRAY);
+        }
+        PushRenderStats(list, RENDER_LAYER_HUD, 20, 132, 20);
+        if (game->input) {
+            PushCustom(list, RENDER_LAYER_HUD, DrawInputProfiler);
+        }
+        if (lightList.darkness > 0) {
+            PushText(list, RENDER_LAYER_HUD, TextFormat("lights %d, %d sprites hidden in darkness", lightList.count,
+                                                        lightList.hidden), 20, 204, 20, DARKGRAY);
+        }
+        const MemoryStats* memory = GetMemoryStats();
+        PushText(list, RENDER_LAYER_HUD, TextFormat("heap %d allocs (%zu B) last frame, %ld frames allocated; "
+                                                    "arena %zu B, peak %zu", memory->lastAllocations,
+                                                    memory->lastBytes, memory->allocatingFrames,
+                                                    memory->arenaUsed, memory->arenaPeak), 20, 228, 20, DARKGRAY);
+        if (netplay) {
+            PushText(list, RENDER_LAYER_HUD, TextFormat("versus: %d rollbacks (%d ticks re-run, worst %.2f ms), "
+                                                        "%d stalls, %d/%d checksums bad",
+                                                        atomic_load(&netplay->rollbacks),
+                                                        atomic_load(&netplay->resimulated),
+                                                        atomic_load(&netplay->worstRollbackUs) / 1000.0f,
+                                                        atomic_load(&netplay->stalls), atomic_load(&netplay->desyncs),
+                                                        atomic_load(&netplay->checks)), 20, 252, 20, DARKGRAY);
+        }
+        if (game->scheduler) {
+            int hits = atomic_load(&game->scheduler->hits);
+            int taken = hits + atomic_load(&game->scheduler->misses);
+            PushText(list, RENDER_LAYER_HUD, TextFormat("obstacle chunks: %d/%d ready from the scheduler (%.0f%%)", hits,
+                                                        taken, taken ? 100.0f * hits / taken : 100.0f),
+                     20, 276, 20, DARKGRAY);
+        }
     }
 
-    if (game->isStoryMode && game->bossActive && game->bossHP <= 0) {
-        ClearBackground(BLACK);
-        const char* winText = "YOU WON!";
-        int fontSize = 100 * window->scaleFactor;
-        int textWidth = MeasureText(winText, fontSize);
-        DrawText(winText, (window->width - textWidth) / 2, window->height / 2 - fontSize / 2, fontSize, YELLOW);
-        const char* info = "Press SPACE to return to menu";
-        int infoWidth = MeasureText(info, 30);
-        DrawText(info, (window->width - infoWidth) / 2, window->height / 2 + fontSize / 2 + 20, 30, LIGHTGRAY);
-    } else if (game->gameWon) {
-        ClearBackground(BLACK);
-        const char* winText = "YOU WON!";
+    if (race) {
+        for (int i = 0; i < game->playerCount; i++) {
+            const Player* dino = &game->players[i];
+            const char* you = netplay && netplay->localPlayer == i ? " (you)" : "";
+            const char* standing = dino->alive ? TextFormat("P%d%s  %d", i + 1, you, game->score)
+                                               : TextFormat("P%d%s  out at %d", i + 1, you, dino->finalScore);
+            PushText(list, RENDER_LAYER_HUD, standing, window->width - 200 * window->scaleFactor,
+                     (20 + 24 * i) * window->scaleFactor, 20 * window->scaleFactor, PLAYER_LABELS[i]);
+        }
+    }
+    if (game->gameOver && race) {
+        int winner = GetRaceWinner(game);
+        PushCenteredText(list, RENDER_LAYER_OVERLAY, window, winner >= 0 ? TextFormat("P%d WINS!", winner + 1) : "DRAW!",
+                         window->height / 2 - 50, 40, winner >= 0 ? PLAYER_LABELS[winner] : DARKGRAY);
+        PushCenteredText(list, RENDER_LAYER_OVERLAY, window, netplay ? "Both hold JUMP for a rematch" : "Press SPACE to race again",
+                         window->height / 2, 40, RED);
+    } else if (game->gameOver && !game->gameWon) {
+        PushCenteredText(list, RENDER_LAYER_OVERLAY, window, "GAME OVER - Press SPACE to restart", window->height / 2, 40, RED);
+    }
+    if (netplay && GetNetplayPhase(netplay) == NETPLAY_DISCONNECTED) {
+        PushCenteredText(list, RENDER_LAYER_OVERLAY, window, "OPPONENT DISCONNECTED", window->height / 2 + 60, 40, MAROON);
+    }
+    if (game->pauseMenu.isPaused) {
+        PushCustom(list, RENDER_LAYER_OVERLAY, DrawPauseLayer);
+    }
+    if (game->gameWon || (bossFight && game->bossHP <= 0)) {
         int fontSize = 100 * window->scaleFactor;
-        int textWidth = MeasureText(winText, fontSize);
-        DrawText(winText, (window->width - textWidth) / 2, window->height / 2 - fontSize / 2, fontSize, YELLOW);
-        const char* info = "Press SPACE to return to menu";
-        int infoWidth = MeasureText(info, 30);
-        DrawText(info, (window->width - infoWidth) / 2, window->height / 2 + fontSize / 2 + 20, 30, LIGHTGRAY);
+        PushClear(list, RENDER_LAYER_SCREEN, BLACK);
+        PushCenteredText(list, RENDER_LAYER_SCREEN, window, "YOU WON!", window->height / 2 - fontSize / 2, fontSize, YELLOW);
+        PushCenteredText(list, RENDER_LAYER_SCREEN, window, "Press SPACE to return to menu",
+                         window->height / 2 + fontSize / 2 + 20, 30, LIGHTGRAY);
     }
 
-    EndDrawing();
+    BeginRenderFrame();
+    SubmitRenderList(list, window, game);
+    EndRenderFrame();
 }
@@ -7,10 +7,12 @@
 
 void DrawGame(const WindowState* window, const GameState* game);
 void DrawPauseMenu(const WindowState* window, const GameState* game);
-void DrawMeteors(const WindowState* window, const GameState* game, Vector2 shakeOffset);
+void PushMeteors(RenderList* list, const WindowState* window, const GameState* game);
+void DrawProjectiles(const WindowState* window, const GameState* game, Vector2 shakeOffset);
+void DrawPlayerHP(const WindowState* window, const GameState* game);
 void DrawBossHP(const WindowState* window, const GameState* game);
-void UpdateAnimation(GameState* game, const WindowState* window, float deltaTime);
+void SeedScreenShake(uint64_t seed);
 Vector2 ApplyScreenShake(const GameState* game);
-void DrawClouds(const WindowState* window, const GameState* game);
+void PushClouds(RenderList* list, const WindowState* window, const GameState* game);
 
 #endif
@@ -0,0 +1,199 @@
+#include "env.h"
+#include "game.h"
+#include "rng.h"
+#include <stdlib.h>
+#include <string.h>
+
+void WriteObservation(const GameState* game, float* observation) {
+    float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
+    const Player* player = &game->players[0];
+    float* out = observation;
+    *out++ = (groundY - (player->basePosition.y + player->rect.height)) / BASE_RESOLUTION.y;
+    *out++ = player->baseJumpVelocity / FAST_FALL_VELOCITY;
+    *out++ = player->isJumping ? 1.0f : 0.0f;
+    *out++ = player->isCrouching ? 1.0f : 0.0f;
+    *out++ = game->score / 1000.0f;
+    *out++ = game->bossActive ? 1.0f : 0.0f;
+    *out++ = game->bossHP / 10.0f;
+
+    // Nearest obstacles ahead of the player's back edge, closest first
+    const Obstacle* nearest[ENV_OBSERVED_OBSTACLES] = {0};
+    for (int i = 0; i < MAX_OBSTACLES; i++) {
+        const Obstacle* obs = &game->obstacles.obstacles[i];
+        if (!obs->active || obs->rect.x + obs->rect.width < player->rect.x) continue;
+        for (int slot = 0; slot < ENV_OBSERVED_OBSTACLES; slot++) {
+            if (!nearest[slot] || obs->rect.x < nearest[slot]->rect.x) {
+                memmove(&nearest[slot + 1], &nearest[slot], (ENV_OBSERVED_OBSTACLES - slot - 1) * sizeof(nearest[0]));
+                nearest[slot] = obs;
+                break;
+            }
+        }
+    }
+    for (int slot = 0; slot < ENV_OBSERVED_OBSTACLES; slot++) {
+        const Obstacle* obs = nearest[slot];
+        if (!obs) {
+            *out++ = 1.0f;
+            *out++ = 0.0f;
+            *out++ = 0.0f;
+            *out++ = 0.0f;
+            *out++ = 0.0f;
+            continue;
+        }
+        *out++ = (obs->rect.x - player->rect.x) / BASE_RESOLUTION.x;
+        *out++ = (groundY - obs->rect.y) / BASE_RESOLUTION.y;
+        *out++ = obs->rect.width / BASE_RESOLUTION.x;
+        *out++ = obs->rect.height / BASE_RESOLUTION.y;
+        *out++ = obs->type == OBSTACLE_BIRD ? 1.0f : 0.0f;
+    }
+
+    const Meteor* meteors[ENV_OBSERVED_METEORS] = {0};
+    for (int i = 0; i < MAX_METEORS; i++) {
+        const Meteor* meteor = &game->meteors[i];
+        if (!meteor->active || meteor->rect.x + meteor->rect.width < player->rect.x) continue;
+        for (int slot = 0; slot < ENV_OBSERVED_METEORS; slot++) {
+            if (!meteors[slot] || meteor->rect.x < meteors[slot]->rect.x) {
+                memmove(&meteors[slot + 1], &meteors[slot], (ENV_OBSERVED_METEORS - slot - 1) * sizeof(meteors[0]));
+                meteors[slot] = meteor;
+                break;
+            }
+        }
+    }
+    for (int slot = 0; slot < ENV_OBSERVED_METEORS; slot++) {
+        const Meteor* meteor = meteors[slot];
+        if (!meteor) {
+            *out++ = 1.0f;
+            *out++ = 0.0f;
+            *out++ = 0.0f;
+            *out++ = 0.0f;
+            *out++ = 0.0f;
+            continue;
+        }
+        *out++ = (meteor->rect.x - player->rect.x) / BASE_RESOLUTION.x;
+        *out++ = (groundY - meteor->rect.y) / BASE_RESOLUTION.y;
+        *out++ = meteor->rect.width / BASE_RESOLUTION.x;
+        *out++ = meteor->rect.height / BASE_RESOLUTION.y;
+        *out++ = meteor->state == METEOR_STATE_IMPACT ? 1.0f : 0.0f;
+    }
+}
+
+// Each run's seed depends only on the batch seed, the slot and how many
+// runs that slot has finished, so results don't depend on thread timing.
+static void ResetEnvGame(VecEnv* env, int index) {
+    GameState* game = &env->games[index];
+    uint64_t seedState = env->baseSeed ^ ((uint64_t)index << 32 | env->episodes[index]++);
+    ResetSimState(game, NextRandom(&seedState));
+    WriteObservation(game, &env->observations[index * ENV_OBSERVATION_SIZE]);
+}
+
+// Finished games are reset in place so the batch never stalls; the done
+// flag tells the caller that the observation already belongs to a new run.
+static void StepRange(VecEnv* env, int first, int last) {
+    for (int i = first; i < last; i++) {
+        GameState* game = &env->games[i];
+        int scoreBefore = game->score;
+        StepGame(game, env->actions[i] & (INPUT_JUMP | INPUT_CROUCH));
+        env->rewards[i] = (float)(game->score - scoreBefore);
+        env->dones[i] = game->gameOver;
+        if (game->gameOver) {
+            if (!game->gameWon) env->rewards[i] += ENV_DEATH_REWARD;
+            ResetEnvGame(env, i);
+        } else {
+            WriteObservation(game, &env->observations[i * ENV_OBSERVATION_SIZE]);
+        }
+    }
+}
+
+static void* EnvWorkerMain(void* arg) {
+    EnvWorker* worker = arg;
+    VecEnv* env = worker->env;
+    for (;;) {
+        pthread_barrier_wait(&env->startBarrier);
+        if (env->shuttingDown) break;
+        StepRange(env, worker->first, worker->last);
+        pthread_barrier_wait(&env->doneBarrier);
+    }
+    return NULL;
+}
+
+VecEnv* CreateVecEnv(int count, int threadCount, uint64_t seed, bool storyMode) {
+    if (count < 1) return NULL;
+    if (threadCount < 1) threadCount = 1;
+    if (threadCount > count) threadCount = count;
+    VecEnv* env = calloc(1, sizeof(VecEnv));
+    env->count = count;
+    env->storyMode = storyMode;
+    env->games = calloc(count, sizeof(GameState));
+    env->observations = calloc((size_t)count * ENV_OBSERVATION_SIZE, sizeof(float));
+    env->rewards = calloc(count, sizeof(float));
+    env->dones = calloc(count, sizeof(bool));
+    env->episodes = calloc(count, sizeof(uint32_t));
+    for (int i = 0; i < count; i++) {
+        InitSimState(&env->games[i], 0);
+        env->games[i].isStoryMode = storyMode;
+    }
+    EnvReset(env, seed);
+
+    // The calling thread steps the first slice itself, so only
+    // threadCount - 1 helpers are started.
+    env->threadCount = threadCount;
+    env->workers = calloc(threadCount, sizeof(EnvWorker));
+    for (int t = 0; t < threadCount; t++) {
+        env->workers[t] = (EnvWorker){
+            .env = env,
+            .first = (int)((long long)count * t / threadCount),
+            .last = (int)((long long)count * (t + 1) / threadCount)
+        };
+    }
+    if (threadCount > 1) {
+        pthread_barrier_init(&env->startBarrier, NULL, threadCount);
+        pthread_barrier_init(&env->doneBarrier, NULL, threadCount);
+        env->threads = calloc(threadCount - 1, sizeof(pthread_t));
+        for (int t = 1; t < threadCount; t++) {
+            pthread_create(&env->threads[t - 1], NULL, EnvWorkerMain, &env->workers[t]);
+        }
+    }
+    return env;
+}
+
+void DestroyVecEnv(VecEnv* env) {
+    if (!env) return;
+    if (env->threadCount > 1) {
+        env->shuttingDown = true;
+        pthread_barrier_wait(&env->startBarrier);
+        for (int t = 1; t < env->threadCount; t++) {
+            pthread_join(env->threads[t - 1], NULL);
+        }
+        pthread_barrier_destroy(&env->startBarrier);
+        pthread_barrier_destroy(&env->doneBarrier);
+        free(env->threads);
+    }
+    free(env->workers);
+    free(env->games);
+    free(env->observations);
+    free(env->rewards);
+    free(env->dones);
+    free(env->episodes);
+    free(env);
+}
+
+void EnvReset(VecEnv* env, uint64_t seed) {
+    env->baseSeed = seed;
+    for (int i = 0; i < env->count; i++) {
+        env->episodes[i] = 0;
+        ResetEnvGame(env, i);
+        env->rewards[i] = 0.0f;
+        env->dones[i] = false;
+    }
+}
+
+// actions holds one EnvAction bit set per environment
+void EnvStep(VecEnv* env, const uint8_t* actions) {
+    env->actions = actions;
+    if (env->threadCount > 1) {
+        pthread_barrier_wait(&env->startBarrier);
+        StepRange(env, env->workers[0].first, env->workers[0].last);
+        pthread_barrier_wait(&env->doneBarrier);
+    } else {
+        StepRange(env, 0, env->count);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef ENV_H
+#define ENV_H
+#include "types.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ENV_OBSERVED_OBSTACLES 3
+#define ENV_OBSERVED_METEORS 3
+#define ENV_OBSTACLE_FEATURES 5
+#define ENV_METEOR_FEATURES 5
+#define ENV_PLAYER_FEATURES 7
+#define ENV_OBSERVATION_SIZE (ENV_PLAYER_FEATURES + \
+    ENV_OBSERVED_OBSTACLES * ENV_OBSTACLE_FEATURES + \
+    ENV_OBSERVED_METEORS * ENV_METEOR_FEATURES)
+#define ENV_DEATH_REWARD -10.0f
+
+typedef enum {
+    ENV_ACTION_NONE = INPUT_NONE,
+    ENV_ACTION_JUMP = INPUT_JUMP,
+    ENV_ACTION_CROUCH = INPUT_CROUCH
+} EnvAction;
+
+typedef struct VecEnv VecEnv;
+
+typedef struct {
+    VecEnv* env;
+    int first;
+    int last;
+} EnvWorker;
+
+// A batch of independent headless games stepped in lockstep. Observations
+// for environment i live at observations[i * ENV_OBSERVATION_SIZE].
+struct VecEnv {
+    int count;
+    bool storyMode;
+    uint64_t baseSeed;
+    uint32_t* episodes;
+    GameState* games;
+    float* observations;
+    float* rewards;
+    bool* dones;
+    const uint8_t* actions;
+
+    int threadCount;
+    pthread_t* threads;
+    EnvWorker* workers;
+    pthread_barrier_t startBarrier;
+    pthread_barrier_t doneBarrier;
+    bool shuttingDown;
+};
+
+VecEnv* CreateVecEnv(int count, int threadCount, uint64_t seed, bool storyMode);
+void DestroyVecEnv(VecEnv* env);
+void EnvReset(VecEnv* env, uint64_t seed);
+void EnvStep(VecEnv* env, const uint8_t* actions);
+void WriteObservation(const GameState* game, float* observation);
+
+#endif
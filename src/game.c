@@ -3,22 +3,37 @@
 #include "raylib.h"
 #include "menu.h"
 #include "sound.h"
+#include "rng.h"
+#include "replay.h"
+#include "collision.h"
+#include "scheduler.h"
+#include "boss.h"
+#include "telemetry.h"
+#include "atlas.h"
+#include "animation.h"
+#include "tween.h"
+#include "lighting.h"
+#include "render.h"
+#include "tuning.h"
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h>
+#include <time.h>
+
+static uint64_t NewRunSeed(void) {
+    return ((uint64_t)time(NULL) << 32) ^ (uint64_t)GetRandomValue(0, 0x7FFFFFFF);
+}
 
 void ResetGame(GameState* game) {
     if (game->score > game->highScore) {
         game->highScore = game->score;
         SaveHighScore(game->highScore);
     }
-    game->basePosition.y = BASE_RESOLUTION.y - GROUND_HEIGHT - game->runFrameHeight;
-    game->isJumping = false;
-    game->score = 0;
-    game->gameOver = false;
-    game->gameWon = false;
-    game->soundPlayed = false;
+    uint64_t seed = NewRunSeed();
+    if (game->scheduler) StartObstacleScheduler(game->scheduler, seed);
+    ResetSimState(game, seed);
+    RecordTelemetry(game->telemetry, 0, TELEMETRY_RUN_START, game->isStoryMode, (int64_t)seed);
 
     for (int i = 0; i < MAX_CLOUDS; i++) {
         game->clouds[i].position.x = (BASE_RESOLUTION.x / MAX_CLOUDS) * i + GetRandomValue(-50, 50);
@@ -29,41 +44,184 @@ void ResetGame(GameState* game) {
         game->clouds[i].active = true;
     }
 
-    for (int i = 0; i < MAX_OBSTACLES; i++) {
-        game->obstacles.obstacles[i].active = false;
+    BeginReplayRecording(&game->replay, game);
+}
+
+// Puts every gameplay field back to the start of a run. Everything the
+// simulation reads must be set here so a run depends only on the seed,
+// the story flag and the per-tick inputs.
+void ResetSimState(GameState* game, uint64_t seed) {
+    game->runSeed = seed;
+    SeedRng(&game->rngState, seed);
+    game->tick = 0;
+    if (game->playerCount < 1 || game->playerCount > MAX_PLAYERS) game->playerCount = 1;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        Player* player = &game->players[i];
+        player->prevInput = INPUT_NONE;
+        player->basePosition = (Vector2){BASE_RESOLUTION.x * 0.1f, BASE_RESOLUTION.y - GROUND_HEIGHT - game->runFrameHeight};
+        player->baseSize = (Vector2){game->runFrames[0].width, game->runFrames[0].height};
+        player->rect = (Rectangle){player->basePosition.x, player->basePosition.y, player->baseSize.x, player->baseSize.y};
+        player->baseJumpVelocity = 0.0f;
+        player->isJumping = false;
+        player->isCrouching = false;
+        player->isJumpCharging = false;
+        player->jumpChargeTime = 0.0f;
+        player->alive = i < game->playerCount;
+        player->finalScore = 0;
+        if (player->alive) PlayAnimation(&game->animators[ANIMATOR_PLAYERS + i], ANIM_CLIP_RUN, 0.0f);
+        else StopAnimation(&game->animators[ANIMATOR_PLAYERS + i]);
     }
+    game->score = 0;
+    game->scoreTimer = 0.0f;
+    game->gameOver = false;
+    game->gameWon = false;
+    game->soundPlayed = false;
     game->nightModeActive = false;
-
+    game->isNight = false;
+    game->dayCycleTimer = 0.0f;
+    game->nightAlpha = 0.0f;
     game->bossActive = false;
     game->bossHP = 10;
-    game->screenShakeTimer = 0.0f;
     game->screenShakeIntensity = 0.0f;
-
+    game->timeline.count = 0;
+    game->effectCount = 0;
+    game->hp = PLAYER_HP_MAX;
+    InitObstacles(game);
     InitMeteors(game);
+    InitBoss(game);
+}
+
+static void CopyProjectiles(ProjectilePool* to, const ProjectilePool* from) {
+    int count = from->count;
+    memcpy(to->x, from->x, count * sizeof(float));
+    memcpy(to->y, from->y, count * sizeof(float));
+    memcpy(to->vx, from->vx, count * sizeof(float));
+    memcpy(to->vy, from->vy, count * sizeof(float));
+    memcpy(to->alive, from->alive, count * sizeof(bool));
+    to->count = count;
+}
+
+void SaveSimState(const GameState* game, SimSnapshot* snapshot) {
+    memcpy(snapshot->players, game->players, sizeof(game->players));
+    snapshot->playerCount = game->playerCount;
+    snapshot->isStoryMode = game->isStoryMode;
+    memcpy(snapshot->animators, game->animators, sizeof(game->animators));
+    snapshot->timeline = game->timeline;
+    snapshot->score = game->score;
+    snapshot->scoreTimer = game->scoreTimer;
+    snapshot->obstacles = game->obstacles;
+    snapshot->gameOver = game->gameOver;
+    snapshot->gameWon = game->gameWon;
+    snapshot->nightModeActive = game->nightModeActive;
+    snapshot->isNight = game->isNight;
+    snapshot->dayCycleTimer = game->dayCycleTimer;
+    snapshot->nightAlpha = game->nightAlpha;
+    snapshot->bossActive = game->bossActive;
+    snapshot->bossHP = game->bossHP;
+    snapshot->hp = game->hp;
+    snapshot->screenShakeIntensity = game->screenShakeIntensity;
+    memcpy(snapshot->meteors, game->meteors, sizeof(game->meteors));
+    snapshot->meteorSpawnTimer = game->meteorSpawnTimer;
+    snapshot->nextMeteorSpawnTime = game->nextMeteorSpawnTime;
+    snapshot->boss = game->boss;
+    CopyProjectiles(&snapshot->projectiles, &game->projectiles);
+    snapshot->runSeed = game->runSeed;
+    snapshot->rngState = game->rngState;
+    snapshot->tick = game->tick;
+}
+
+// Only the simulation moves back; clouds, menus, sounds and the host-side
+// pointers keep their current values.
+void RestoreSimState(GameState* game, const SimSnapshot* snapshot) {
+    memcpy(game->players, snapshot->players, sizeof(game->players));
+    game->playerCount = snapshot->playerCount;
+    game->isStoryMode = snapshot->isStoryMode;
+    memcpy(game->animators, snapshot->animators, sizeof(game->animators));
+    game->timeline = snapshot->timeline;
+    game->score = snapshot->score;
+    game->scoreTimer = snapshot->scoreTimer;
+    game->obstacles = snapshot->obstacles;
+    game->gameOver = snapshot->gameOver;
+    game->gameWon = snapshot->gameWon;
+    game->nightModeActive = snapshot->nightModeActive;
+    game->isNight = snapshot->isNight;
+    game->dayCycleTimer = snapshot->dayCycleTimer;
+    game->nightAlpha = snapshot->nightAlpha;
+    game->bossActive = snapshot->bossActive;
+    game->bossHP = snapshot->bossHP;
+    game->hp = snapshot->hp;
+    game->screenShakeIntensity = snapshot->screenShakeIntensity;
+    memcpy(game->meteors, snapshot->meteors, sizeof(game->meteors));
+    game->meteorSpawnTimer = snapshot->meteorSpawnTimer;
+    game->nextMeteorSpawnTime = snapshot->nextMeteorSpawnTime;
+    game->boss = snapshot->boss;
+    CopyProjectiles(&game->projectiles, &snapshot->projectiles);
+    game->runSeed = snapshot->runSeed;
+    game->rngState = snapshot->rngState;
+    game->tick = snapshot->tick;
+    game->effectCount = 0;
+}
+
+static uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// FNV-1a over the outcome-relevant fields, one by one so struct padding
+// never leaks in; two peers that agree on this agree on the run.
+uint64_t HashSimSnapshot(const SimSnapshot* snapshot) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = HashBytes(hash, &snapshot->tick, sizeof(snapshot->tick));
+    hash = HashBytes(hash, &snapshot->rngState, sizeof(snapshot->rngState));
+    hash = HashBytes(hash, &snapshot->score, sizeof(snapshot->score));
+    hash = HashBytes(hash, &snapshot->gameOver, sizeof(snapshot->gameOver));
+    for (int i = 0; i < snapshot->playerCount; i++) {
+        const Player* player = &snapshot->players[i];
+        hash = HashBytes(hash, &player->rect, sizeof(player->rect));
+        hash = HashBytes(hash, &player->alive, sizeof(player->alive));
+        hash = HashBytes(hash, &player->finalScore, sizeof(player->finalScore));
+    }
+    for (int i = 0; i < MAX_OBSTACLES; i++) {
+        const Obstacle* obs = &snapshot->obstacles.obstacles[i];
+        hash = HashBytes(hash, &obs->active, sizeof(obs->active));
+        if (obs->active) hash = HashBytes(hash, &obs->rect, sizeof(obs->rect));
+    }
+    for (int i = 0; i < MAX_METEORS; i++) {
+        const Meteor* meteor = &snapshot->meteors[i];
+        hash = HashBytes(hash, &meteor->active, sizeof(meteor->active));
+        if (meteor->active) hash = HashBytes(hash, &meteor->rect, sizeof(meteor->rect));
+    }
+    hash = HashBytes(hash, &snapshot->hp, sizeof(snapshot->hp));
+    hash = HashBytes(hash, &snapshot->bossHP, sizeof(snapshot->bossHP));
+    return hash;
 }
 
 void InitObstacles(GameState* state) {
     for (int i = 0; i < MAX_OBSTACLES; i++) {
         state->obstacles.obstacles[i].active = false;
+        StopAnimation(&state->animators[ANIMATOR_OBSTACLES + i]);
     }
-    state->obstacles.spawnTimer = 0.0f;
-    state->obstacles.nextSpawnTime = GetRandomValue(MIN_SPAWN_INTERVAL, MAX_SPAWN_INTERVAL);
+    state->obstacles.nextSpawn = 0;
+    TakeObstacleChunk(state->scheduler, state->runSeed, 0, &state->obstacles.chunk);
 }
 
 void InitMeteors(GameState* state) {
     for (int i = 0; i < MAX_METEORS; i++) {
         state->meteors[i].active = false;
+        StopAnimation(&state->animators[ANIMATOR_METEORS + i]);
         state->meteors[i].state = METEOR_STATE_INACTIVE;
         state->meteors[i].hasDealtDamage = false;
     }
     state->meteorSpawnTimer = 0.0f;
-    state->nextMeteorSpawnTime = GetRandomValue(METEOR_SPAWN_INTERVAL_MIN * 100, 
-                                            METEOR_SPAWN_INTERVAL_MAX * 100) / 100.0f;
+    const TuningParams* tuning = GetTuning();
+    state->nextMeteorSpawnTime = NextRandomValue(&state->rngState, tuning->meteorSpawnIntervalMin * 100,
+                                                 tuning->meteorSpawnIntervalMax * 100) / 100.0f;
 }
 
 void InitClouds(GameState* game) {
-    game->cloudTexture = LoadTexture("resources/clouds.png");
-
     for (int i = 0; i < MAX_CLOUDS; i++) {
         game->clouds[i].active = false;
     }
@@ -87,71 +245,165 @@ void SpawnCloudAt(GameState* game, int index, float xPosition) {
     }
 }
 
-void SpawnObstacle(GameState* state, const WindowState* window) {
+void PushEffect(GameState* game, EffectType type, Vector2 position, float size) {
+    if (game->effectCount < MAX_EFFECT_EVENTS) {
+        game->effects[game->effectCount++] = (EffectEvent){ type, position, size };
+    }
+}
+
+static const AnimClipId OBSTACLE_CLIPS[] = {
+    [OBSTACLE_CACTUS_1] = ANIM_CLIP_CACTUS_1,
+    [OBSTACLE_CACTUS_2] = ANIM_CLIP_CACTUS_2,
+    [OBSTACLE_CACTUS_3] = ANIM_CLIP_CACTUS_3,
+    [OBSTACLE_CACTUS_4] = ANIM_CLIP_CACTUS_4,
+    [OBSTACLE_CACTUS_5] = ANIM_CLIP_CACTUS_5,
+    [OBSTACLE_CACTUS_6] = ANIM_CLIP_CACTUS_6,
+    [OBSTACLE_BIRD]     = ANIM_CLIP_BIRD
+};
+
+SpriteId GetPlayerSprite(const GameState* game, int index) {
+    return GetAnimatorSprite(&game->animators[ANIMATOR_PLAYERS + index]);
+}
+
+SpriteId GetObstacleSprite(const GameState* game, int index) {
+    return GetAnimatorSprite(&game->animators[ANIMATOR_OBSTACLES + index]);
+}
+
+SpriteId GetMeteorSprite(const GameState* game, int index) {
+    return GetAnimatorSprite(&game->animators[ANIMATOR_METEORS + index]);
+}
+
+// Impact frames are stretched over the meteor's square rect, so their
+// masks are picked by size as well as frame.
+const CollisionMask* GetMeteorMask(const GameState* game, int index) {
+    return GetMeteorImpactMask(game->animators[ANIMATOR_METEORS + index].frame, (int)game->meteors[index].rect.width);
+}
+
+// collisionRect is the opaque-pixel bounding box: the cheap prefilter in
+// front of the per-pixel test, and what the bots and tools see.
+static void UpdateCollisionBounds(Rectangle* collisionRect, Rectangle rect, const CollisionMask* mask) {
+    *collisionRect = (Rectangle){
+        floorf(rect.x) + mask->bounds.x,
+        floorf(rect.y) + mask->bounds.y,
+        mask->bounds.width,
+        mask->bounds.height
+    };
+}
+
+// Every live dino against one entity: the box test first, the per-pixel
+// test only where boxes overlap. Returns one bit per dino hit.
+static unsigned HitPlayers(const GameState* game, Rectangle box, const CollisionMask* mask, Vector2 position) {
+    unsigned hits = 0;
+    for (int i = 0; i < game->playerCount; i++) {
+        const Player* player = &game->players[i];
+        if (!player->alive || !CheckCollisionRecs(player->rect, box)) continue;
+        if (CheckMaskCollision(GetSpriteMask(GetPlayerSprite(game, i)), player->basePosition, mask, position)) {
+            hits |= 1u << i;
+        }
+    }
+    return hits;
+}
+
+// The run ends when the last dino is knocked out
+static void KnockOutPlayer(GameState* game, int index, DeathCause cause, int detail) {
+    Player* player = &game->players[index];
+    player->alive = false;
+    player->finalScore = game->score;
+    RecordTelemetry(game->telemetry, game->tick, TELEMETRY_DEATH, cause, detail);
+    for (int i = 0; i < game->playerCount; i++) {
+        if (game->players[i].alive) return;
+    }
+    game->gameOver = true;
+}
+
+// The dino that lasted longest, or -1 when the best score is shared
+int GetRaceWinner(const GameState* game) {
+    int winner = -1, best = -1;
+    for (int i = 0; i < game->playerCount; i++) {
+        int score = game->players[i].alive ? game->score : game->players[i].finalScore;
+        if (score > best) {
+            best = score;
+            winner = i;
+        } else if (score == best) {
+            winner = -1;
+        }
+    }
+    return winner;
+}
+
+void SpawnObstacle(GameState* state, ObstacleType type) {
     for (int i = 0; i < MAX_OBSTACLES; i++) {
         if (!state->obstacles.obstacles[i].active) {
             Obstacle* obs = &state->obstacles.obstacles[i];
             obs->active = true;
+            obs->type = type;
+            RecordTelemetry(state->telemetry, state->tick, TELEMETRY_SPAWN, type, 0);
             
-            ObstacleType randomType = GetRandomValue(0, OBSTACLE_BIRD);
-            obs->type = randomType;
+            const ObstacleDimensions dims = CACTUS_DIMENSIONS[type];
             
-            const ObstacleDimensions dims = CACTUS_DIMENSIONS[randomType];
-            
-            float groundY = window->height - GROUND_HEIGHT * window->scaleFactor;
-            float yPos = groundY - dims.height * window->scaleFactor + dims.yOffset * window->scaleFactor;
+            float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
+            float yPos = groundY - dims.height + dims.yOffset;
 
             obs->rect = (Rectangle){
-                window->width,
+                BASE_RESOLUTION.x,
                 yPos,
-                dims.width * window->scaleFactor,
-                dims.height * window->scaleFactor
-            };
-
-            obs->collisionRect = (Rectangle){
-                obs->rect.x + COLLISION_OFFSET * window->scaleFactor,
-                obs->rect.y + COLLISION_OFFSET * window->scaleFactor,
-                obs->rect.width - 2 * COLLISION_OFFSET * window->scaleFactor,
-                obs->rect.height - 2 * COLLISION_OFFSET * window->scaleFactor
+                dims.width,
+                dims.height
             };
 
-            if (obs->type == OBSTACLE_BIRD) {
-                obs->currentFrame = 0;
-                obs->frameTime = 0;
-            }
+            // Spawned after this tick's animation pass, so it has already played a tick
+            PlayAnimation(&state->animators[ANIMATOR_OBSTACLES + i], OBSTACLE_CLIPS[type], SIM_DT);
+            UpdateCollisionBounds(&obs->collisionRect, obs->rect, GetSpriteMask(GetObstacleSprite(state, i)));
             obs->hasPassedPlayer = false;
+            obs->nearestGap = BASE_RESOLUTION.y;
             break;
         }
     }
 }
 
-void SpawnMeteor(GameState* game, const WindowState* window) {
+static uint32_t MeteorAlphaTarget(int index) {
+    return TWEEN_TARGET(meteors) + index * sizeof(Meteor) + offsetof(Meteor, alpha);
+}
+
+// Strongest at the hit and dying away over `duration`; a new shake replaces
+// the one in progress.
+static void StartScreenShake(GameState* game, float intensity, float duration) {
+    StopTweens(&game->timeline, TWEEN_TARGET(screenShakeIntensity));
+    game->screenShakeIntensity = intensity;
+    StartTween(&game->timeline, (Tween){
+        .target = TWEEN_TARGET(screenShakeIntensity), .from = intensity, .to = 0.0f,
+        .duration = duration, .ease = EASE_IN_QUAD
+    });
+}
+
+void SpawnMeteor(GameState* game) {
     for (int i = 0; i < MAX_METEORS; i++) {
         if (!game->meteors[i].active) {
             Meteor* meteor = &game->meteors[i];
             meteor->active = true;
             meteor->state = METEOR_STATE_FALLING;
-            meteor->currentFrame = 0;
-            meteor->frameTime = 0;
+            PlayAnimation(&game->animators[ANIMATOR_METEORS + i], ANIM_CLIP_METEOR_FALL, SIM_DT);
             meteor->impactTime = 0;
+            meteor->alpha = 1.0f;
+            StopTweens(&game->timeline, MeteorAlphaTarget(i));
             meteor->hasDealtDamage = false; 
             
-            int spawnPattern = GetRandomValue(0, 2);
+            int spawnPattern = NextRandomValue(&game->rngState, 0, 2);
             switch (spawnPattern) {
                 case 0:
-                    meteor->position.x = window->width + GetRandomValue(50, 250);
-                    meteor->position.y = -GetRandomValue(100, 300);
+                    meteor->position.x = BASE_RESOLUTION.x + NextRandomValue(&game->rngState, 50, 250);
+                    meteor->position.y = -NextRandomValue(&game->rngState, 100, 300);
                     break;
                 case 1:
-                    meteor->position.x = window->width * 0.7f + GetRandomValue(-100, 100);
-                    meteor->position.y = -GetRandomValue(200, 400);
+                    meteor->position.x = BASE_RESOLUTION.x * 0.7f + NextRandomValue(&game->rngState, -100, 100);
+                    meteor->position.y = -NextRandomValue(&game->rngState, 200, 400);
                     break;
                 case 2:
-                    meteor->position.x = window->width + GetRandomValue(50, 150);
-                    meteor->position.y = -GetRandomValue(50, 150);
+                    meteor->position.x = BASE_RESOLUTION.x + NextRandomValue(&game->rngState, 50, 150);
+                    meteor->position.y = -NextRandomValue(&game->rngState, 50, 150);
                     break;
             }
-            float sizeVariation = GetRandomValue(100, 160);
+            float sizeVariation = NextRandomValue(&game->rngState, METEOR_MIN_SIZE, METEOR_MAX_SIZE);
             meteor->rect = (Rectangle){
                 meteor->position.x,
                 meteor->position.y,
@@ -164,23 +416,24 @@ void SpawnMeteor(GameState* game, const WindowState* window) {
     }
 }
 
-void UpdateMeteors(GameState* game, const WindowState* window, float deltaTime) {
+void UpdateMeteors(GameState* game, float deltaTime) {
     if (!game->isStoryMode || !game->bossActive || game->gameOver || game->gameWon) {
         return;
     }
     game->meteorSpawnTimer += deltaTime;
     if (game->meteorSpawnTimer >= game->nextMeteorSpawnTime) {
-        SpawnMeteor(game, window);
+        SpawnMeteor(game);
         game->meteorSpawnTimer = 0.0f;
-        game->nextMeteorSpawnTime = METEOR_SPAWN_INTERVAL_MIN + 
-            (METEOR_SPAWN_INTERVAL_MAX - METEOR_SPAWN_INTERVAL_MIN) * GetRandomValue(0, 100) / 100.0f;
+        const TuningParams* tuning = GetTuning();
+        game->nextMeteorSpawnTime = tuning->meteorSpawnIntervalMin +
+            (tuning->meteorSpawnIntervalMax - tuning->meteorSpawnIntervalMin) * NextRandomValue(&game->rngState, 0, 100) / 100.0f;
     }
-    float groundY = window->height - GROUND_HEIGHT * window->scaleFactor;
+    float groundY = BASE_RESOLUTION.y - GROUND_HEIGHT;
     bool bossJustDefeated = false;
+    unsigned grounded = 0; // meteors that were already lying on the ground
     for (int i = 0; i < MAX_METEORS; i++) {
         Meteor* meteor = &game->meteors[i];
         if (!meteor->active) continue;
-        meteor->frameTime += deltaTime;
         if (meteor->state == METEOR_STATE_FALLING) {
             meteor->position.x -= METEOR_FALL_SPEED_X * deltaTime;
             meteor->position.y += METEOR_FALL_SPEED_Y * deltaTime;
@@ -190,58 +443,62 @@ void UpdateMeteors(GameState* game, const WindowState* window, float deltaTime)
                 meteor->state = METEOR_STATE_IMPACT;
                 meteor->position.y = groundY - meteor->rect.height;
                 meteor->rect.y = meteor->position.y;
-                meteor->currentFrame = 0;
-                meteor->frameTime = 0;
-                game->screenShakeTimer = 0.3f;
-                game->screenShakeIntensity = 8.0f;
-                meteor->collisionRect = (Rectangle){
-                    meteor->position.x + 10,
-                    meteor->position.y + meteor->rect.height - 25,
-                    meteor->rect.width - 20,
-                    25
-                };
+                PlayAnimation(&game->animators[ANIMATOR_METEORS + i], ANIM_CLIP_METEOR_IMPACT, 0.0f);
+                StartScreenShake(game, 8.0f, 0.3f);
+                // Lies on the ground for a while, then fades out before it is dropped
+                StartTween(&game->timeline, (Tween){
+                    .target = MeteorAlphaTarget(i), .from = 1.0f, .to = 0.0f,
+                    .delay = METEOR_GROUND_LIFETIME, .duration = 3.0f, .ease = EASE_LINEAR
+                });
+                UpdateCollisionBounds(&meteor->collisionRect, meteor->rect, GetMeteorMask(game, i));
+                PushEffect(game, EFFECT_METEOR_IMPACT,
+                           (Vector2){ meteor->position.x + meteor->rect.width / 2, groundY }, meteor->rect.width);
 
                 PlayMeteorImpactSound(game);
             }
         } else if (meteor->state == METEOR_STATE_IMPACT) {
-            meteor->position.x -= OBSTACLE_SPEED * window->scaleFactor * deltaTime;
+            grounded |= 1u << i;
+            meteor->position.x -= GetTuning()->obstacleSpeed * deltaTime;
             meteor->rect.x = meteor->position.x;
-            meteor->collisionRect.x = meteor->position.x + 10;
-            if (!meteor->hasDealtDamage && (meteor->position.x + meteor->rect.width) < game->basePosition.x) {
-                if (game->bossHP > 0) {
-                    game->bossHP--;
-                    if (game->bossHP <= 0 && !game->gameWon) {
-                        game->bossHP = 0;
-                        bossJustDefeated = true;
-                    }
-                }
-                meteor->hasDealtDamage = true;
-            }
-            if (game->bossHP < 0) game->bossHP = 0;
-            if (meteor->impactTime < 1.0f) {
-                if (meteor->frameTime >= METEOR_ANIM_DELAY * 1.5f) {
-                    meteor->frameTime = 0;
-                    if (meteor->currentFrame < METEOR_IMPACT_FRAMES - 1) {
-                        meteor->currentFrame++;
-                    }
-                }
-            }
             meteor->impactTime += deltaTime;
             if (meteor->impactTime > METEOR_GROUND_LIFETIME) {
                 if (meteor->impactTime > METEOR_GROUND_LIFETIME + 3.0f) {
                     meteor->active = false;
+                    StopAnimation(&game->animators[ANIMATOR_METEORS + i]);
+                    StopTweens(&game->timeline, MeteorAlphaTarget(i));
                 }
             }
-            if (CheckCollisionRecs(game->rect, meteor->collisionRect)) {
-                if (game->bossHP > 1) {
-                    game->gameOver = true;
-                    break;
-                } else if (game->bossHP == 1 && !meteor->hasDealtDamage) {
+            UpdateCollisionBounds(&meteor->collisionRect, meteor->rect, GetMeteorMask(game, i));
+        }
+    }
+    // Grounded meteors damage the boss as they pass the dinos (who all share
+    // one x), then every dino is tested against them in meteor order
+    for (int i = 0; i < MAX_METEORS && !game->gameOver; i++) {
+        if (!(grounded & (1u << i))) continue;
+        Meteor* meteor = &game->meteors[i];
+        if (!meteor->hasDealtDamage && (meteor->position.x + meteor->rect.width) < game->players[0].basePosition.x) {
+            if (game->bossHP > 0) {
+                game->bossHP--;
+                RecordTelemetry(game->telemetry, game->tick, TELEMETRY_BOSS_DAMAGE, 0, game->bossHP);
+                if (game->bossHP <= 0 && !game->gameWon) {
                     game->bossHP = 0;
-                    meteor->hasDealtDamage = true;
                     bossJustDefeated = true;
                 }
             }
+            meteor->hasDealtDamage = true;
+        }
+        if (game->bossHP < 0) game->bossHP = 0;
+        unsigned hits = HitPlayers(game, meteor->collisionRect, GetMeteorMask(game, i), meteor->position);
+        for (int p = 0; hits; p++, hits >>= 1) {
+            if (!(hits & 1)) continue;
+            if (game->bossHP > 1) {
+                KnockOutPlayer(game, p, DEATH_METEOR, -1);
+            } else if (game->bossHP == 1 && !meteor->hasDealtDamage) {
+                game->bossHP = 0;
+                RecordTelemetry(game->telemetry, game->tick, TELEMETRY_BOSS_DAMAGE, 0, game->bossHP);
+                meteor->hasDealtDamage = true;
+                bossJustDefeated = true;
+            }
         }
     }
     if (bossJustDefeated && !game->gameWon) {
@@ -250,36 +507,67 @@ void UpdateMeteors(GameState* game, const WindowState* window, float deltaTime)
     }
 }
 
-void UpdateObstacles(GameState* state, const WindowState* window, float deltaTime) {
+// Tracks how close the dinos came to an obstacle and reports a near miss
+// once it is behind all of them.
+static void UpdateNearMiss(GameState* state, Obstacle* obs) {
+    if (obs->hasPassedPlayer) return;
+    const Rectangle* box = &obs->collisionRect;
+    bool passed = true;
+    for (int i = 0; i < state->playerCount; i++) {
+        const Player* player = &state->players[i];
+        if (!player->alive) continue;
+        if (box->x < player->rect.x + player->rect.width && box->x + box->width > player->rect.x) {
+            float above = box->y - (player->rect.y + player->rect.height);
+            float below = player->rect.y - (box->y + box->height);
+            float gap = fmaxf(above, below);
+            if (gap < obs->nearestGap) obs->nearestGap = gap;
+            passed = false;
+        } else if (box->x + box->width > player->rect.x) {
+            passed = false;
+        }
+    }
+    if (passed) {
+        obs->hasPassedPlayer = true;
+        if (obs->nearestGap < NEAR_MISS_DISTANCE) {
+            PushEffect(state, EFFECT_NEAR_MISS, (Vector2){ box->x + box->width, box->y }, box->width);
+        }
+    }
+}
+
+void UpdateObstacles(GameState* state, float deltaTime) {
     if (state->gameOver || state->gameWon) return;
-    if (!(state->isStoryMode && state->score >= PRE_BOSS_THRESHOLD)) {
-        state->obstacles.spawnTimer += deltaTime;
-        if (state->obstacles.spawnTimer >= state->obstacles.nextSpawnTime) {
-            SpawnObstacle(state, window);
-            state->obstacles.spawnTimer = 0.0f;
-            state->obstacles.nextSpawnTime = GetRandomValue(MIN_SPAWN_INTERVAL, MAX_SPAWN_INTERVAL);
+    ObstaclePool* pool = &state->obstacles;
+    if (state->tick >= (pool->chunk.index + 1) * SCHEDULE_CHUNK_TICKS) {
+        TakeObstacleChunk(state->scheduler, state->runSeed, pool->chunk.index + 1, &pool->chunk);
+        pool->nextSpawn = 0;
+    }
+    while (pool->nextSpawn < pool->chunk.count && pool->chunk.spawns[pool->nextSpawn].tick <= state->tick) {
+        if (!(state->isStoryMode && state->score >= GetTuning()->bossThresholdScore - PRE_BOSS_MARGIN)) {
+            SpawnObstacle(state, pool->chunk.spawns[pool->nextSpawn].type);
         }
+        pool->nextSpawn++;
     }
+    const float speed = GetTuning()->obstacleSpeed;
     for (int i = 0; i < MAX_OBSTACLES; i++) {
-        Obstacle* obs = &state->obstacles.obstacles[i];
-        if (obs->active) {
-            obs->rect.x -= OBSTACLE_SPEED * window->scaleFactor * deltaTime;
-            obs->collisionRect.x = obs->rect.x + COLLISION_OFFSET * window->scaleFactor;
-            if (obs->type == OBSTACLE_BIRD) {
-                obs->frameTime += deltaTime;
-                if (obs->frameTime >= BIRD_ANIM_DELAY) {
-                    obs->frameTime = 0;
-                    obs->currentFrame ^= 1;
-                }
-            }
-            if (obs->rect.x + obs->rect.width < 0) {
-                obs->active = false;
-            }
-            if (CheckCollisionRecs(state->rect, obs->collisionRect)) {
-                state->gameOver = true;
-                break;
-            }
+        Obstacle* obs = &pool->obstacles[i];
+        if (!obs->active) continue;
+        obs->rect.x -= speed * deltaTime;
+        UpdateCollisionBounds(&obs->collisionRect, obs->rect, GetSpriteMask(GetObstacleSprite(state, i)));
+        if (obs->rect.x + obs->rect.width < 0) {
+            obs->active = false;
+            StopAnimation(&state->animators[ANIMATOR_OBSTACLES + i]);
+        }
+    }
+    // The moved field against every dino in one pass
+    for (int i = 0; i < MAX_OBSTACLES && !state->gameOver; i++) {
+        Obstacle* obs = &pool->obstacles[i];
+        if (!obs->active) continue;
+        unsigned hits = HitPlayers(state, obs->collisionRect, GetSpriteMask(GetObstacleSprite(state, i)),
+                                   (Vector2){ obs->rect.x, obs->rect.y });
+        for (int p = 0; hits; p++, hits >>= 1) {
+            if (hits & 1) KnockOutPlayer(state, p, DEATH_OBSTACLE, obs->type);
         }
+        if (!state->gameOver) UpdateNearMiss(state, obs);
     }
 }
 
@@ -320,63 +608,56 @@ void UpdateClouds(GameState* game, const WindowState* window, float deltaTime) {
     }
 }
 
-void UpdateBossFight(GameState* game, WindowState* window, float deltaTime) {
+void UpdateBossFight(GameState* game, float deltaTime) {
     if (!game->isStoryMode || game->gameOver) return;
-    if (!game->bossActive && game->score >= BOSS_THRESHOLD_SCORE) {
+    if (!game->bossActive && game->score >= GetTuning()->bossThresholdScore) {
         game->bossActive = true;
-        game->screenShakeTimer = SCREEN_SHAKE_DURATION;
-        game->screenShakeIntensity = SCREEN_SHAKE_INTENSITY;
+        StartScreenShake(game, SCREEN_SHAKE_INTENSITY, SCREEN_SHAKE_DURATION);
         game->meteorSpawnTimer = 0.0f;
         game->nextMeteorSpawnTime = 0.3f;
     }
-    if (game->screenShakeTimer > 0) {
-        game->screenShakeTimer -= deltaTime;
-        if (game->screenShakeTimer <= 0) {
-            game->screenShakeIntensity = 0.0f;
-        }
-    }
     if (game->bossActive) {
-        UpdateMeteors(game, window, deltaTime);
+        UpdateMeteors(game, deltaTime);
+        UpdateBoss(game, deltaTime);
     }
 }
 
+static Rectangle FrameRect(SpriteId sprite) {
+    return (Rectangle){ 0, 0, ATLAS_SPRITES[sprite].frame.x, ATLAS_SPRITES[sprite].frame.y };
+}
+
+// Sets up everything the simulation needs without touching the GPU or the
+// audio device, so headless tools can run the game logic directly.
+void InitSimState(GameState* state, uint64_t seed) {
+    InitCollisionMasks();
+    state->runFrames[0] = FrameRect(SPRITE_RUN_1);
+    state->runFrames[1] = FrameRect(SPRITE_RUN_2);
+    state->crouchFrames[0] = FrameRect(SPRITE_CROUCH_1);
+    state->crouchFrames[1] = FrameRect(SPRITE_CROUCH_2);
+    state->runFrameHeight = state->runFrames[0].height;
+    state->crouchFrameHeight = state->crouchFrames[0].height;
+    state->isStoryMode = false;
+    state->playerCount = 1;
+    ResetSimState(state, seed);
+}
+
+// Through the render backend, so they work without a GPU as well
+void LoadGameTextures(GameState* state) {
+    state->spriteSheet = LoadGameTexture(ATLAS_PATH);
+    state->cloudTexture = LoadGameTexture("resources/clouds.png");
+    Image projectile = GenImageGradientRadial(4 * PROJECTILE_RADIUS, 4 * PROJECTILE_RADIUS, 0.4f,
+                                              (Color){ 200, 40, 30, 255 }, BLANK);
+    state->projectileTexture = LoadGameTextureFromImage(projectile);
+    UnloadImage(projectile);
+}
+
 void InitGameState(GameState* state) {
-    state->spriteSheet = LoadTexture("resources/sprite.png");
-    state->runFrames[0] = (Rectangle){ 1514, -4, 88, 94 };
-    state->runFrames[1] = (Rectangle){ 1602, -4, 88, 94 };
-    state->crouchFrames[0] = (Rectangle){ 1866, 34, 118, 60 };
-    state->crouchFrames[1] = (Rectangle){ 1984, 34, 118, 60 };
-    state->runFrameHeight = 94;
-    state->crouchFrameHeight = 60;
-    state->baseSize = (Vector2){88, 94};
-    state->currentFrame = 0;
-    state->frameTime = 0;
-    state->basePosition = (Vector2){BASE_RESOLUTION.x * 0.1f, BASE_RESOLUTION.y - GROUND_HEIGHT - state->runFrameHeight};
-    state->isJumpCharging = false;
-    state->jumpChargeTime = 0.0f;
-    state->score = 0;
-    state->scoreTimer = 0.0f;
-    InitObstacles(state);
-    state->gameOver = false;
+    LoadGameTextures(state);
+    InitSimState(state, NewRunSeed());
     state->highScore = LoadHighScore();
-    state->nightModeActive = false;
-    state->nightCycleTimer = 0.0f;
-    state->isNight = false;
-    state->dayCycleTimer = 0.0f;
-    state->lightMask = LoadRenderTexture(BASE_RESOLUTION.x, BASE_RESOLUTION.y);
-    state->nightAlpha = 0.0f;
-    state->isStoryMode = false;
-    state->bossActive = false;
-    state->bossHP = 10;
-    state->screenShakeTimer = 0.0f;
-    state->screenShakeIntensity = 0.0f;
-    state->hp = 100;
-    state->gameWon = false;
-    state->soundPlayed = false;
-    InitMeteors(state);
     InitSounds(state);
     InitClouds(state);
-    InitPauseMenu(state, &(WindowState){ .width = BASE_RESOLUTION.x, .height = BASE_RESOLUTION.y });
+    state->pauseMenu.isPaused = false;
 }
 
 void UpdateScore(GameState* game, float deltaTime) {
@@ -388,27 +669,157 @@ void UpdateScore(GameState* game, float deltaTime) {
     }
 }
 
-void UpdatePhysics(GameState* game, const WindowState* window, float deltaTime) {
-    if (game->isJumping) {
-        if (game->isJumpCharging && game->jumpChargeTime < MAX_JUMP_CHARGE_TIME) {
-            game->jumpChargeTime += deltaTime;
-            float chargeProgress = game->jumpChargeTime / MAX_JUMP_CHARGE_TIME;
-            float additionalForce = JUMP_CHARGE_FORCE * (1.0f - chargeProgress);
-            game->baseJumpVelocity += additionalForce * deltaTime * 60.0f;
+// One airborne step of the jump arc. The autopilot and the obstacle
+// scheduler call this too, so everyone agrees on how high the dino gets.
+void IntegrateJump(float* y, float* velocity, float* chargeTime, bool charging, float deltaTime) {
+    if (charging && *chargeTime < MAX_JUMP_CHARGE_TIME) {
+        *chargeTime += deltaTime;
+        float chargeProgress = *chargeTime / MAX_JUMP_CHARGE_TIME;
+        float additionalForce = JUMP_CHARGE_FORCE * (1.0f - chargeProgress);
+        *velocity += additionalForce * deltaTime * 60.0f;
+    }
+    *velocity += GRAVITY;
+    *y += *velocity;
+}
+
+void UpdatePhysics(GameState* game, float deltaTime) {
+    for (int i = 0; i < game->playerCount; i++) {
+        Player* player = &game->players[i];
+        if (!player->alive) continue;
+        if (player->isJumping) {
+            IntegrateJump(&player->basePosition.y, &player->baseJumpVelocity, &player->jumpChargeTime,
+                          player->isJumpCharging, deltaTime);
+            float baseGroundLevel = BASE_RESOLUTION.y - GROUND_HEIGHT -
+                (player->isCrouching ? game->crouchFrameHeight : game->runFrameHeight);
+            if (player->basePosition.y >= baseGroundLevel) {
+                PushEffect(game, EFFECT_LANDING,
+                           (Vector2){ player->basePosition.x + player->baseSize.x / 2, BASE_RESOLUTION.y - GROUND_HEIGHT },
+                           player->baseJumpVelocity);
+                player->basePosition.y = baseGroundLevel;
+                player->isJumping = false;
+                player->baseJumpVelocity = 0.0f;
+            }
+        }
+        player->rect.x = player->basePosition.x;
+        player->rect.y = player->basePosition.y;
+        player->rect.width = player->baseSize.x;
+        player->rect.height = player->baseSize.y;
+    }
+}
+
+// Steps every animator in one pass. A dino's box only follows its sprite
+// when the frame steps, so ducking mid-jump keeps the running box until then.
+void UpdateAnimation(GameState* game, float deltaTime) {
+    UpdateAnimators(game->animators, MAX_ANIMATORS, deltaTime);
+    for (int i = 0; i < game->playerCount; i++) {
+        if (game->animators[ANIMATOR_PLAYERS + i].stepped) {
+            game->players[i].baseSize = ATLAS_SPRITES[GetPlayerSprite(game, i)].frame;
         }
-        game->baseJumpVelocity += GRAVITY;
-        game->basePosition.y += game->baseJumpVelocity;
-        float baseGroundLevel = BASE_RESOLUTION.y - GROUND_HEIGHT - 
-            (game->isCrouching ? game->crouchFrameHeight : game->runFrameHeight);
-        if (game->basePosition.y >= baseGroundLevel) {
-            game->basePosition.y = baseGroundLevel;
-            game->isJumping = false;
-            game->baseJumpVelocity = 0.0f;
+    }
+}
+
+// Horizontal gap from a dino to the closest obstacle still ahead of it
+static int NearestObstacleGap(const GameState* game, const Player* player) {
+    float front = player->basePosition.x + player->baseSize.x;
+    float nearest = -1.0f;
+    for (int i = 0; i < MAX_OBSTACLES; i++) {
+        const Obstacle* obs = &game->obstacles.obstacles[i];
+        if (!obs->active || obs->rect.x + obs->rect.width < player->basePosition.x) continue;
+        float gap = fmaxf(0.0f, obs->rect.x - front);
+        if (nearest < 0.0f || gap < nearest) nearest = gap;
+    }
+    return (int)nearest;
+}
+
+void ApplyPlayerInput(GameState* game, int index, PlayerInput input) {
+    Player* player = &game->players[index];
+    Animator* animator = &game->animators[ANIMATOR_PLAYERS + index];
+    bool jumpHeld = (input & INPUT_JUMP) != 0;
+    bool wasJumpHeld = (player->prevInput & INPUT_JUMP) != 0;
+    bool wasCrouching = player->isCrouching;
+    player->isCrouching = (input & INPUT_CROUCH) != 0;
+    AnimClipId clip = player->isCrouching ? ANIM_CLIP_CROUCH : ANIM_CLIP_RUN;
+    if (player->isJumping && (player->isCrouching != wasCrouching)) {
+        SwitchAnimation(animator, clip);
+    }
+    if (!player->isJumping && (player->isCrouching != wasCrouching)) {
+        float newHeight = player->isCrouching ? game->crouchFrameHeight : game->runFrameHeight;
+        player->basePosition.y = BASE_RESOLUTION.y - GROUND_HEIGHT - newHeight;
+        PlayAnimation(animator, clip, 0.0f);
+        const Rectangle* newFrame = player->isCrouching ? &game->crouchFrames[0] : &game->runFrames[0];
+        player->baseSize.x = newFrame->width;
+        player->baseSize.y = newHeight;
+    }
+    if (!player->isJumping && !player->isCrouching) {
+        if (!wasJumpHeld && jumpHeld) {
+            player->isJumping = true;
+            player->isJumpCharging = true;
+            player->jumpChargeTime = 0.0f;
+            player->baseJumpVelocity = JUMP_FORCE;
+            RecordTelemetry(game->telemetry, game->tick, TELEMETRY_JUMP, 0, NearestObstacleGap(game, player));
+            PushEffect(game, EFFECT_JUMP,
+                       (Vector2){ player->basePosition.x + player->baseSize.x / 2, BASE_RESOLUTION.y - GROUND_HEIGHT }, 0.0f);
+
+            PlayJumpSound(game);
         }
     }
-    game->screenPosition.x = game->basePosition.x * window->scaleFactor;
-    game->screenPosition.y = game->basePosition.y * window->scaleFactor;
-    game->rect.x = game->screenPosition.x;
-    game->rect.y = game->screenPosition.y;
+    if (wasJumpHeld && !jumpHeld) {
+        player->isJumpCharging = false;
+    }
+    player->prevInput = input;
+    if (player->isCrouching && player->isJumping) {
+        player->baseJumpVelocity = FAST_FALL_VELOCITY;
+    }
+}
+
+static void EndNight(GameState* game, int tag) {
+    game->nightModeActive = false;
+    game->nightAlpha = 0.0f;
+    game->isNight = false;
+    RecordTelemetry(game->telemetry, game->tick, TELEMETRY_NIGHT, 0, 0);
+    game->dayCycleTimer = 0.0f;
+}
+
+// Night is a fade in, a hold and a fade out on the timeline; the last tween
+// hands the day back.
+void UpdateDayNight(GameState* game, float deltaTime) {
+    if (game->isNight) return;
+    game->dayCycleTimer += deltaTime;
+    if (game->score >= 200 && game->dayCycleTimer >= DAY_DURATION) {
+        game->nightModeActive = true;
+        RecordTelemetry(game->telemetry, game->tick, TELEMETRY_NIGHT, 1, 0);
+        game->nightAlpha = 0.0f;
+        game->isNight = true;
+        StartTween(&game->timeline, (Tween){
+            .target = TWEEN_TARGET(nightAlpha), .from = 0.0f, .to = 1.0f,
+            .duration = FADE_DURATION, .ease = EASE_LINEAR
+        });
+        StartTween(&game->timeline, (Tween){
+            .target = TWEEN_TARGET(nightAlpha), .from = 1.0f, .to = 0.0f,
+            .delay = FADE_DURATION + NIGHT_DURATION, .duration = FADE_DURATION, .ease = EASE_LINEAR,
+            .onComplete = EndNight
+        });
+    }
 }
 
+// One fixed-length simulation tick. All gameplay state lives in base
+// resolution coordinates, so the result only depends on the seed and the
+// input sequence, never on the window size or the render frame rate.
+void StepGame(GameState* game, PlayerInputs inputs) {
+    game->effectCount = 0;
+    if (game->gameOver) return;
+    for (int i = 0; i < game->playerCount; i++) {
+        if (game->players[i].alive) ApplyPlayerInput(game, i, (inputs >> (i * PLAYER_INPUT_BITS)) & PLAYER_INPUT_MASK);
+    }
+    UpdateAnimation(game, SIM_DT);
+    UpdatePhysics(game, SIM_DT);
+    UpdateScore(game, SIM_DT);
+    UpdateObstacles(game, SIM_DT);
+    UpdateBossFight(game, SIM_DT);
+    UpdateDayNight(game, SIM_DT);
+    UpdateTimeline(game, SIM_DT);
+    game->tick++;
+    if (game->gameOver) {
+        RecordTelemetry(game->telemetry, game->tick, TELEMETRY_RUN_END, game->gameWon, game->score);
+    }
+}
@@ -4,16 +4,33 @@
 #include <stdbool.h>
 
 void InitGameState(GameState* state);
+void LoadGameTextures(GameState* state);
+void InitSimState(GameState* state, uint64_t seed);
 void ResetGame(GameState* game);
-void UpdatePhysics(GameState* game, const WindowState* window, float deltaTime);
+void ResetSimState(GameState* game, uint64_t seed);
+void StepGame(GameState* game, PlayerInputs inputs);
+void SaveSimState(const GameState* game, SimSnapshot* snapshot);
+void RestoreSimState(GameState* game, const SimSnapshot* snapshot);
+uint64_t HashSimSnapshot(const SimSnapshot* snapshot);
+void PushEffect(GameState* game, EffectType type, Vector2 position, float size);
+void ApplyPlayerInput(GameState* game, int index, PlayerInput input);
+void IntegrateJump(float* y, float* velocity, float* chargeTime, bool charging, float deltaTime);
+void UpdatePhysics(GameState* game, float deltaTime);
+void UpdateAnimation(GameState* game, float deltaTime);
 void UpdateScore(GameState* game, float deltaTime);
-void UpdateObstacles(GameState* state, const WindowState* window, float deltaTime);
-void UpdateBossFight(GameState* game, WindowState* window, float deltaTime);
+void UpdateObstacles(GameState* state, float deltaTime);
+void UpdateBossFight(GameState* game, float deltaTime);
+void UpdateDayNight(GameState* game, float deltaTime);
 void InitObstacles(GameState* state);
 void InitMeteors(GameState* state);
-void SpawnObstacle(GameState* state, const WindowState* window);
-void SpawnMeteor(GameState* game, const WindowState* window);
-void UpdateMeteors(GameState* game, const WindowState* window, float deltaTime);
+void SpawnObstacle(GameState* state, ObstacleType type);
+void SpawnMeteor(GameState* game);
+void UpdateMeteors(GameState* game, float deltaTime);
+SpriteId GetPlayerSprite(const GameState* game, int index);
+int GetRaceWinner(const GameState* game);
+SpriteId GetObstacleSprite(const GameState* game, int index);
+SpriteId GetMeteorSprite(const GameState* game, int index);
+const CollisionMask* GetMeteorMask(const GameState* game, int index);
 void InitClouds(GameState* game);
 void SpawnCloud(GameState* game, const WindowState* window);
 void SpawnCloudAt(GameState* game, int index, float xPosition);
@@ -0,0 +1,70 @@
+#include "input.h"
+#include "raylib.h"
+#include "render.h"
+#include <time.h>
+
+double InputClock(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Only changes are queued. A full queue keeps the old sampled state, so
+// the change is retried on the next sample instead of being lost.
+void SampleInput(InputQueue* queue, PlayerInputs held) {
+    if (held == queue->sampled) return;
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    if (tail - head >= INPUT_QUEUE_CAPACITY) return;
+    queue->events[tail % INPUT_QUEUE_CAPACITY] = (InputEvent){ InputClock(), held };
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    queue->sampled = held;
+}
+
+// Everything queued so far happened before this tick: the tick sees the
+// latest held state plus any press made since the last tick, so a tap
+// released again before the tick still lands. `pressTime` gets the stamp
+// of the first such press, or 0.
+PlayerInputs TakeTickInput(InputQueue* queue, double* pressTime) {
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    PlayerInputs pressed = INPUT_NONE;
+    *pressTime = 0.0;
+    for (; head != tail; head++) {
+        const InputEvent* event = &queue->events[head % INPUT_QUEUE_CAPACITY];
+        PlayerInputs down = event->held & ~queue->held;
+        if (down && *pressTime == 0.0) *pressTime = event->time;
+        pressed |= down;
+        queue->held = event->held;
+    }
+    atomic_store_explicit(&queue->head, head, memory_order_release);
+    return queue->held | pressed;
+}
+
+// Call once the frame is on screen, with the stamp carried by the state
+// that was drawn; each press is measured once.
+void RecordPresent(InputQueue* queue, double inputTime) {
+    if (inputTime <= queue->lastPresented) return;
+    queue->lastPresented = inputTime;
+    queue->latencyMs[queue->latencyCount % INPUT_LATENCY_SAMPLES] = (InputClock() - inputTime) * 1000.0;
+    queue->latencyCount++;
+}
+
+void DrawInputLatency(const InputQueue* queue, int posX, int posY, int fontSize) {
+    int samples = queue->latencyCount < INPUT_LATENCY_SAMPLES ? queue->latencyCount : INPUT_LATENCY_SAMPLES;
+    if (samples == 0) {
+        RenderText("input to present: no presses yet", posX, posY, fontSize, DARKGRAY);
+        return;
+    }
+    float sum = 0.0f;
+    float worst = 0.0f;
+    for (int i = 0; i < samples; i++) {
+        sum += queue->latencyMs[i];
+        if (queue->latencyMs[i] > worst) worst = queue->latencyMs[i];
+    }
+    float last = queue->latencyMs[(queue->latencyCount - 1) % INPUT_LATENCY_SAMPLES];
+    // Measured from the sample; the press itself can be up to a frame older,
+    // waiting for the window system's next poll
+    RenderText(TextFormat("input to present %.1f ms, avg %.1f, worst %.1f (last %d presses) + up to %.1f ms poll",
+                          last, sum / samples, worst, samples, GetFrameTime() * 1000.0f), posX, posY, fontSize, DARKGRAY);
+}
@@ -0,0 +1,26 @@
+#ifndef INPUT_H
+#define INPUT_H
+#include "types.h"
+#include <stdatomic.h>
+
+// Single-producer/single-consumer: the main thread pushes every change in
+// held input (all players packed together) as it samples it, the sim thread
+// drains the queue right before each tick. The latency samples are main-thread only.
+struct InputQueue {
+    InputEvent events[INPUT_QUEUE_CAPACITY];
+    atomic_uint head;
+    atomic_uint tail;
+    PlayerInputs sampled;
+    PlayerInputs held;
+    float latencyMs[INPUT_LATENCY_SAMPLES];
+    int latencyCount;
+    double lastPresented;
+};
+
+double InputClock(void);
+void SampleInput(InputQueue* queue, PlayerInputs held);
+PlayerInputs TakeTickInput(InputQueue* queue, double* pressTime);
+void RecordPresent(InputQueue* queue, double inputTime);
+void DrawInputLatency(const InputQueue* queue, int posX, int posY, int fontSize);
+
+#endif
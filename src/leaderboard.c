@@ -0,0 +1,279 @@
+#include "leaderboard.h"
+#include <errno.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#define RETRY_MIN_SECONDS 2.0
+#define RETRY_MAX_SECONDS 120.0
+#define RESCAN_SECONDS 60.0
+#define SOCKET_TIMEOUT_SECONDS 3
+#define MAX_LINE 128
+#define MAX_BODY (LEADERBOARD_BATCH * 192 + 256)
+
+static double Now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Non-blocking for the caller: a full inbox (worker stuck on disk) drops
+// the record and counts it.
+void SubmitScore(LeaderboardClient* client, const ScoreRecord* record) {
+    if (!client) return;
+    pthread_mutex_lock(&client->lock);
+    if (client->inboxCount < LEADERBOARD_INBOX) {
+        client->inbox[client->inboxCount++] = *record;
+        pthread_cond_signal(&client->wake);
+    } else {
+        atomic_fetch_add(&client->dropped, 1);
+    }
+    pthread_mutex_unlock(&client->lock);
+}
+
+static void FormatRecord(char* line, size_t size, const ScoreRecord* record) {
+    snprintf(line, size, "%016llx %016llx %d %u %d %d\n", (unsigned long long)record->seed,
+             (unsigned long long)record->replayHash, record->score, record->ticks, record->storyMode, record->won);
+}
+
+static bool ParseRecord(const char* line, ScoreRecord* record) {
+    unsigned long long seed, hash;
+    int story, won;
+    if (sscanf(line, "%llx %llx %d %u %d %d", &seed, &hash, &record->score, &record->ticks, &story, &won) != 6) {
+        return false;
+    }
+    record->seed = seed;
+    record->replayHash = hash;
+    record->storyMode = story != 0;
+    record->won = won != 0;
+    return true;
+}
+
+static void AppendToQueue(const ScoreRecord* records, int count) {
+    if (count == 0) return;
+    mkdir(LEADERBOARD_DIRECTORY, 0755);
+    FILE* file = fopen(LEADERBOARD_QUEUE_FILE, "a");
+    if (!file) return;
+    char line[MAX_LINE];
+    for (int i = 0; i < count; i++) {
+        FormatRecord(line, sizeof(line), &records[i]);
+        fputs(line, file);
+    }
+    fclose(file);
+}
+
+// Oldest records first; returns how many were loaded into `batch`, and
+// the total left on disk through `total`.
+static int LoadQueue(ScoreRecord* batch, int capacity, int* total) {
+    *total = 0;
+    FILE* file = fopen(LEADERBOARD_QUEUE_FILE, "r");
+    if (!file) return 0;
+    char line[MAX_LINE];
+    int loaded = 0;
+    while (fgets(line, sizeof(line), file)) {
+        ScoreRecord record;
+        if (!ParseRecord(line, &record)) continue;
+        if (loaded < capacity) batch[loaded++] = record;
+        (*total)++;
+    }
+    fclose(file);
+    return loaded;
+}
+
+// Rewrites the queue without its first `count` records, via a temporary
+// file so a crash never leaves it half written
+static void DropQueueHead(int count) {
+    FILE* in = fopen(LEADERBOARD_QUEUE_FILE, "r");
+    if (!in) return;
+    FILE* out = fopen(LEADERBOARD_QUEUE_FILE ".tmp", "w");
+    if (!out) {
+        fclose(in);
+        return;
+    }
+    char line[MAX_LINE];
+    int skipped = 0;
+    while (fgets(line, sizeof(line), in)) {
+        ScoreRecord record;
+        if (!ParseRecord(line, &record)) continue;
+        if (skipped < count) {
+            skipped++;
+            continue;
+        }
+        fputs(line, out);
+    }
+    fclose(in);
+    fclose(out);
+    rename(LEADERBOARD_QUEUE_FILE ".tmp", LEADERBOARD_QUEUE_FILE);
+}
+
+static int Connect(const LeaderboardClient* client) {
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    struct addrinfo* addresses = NULL;
+    if (getaddrinfo(client->host, client->port, &hints, &addresses) != 0) return -1;
+    int fd = -1;
+    for (struct addrinfo* address = addresses; address; address = address->ai_next) {
+        fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) continue;
+        struct timeval timeout = { SOCKET_TIMEOUT_SECONDS, 0 };
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) break;
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(addresses);
+    return fd;
+}
+
+static bool SendAll(int fd, const char* data, size_t length) {
+    while (length > 0) {
+        ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) continue;
+        if (sent <= 0) return false;
+        data += sent;
+        length -= sent;
+    }
+    return true;
+}
+
+// One POST /scores with the whole batch; true on a 2xx answer. The
+// server ignores records it already has, so a batch whose answer got
+// lost is safe to send again.
+static bool PostScores(const LeaderboardClient* client, const ScoreRecord* records, int count) {
+    char body[MAX_BODY];
+    int length = snprintf(body, sizeof(body), "{\"machine\":\"%s\",\"scores\":[", client->machine);
+    for (int i = 0; i < count; i++) {
+        const ScoreRecord* record = &records[i];
+        length += snprintf(body + length, sizeof(body) - length,
+                           "%s{\"seed\":\"%016llx\",\"replay\":\"%016llx\",\"score\":%d,\"ticks\":%u,"
+                           "\"mode\":\"%s\",\"won\":%s}",
+                           i ? "," : "", (unsigned long long)record->seed, (unsigned long long)record->replayHash,
+                           record->score, record->ticks, record->storyMode ? "story" : "endless",
+                           record->won ? "true" : "false");
+    }
+    length += snprintf(body + length, sizeof(body) - length, "]}");
+
+    char head[256];
+    int headLength = snprintf(head, sizeof(head),
+                              "POST /scores HTTP/1.1\r\nHost: %s:%s\r\nContent-Type: application/json\r\n"
+                              "Content-Length: %d\r\nConnection: close\r\n\r\n",
+                              client->host, client->port, length);
+    int fd = Connect(client);
+    if (fd < 0) return false;
+    bool ok = SendAll(fd, head, headLength) && SendAll(fd, body, length);
+    char response[64] = "";
+    int status = 0;
+    if (ok) {
+        ssize_t received = recv(fd, response, sizeof(response) - 1, 0);
+        ok = received > 0 && sscanf(response, "HTTP/1.%*d %d", &status) == 1 && status >= 200 && status < 300;
+    }
+    close(fd);
+    return ok;
+}
+
+static void* LeaderboardWorker(void* arg) {
+    LeaderboardClient* client = arg;
+    ScoreRecord incoming[LEADERBOARD_INBOX];
+    ScoreRecord batch[LEADERBOARD_BATCH];
+    double backoff = RETRY_MIN_SECONDS;
+    double nextAttempt = Now();
+    bool backingOff = false;
+    for (;;) {
+        pthread_mutex_lock(&client->lock);
+        while (!client->stopping && client->inboxCount == 0 && Now() < nextAttempt) {
+            double wait = nextAttempt - Now();
+            struct timespec deadline;
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += (time_t)wait;
+            deadline.tv_nsec += (long)((wait - (time_t)wait) * 1e9);
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&client->wake, &client->lock, &deadline);
+        }
+        int count = client->inboxCount;
+        memcpy(incoming, client->inbox, count * sizeof(ScoreRecord));
+        client->inboxCount = 0;
+        bool stopping = client->stopping;
+        pthread_mutex_unlock(&client->lock);
+
+        AppendToQueue(incoming, count);
+        if (stopping) break;
+        if (count > 0 && !backingOff) nextAttempt = Now();
+        if (Now() < nextAttempt) continue;
+
+        int total;
+        int loaded = LoadQueue(batch, LEADERBOARD_BATCH, &total);
+        atomic_store(&client->queued, total);
+        if (loaded == 0) {
+            nextAttempt = Now() + RESCAN_SECONDS;
+            continue;
+        }
+        if (PostScores(client, batch, loaded)) {
+            DropQueueHead(loaded);
+            atomic_store(&client->queued, total - loaded);
+            atomic_fetch_add(&client->submitted, loaded);
+            backoff = RETRY_MIN_SECONDS;
+            backingOff = false;
+            nextAttempt = Now();
+        } else {
+            atomic_fetch_add(&client->failures, 1);
+            backingOff = true;
+            nextAttempt = Now() + backoff;
+            backoff = backoff * 2 < RETRY_MAX_SECONDS ? backoff * 2 : RETRY_MAX_SECONDS;
+        }
+    }
+    return NULL;
+}
+
+// `server` is "host:port"; NULL uses LEADERBOARD_DEFAULT_SERVER
+LeaderboardClient* StartLeaderboard(const char* server) {
+    if (!server) server = LEADERBOARD_DEFAULT_SERVER;
+    const char* colon = strrchr(server, ':');
+    if (!colon || colon == server || (size_t)(colon - server) >= sizeof(((LeaderboardClient*)0)->host)) return NULL;
+    LeaderboardClient* client = calloc(1, sizeof(LeaderboardClient));
+    if (!client) return NULL;
+    snprintf(client->host, sizeof(client->host), "%.*s", (int)(colon - server), server);
+    snprintf(client->port, sizeof(client->port), "%s", colon + 1);
+    if (gethostname(client->machine, sizeof(client->machine)) != 0) {
+        snprintf(client->machine, sizeof(client->machine), "unknown");
+    }
+    // Keep the JSON body valid whatever the host is called
+    for (char* c = client->machine; *c; c++) {
+        if (*c == '"' || *c == '\\' || (unsigned char)*c < 0x20) *c = '_';
+    }
+    pthread_mutex_init(&client->lock, NULL);
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&client->wake, &attributes);
+    pthread_condattr_destroy(&attributes);
+    if (pthread_create(&client->thread, NULL, LeaderboardWorker, client) != 0) {
+        pthread_cond_destroy(&client->wake);
+        pthread_mutex_destroy(&client->lock);
+        free(client);
+        return NULL;
+    }
+    return client;
+}
+
+// Whatever is still in the inbox goes to disk for the next session; a
+// post in flight can delay this by up to the socket timeout.
+void StopLeaderboard(LeaderboardClient* client) {
+    if (!client) return;
+    pthread_mutex_lock(&client->lock);
+    client->stopping = true;
+    pthread_cond_signal(&client->wake);
+    pthread_mutex_unlock(&client->lock);
+    pthread_join(client->thread, NULL);
+    pthread_cond_destroy(&client->wake);
+    pthread_mutex_destroy(&client->lock);
+    free(client);
+}
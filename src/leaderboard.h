@@ -0,0 +1,37 @@
+#ifndef LEADERBOARD_H
+#define LEADERBOARD_H
+#include "types.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#define LEADERBOARD_DEFAULT_SERVER "127.0.0.1:8787"
+#define LEADERBOARD_DIRECTORY "leaderboard"
+#define LEADERBOARD_QUEUE_FILE "leaderboard/queue.txt"
+
+// Finished runs are handed to a worker thread, which appends them to an
+// on-disk queue and posts them to the server in batches, backing off while
+// the server is unreachable. The queue survives restarts, so nothing is
+// lost when a cabinet is offline. The game side only ever takes a short
+// lock to drop a record into the inbox.
+typedef struct {
+    ScoreRecord inbox[LEADERBOARD_INBOX];
+    int inboxCount;
+    bool stopping;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t thread;
+    char host[128];
+    char port[16];
+    char machine[64];
+    atomic_int queued;
+    atomic_int submitted;
+    atomic_int failures;
+    atomic_int dropped;
+} LeaderboardClient;
+
+LeaderboardClient* StartLeaderboard(const char* server);
+void StopLeaderboard(LeaderboardClient* client);
+void SubmitScore(LeaderboardClient* client, const ScoreRecord* record);
+
+#endif
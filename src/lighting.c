@@ -0,0 +1,138 @@
+#include "lighting.h"
+#include "render.h"
+#include "softraster.h"
+
+// Night lighting: lights are added into a lightmap at 1/LIGHTMAP_SCALE of
+// the window, which is then stretched with bilinear filtering and
+// multiplied over the frame. Light falls off smoothly, so the low
+// resolution doesn't show, and it costs 1/16 of the fill of a full-size
+// mask.
+
+static SoftCanvas softLightmap;
+
+static int LightmapSize(int size) {
+    return size / LIGHTMAP_SCALE > 0 ? size / LIGHTMAP_SCALE : 1;
+}
+
+RenderTexture2D LoadLightmap(int width, int height) {
+    int lightmapWidth = LightmapSize(width);
+    int lightmapHeight = LightmapSize(height);
+    if (GetRenderBackend() == RENDER_BACKEND_SOFTWARE) {
+        // Only the size is kept; DrawLightmap() rasterizes into softLightmap,
+        // allocated here so nightfall doesn't reach the heap mid-run
+        InitSoftCanvas(&softLightmap, lightmapWidth, lightmapHeight);
+        return (RenderTexture2D){ .texture = { .width = lightmapWidth, .height = lightmapHeight } };
+    }
+    RenderTexture2D lightmap = LoadRenderTexture(lightmapWidth, lightmapHeight);
+    SetTextureFilter(lightmap.texture, TEXTURE_FILTER_BILINEAR);
+    return lightmap;
+}
+
+// Recreates the lightmap only when the window size changes what it needs
+void ResizeLightmap(RenderTexture2D* lightmap, int width, int height) {
+    if (lightmap->texture.width == LightmapSize(width) && lightmap->texture.height == LightmapSize(height)) return;
+    if (lightmap->id != 0) UnloadRenderTexture(*lightmap);
+    *lightmap = LoadLightmap(width, height);
+}
+
+static void AddLight(LightList* list, Vector2 center, float radius, Color color) {
+    if (list->count >= MAX_LIGHTS || color.a == 0) return;
+    list->lights[list->count++] = (Light){ center, radius, color };
+}
+
+// The dinos' lights go first so a busy boss fight can't crowd them out
+void CollectLights(LightList* list, const WindowState* window, const GameState* game, Vector2 shakeOffset) {
+    list->count = 0;
+    list->hidden = 0;
+    list->darkness = game->nightModeActive ? (unsigned char)(game->nightAlpha * NIGHT_ALPHA) : 0;
+    if (list->darkness == 0) return;
+    float scale = window->scaleFactor;
+    for (int i = 0; i < game->playerCount; i++) {
+        const Player* player = &game->players[i];
+        if (!player->alive && !game->gameOver) continue;
+        Vector2 center = {
+            (player->basePosition.x + player->rect.width / 2) * scale + shakeOffset.x,
+            (player->basePosition.y + player->rect.height / 2) * scale + shakeOffset.y
+        };
+        AddLight(list, center, (LIGHT_RADIUS + FADE_DISTANCE) * scale, WHITE);
+    }
+    if (!game->isStoryMode || !game->bossActive) return;
+
+    if (game->bossHP > 0) {
+        AddLight(list, (Vector2){ BOSS_ORIGIN_X * scale + shakeOffset.x, BOSS_ORIGIN_Y * scale + shakeOffset.y },
+                 BOSS_AURA_RADIUS * scale, (Color){ 150, 70, 220, 255 });
+    }
+    for (int i = 0; i < MAX_METEORS; i++) {
+        const Meteor* meteor = &game->meteors[i];
+        if (!meteor->active || meteor->state == METEOR_STATE_INACTIVE) continue;
+        Vector2 center = {
+            (meteor->rect.x + meteor->rect.width / 2) * scale + shakeOffset.x,
+            (meteor->rect.y + meteor->rect.height / 2) * scale + shakeOffset.y
+        };
+        float size = meteor->rect.width * scale;
+        if (meteor->state == METEOR_STATE_FALLING) {
+            AddLight(list, center, size * 1.2f, (Color){ 255, 140, 40, 255 });
+        } else if (meteor->impactTime < IMPACT_FLASH_TIME) {
+            float t = meteor->impactTime / IMPACT_FLASH_TIME;
+            AddLight(list, center, size * (1.5f + 2.0f * t), (Color){ 255, 230, 170, (unsigned char)(255 * (1.0f - t)) });
+        } else {
+            AddLight(list, center, size * 0.8f, (Color){ 200, 80, 20, (unsigned char)(160 * meteor->alpha) });
+        }
+    }
+}
+
+// True only when the night is fully dark and no light reaches `bounds`; the
+// sprite would come out black under the lightmap anyway. Lights are padded
+// by a lightmap texel for the bilinear blur.
+bool IsInDarkness(const LightList* list, Rectangle bounds) {
+    if (list->darkness < 255) return false;
+    for (int i = 0; i < list->count; i++) {
+        const Light* light = &list->lights[i];
+        if (CheckCollisionCircleRec(light->center, light->radius + LIGHTMAP_SCALE, bounds)) return false;
+    }
+    return true;
+}
+
+static void DrawSoftLightmap(const LightList* list, int width, int height, float scale) {
+    SoftCanvas* framebuffer = GetRenderFramebuffer();
+    if (!framebuffer) return;
+    if ((softLightmap.width != width || softLightmap.height != height) && !InitSoftCanvas(&softLightmap, width, height)) {
+        return;
+    }
+    unsigned char ambient = 255 - list->darkness;
+    SoftClear(&softLightmap, (Color){ ambient, ambient, ambient, 255 });
+    for (int i = 0; i < list->count; i++) {
+        const Light* light = &list->lights[i];
+        Color edge = { light->color.r, light->color.g, light->color.b, 0 };
+        SoftAddCircleGradient(&softLightmap, (Vector2){ (int)(light->center.x * scale), (int)(light->center.y * scale) },
+                              light->radius * scale, light->color, edge);
+    }
+    SoftMultiply(framebuffer, &softLightmap);
+}
+
+void DrawLightmap(const LightList* list, RenderTexture2D lightmap, const WindowState* window) {
+    unsigned char ambient = 255 - list->darkness;
+    float scale = (float)lightmap.texture.width / window->width;
+    if (GetRenderBackend() == RENDER_BACKEND_SOFTWARE) {
+        DrawSoftLightmap(list, lightmap.texture.width, lightmap.texture.height, scale);
+        return;
+    }
+    BeginTextureMode(lightmap);
+    ClearBackground((Color){ ambient, ambient, ambient, 255 });
+    BeginBlendMode(BLEND_ADDITIVE);
+    for (int i = 0; i < list->count; i++) {
+        const Light* light = &list->lights[i];
+        Color edge = { light->color.r, light->color.g, light->color.b, 0 };
+        DrawCircleGradient((int)(light->center.x * scale), (int)(light->center.y * scale),
+                           light->radius * scale, light->color, edge);
+    }
+    EndBlendMode();
+    EndTextureMode();
+
+    BeginBlendMode(BLEND_MULTIPLIED);
+    DrawTexturePro(lightmap.texture,
+                   (Rectangle){ 0, 0, lightmap.texture.width, -lightmap.texture.height },
+                   (Rectangle){ 0, 0, window->width, window->height },
+                   (Vector2){ 0, 0 }, 0.0f, WHITE);
+    EndBlendMode();
+}
@@ -0,0 +1,13 @@
+#ifndef LIGHTING_H
+#define LIGHTING_H
+#include "raylib.h"
+#include "types.h"
+#include <stdbool.h>
+
+RenderTexture2D LoadLightmap(int width, int height);
+void ResizeLightmap(RenderTexture2D* lightmap, int width, int height);
+void CollectLights(LightList* list, const WindowState* window, const GameState* game, Vector2 shakeOffset);
+bool IsInDarkness(const LightList* list, Rectangle bounds);
+void DrawLightmap(const LightList* list, RenderTexture2D lightmap, const WindowState* window);
+
+#endif
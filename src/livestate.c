@@ -0,0 +1,106 @@
+#include "livestate.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define LIVE_READ_RETRIES 4
+
+_Static_assert(ATOMIC_INT_LOCK_FREE == 2, "slot sequences must be lock-free to work across processes");
+
+static LiveState* MapLiveState(const char* name, bool writer) {
+    LiveState* live = calloc(1, sizeof(LiveState));
+    if (!live) return NULL;
+    live->writer = writer;
+    snprintf(live->name, sizeof(live->name), "%s", name);
+    live->fd = shm_open(name, writer ? O_CREAT | O_RDWR : O_RDONLY, 0644);
+    if (live->fd < 0 || (writer && ftruncate(live->fd, sizeof(LiveStateRegion)) != 0)) {
+        if (live->fd >= 0) close(live->fd);
+        free(live);
+        return NULL;
+    }
+    void* region = mmap(NULL, sizeof(LiveStateRegion), writer ? PROT_READ | PROT_WRITE : PROT_READ,
+                        MAP_SHARED, live->fd, 0);
+    if (region == MAP_FAILED) {
+        close(live->fd);
+        free(live);
+        return NULL;
+    }
+    live->region = region;
+    return live;
+}
+
+// A region left behind by a crashed run is reused, and its frame counter
+// carries on from where it was.
+LiveState* OpenLiveStateWriter(const char* name) {
+    LiveState* live = MapLiveState(name, true);
+    if (!live) return NULL;
+    LiveStateRegion* region = live->region;
+    if (region->magic != LIVE_STATE_MAGIC || region->version != LIVE_STATE_VERSION ||
+        region->frameSize != sizeof(LiveFrame)) {
+        memset(region, 0, sizeof(LiveStateRegion));
+        region->version = LIVE_STATE_VERSION;
+        region->slotCount = LIVE_RING_SLOTS;
+        region->frameSize = sizeof(LiveFrame);
+        atomic_thread_fence(memory_order_release);
+        region->magic = LIVE_STATE_MAGIC;
+    }
+    return live;
+}
+
+void WriteLiveFrame(LiveState* live, LiveFrame* frame) {
+    LiveStateRegion* region = live->region;
+    uint64_t number = atomic_load_explicit(&region->published, memory_order_relaxed);
+    LiveSlot* slot = &region->slots[number % LIVE_RING_SLOTS];
+    unsigned sequence = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+    frame->frame = number;
+    atomic_store_explicit(&slot->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&slot->frame, frame, sizeof(LiveFrame));
+    atomic_store_explicit(&slot->sequence, sequence + 2, memory_order_release);
+    atomic_store_explicit(&region->published, number + 1, memory_order_release);
+}
+
+// Fails until a game has created the region
+LiveState* OpenLiveStateReader(const char* name) {
+    LiveState* live = MapLiveState(name, false);
+    if (!live) return NULL;
+    const LiveStateRegion* region = live->region;
+    if (region->magic != LIVE_STATE_MAGIC || region->version != LIVE_STATE_VERSION ||
+        region->frameSize != sizeof(LiveFrame)) {
+        CloseLiveState(live);
+        return NULL;
+    }
+    return live;
+}
+
+// Frames written so far; the newest is LatestLiveFrame() - 1
+uint64_t LatestLiveFrame(const LiveState* live) {
+    return atomic_load_explicit(&live->region->published, memory_order_acquire);
+}
+
+// Copies frame `frame` out of the ring. False when it was never written or
+// the writer has already lapped it; a copy torn by a concurrent write is
+// retried a few times.
+bool ReadLiveFrame(const LiveState* live, uint64_t frame, LiveFrame* out) {
+    LiveSlot* slot = &live->region->slots[frame % LIVE_RING_SLOTS];
+    for (int attempt = 0; attempt < LIVE_READ_RETRIES; attempt++) {
+        unsigned before = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        if (before & 1) continue;
+        memcpy(out, &slot->frame, sizeof(LiveFrame));
+        atomic_thread_fence(memory_order_acquire);
+        unsigned after = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+        if (before == after) return out->frame == frame;
+    }
+    return false;
+}
+
+void CloseLiveState(LiveState* live) {
+    if (!live) return;
+    munmap(live->region, sizeof(LiveStateRegion));
+    close(live->fd);
+    if (live->writer) shm_unlink(live->name);
+    free(live);
+}
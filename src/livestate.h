@@ -0,0 +1,88 @@
+#ifndef LIVESTATE_H
+#define LIVESTATE_H
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Live game state in POSIX shared memory for overlays, bots and analytics
+// on the same machine. The game writes one frame per sim tick into a ring
+// of seqlocked slots; any number of readers map the region read-only and
+// never block the writer. Plain C with no raylib dependency, so tools can
+// include just this header and livestate.c.
+
+#define LIVE_STATE_NAME "/dinogame-live"
+#define LIVE_STATE_MAGIC 0x564C4944u
+#define LIVE_STATE_VERSION 1
+#define LIVE_RING_SLOTS 8
+#define LIVE_MAX_OBSTACLES 8
+#define LIVE_MAX_METEORS 16
+
+typedef enum {
+    LIVE_FLAG_GAME_OVER = 1 << 0,
+    LIVE_FLAG_GAME_WON = 1 << 1,
+    LIVE_FLAG_STORY = 1 << 2,
+    LIVE_FLAG_BOSS = 1 << 3,
+    LIVE_FLAG_JUMPING = 1 << 4,
+    LIVE_FLAG_CROUCHING = 1 << 5,
+    LIVE_FLAG_NIGHT = 1 << 6,
+    LIVE_FLAG_PAUSED = 1 << 7
+} LiveFlags;
+
+// Base-resolution (1600x900) coordinates; `kind` is the obstacle type or
+// meteor state from types.h
+typedef struct {
+    float x;
+    float y;
+    float width;
+    float height;
+    int32_t kind;
+} LiveEntity;
+
+typedef struct {
+    uint64_t frame;
+    uint64_t runSeed;
+    uint32_t tick;
+    uint32_t flags;
+    int32_t score;
+    int32_t highScore;
+    int32_t hp;
+    int32_t bossHP;
+    float playerVelocity;
+    int32_t projectileCount;
+    LiveEntity player;
+    int32_t obstacleCount;
+    int32_t meteorCount;
+    LiveEntity obstacles[LIVE_MAX_OBSTACLES];
+    LiveEntity meteors[LIVE_MAX_METEORS];
+} LiveFrame;
+
+// `sequence` is odd while the slot is being written
+typedef struct {
+    atomic_uint sequence;
+    LiveFrame frame;
+} LiveSlot;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t frameSize;
+    _Atomic uint64_t published;
+    LiveSlot slots[LIVE_RING_SLOTS];
+} LiveStateRegion;
+
+typedef struct {
+    int fd;
+    bool writer;
+    LiveStateRegion* region;
+    char name[64];
+} LiveState;
+
+LiveState* OpenLiveStateWriter(const char* name);
+void WriteLiveFrame(LiveState* live, LiveFrame* frame);
+LiveState* OpenLiveStateReader(const char* name);
+uint64_t LatestLiveFrame(const LiveState* live);
+bool ReadLiveFrame(const LiveState* live, uint64_t frame, LiveFrame* out);
+void CloseLiveState(LiveState* live);
+
+#endif
@@ -4,12 +4,12 @@
 #include "window.h"
 #include "game.h"
 #include "types.h"
+#include "simthread.h"
 #include <stdbool.h>
 
-void InitMenuButtons(WindowState* window);
+void LayoutMenus(WindowState* window);
 void DrawMenu(const WindowState* window);
 void DrawResolutionMenu(const WindowState* window);
-void HandlePauseMenuInput(WindowState* window, GameState* game);
-void InitPauseMenu(GameState* game, const WindowState* window);
+void HandlePauseMenuInput(WindowState* window, SimThread* sim);
 
 #endif
@@ -0,0 +1,420 @@
+#include "netplay.h"
+#include "game.h"
+#include "rng.h"
+#include "scheduler.h"
+#include "tuning.h"
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define NETPLAY_MAGIC 0x444E4554u // "DNET"
+#define HELLO_INTERVAL_SECONDS 0.25
+#define TIMEOUT_SECONDS 5.0
+#define SYNC_INTERVAL 20
+
+typedef enum {
+    PACKET_HELLO, // joiner -> host until the seed arrives; `checksum` is its tuning hash
+    PACKET_START, // host -> joiner: the seed
+    PACKET_INPUT, // every tick, both ways
+    PACKET_BYE
+} PacketType;
+
+// Sent as raw bytes: both ends run the same build, and a versus run needs
+// that anyway since the sim has to match bit for bit.
+typedef struct {
+    uint32_t magic;
+    uint8_t type;
+    uint8_t count;
+    int8_t advantage; // sender's frame minus the newest frame it heard from us
+    uint8_t unused;
+    uint32_t frame;
+    uint32_t start;   // tick of inputs[0]
+    uint32_t ack;     // sender has our inputs below this tick
+    uint32_t checkFrame;
+    uint64_t checksum;
+    uint64_t seed;
+    uint8_t inputs[NETPLAY_PACKET_INPUTS];
+} NetPacket;
+
+_Static_assert(sizeof(NetPacket) <= NETPLAY_MAX_PACKET, "packets must fit a conditioner slot");
+_Static_assert(NETPLAY_PACKET_INPUTS < 256, "the input count is one byte");
+
+static double Now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void SendNow(NetplaySession* session, const void* data, int length) {
+    sendto(session->socket, data, length, 0, (const struct sockaddr*)&session->peer, session->peerLength);
+}
+
+// The conditioner: drop with probability `loss`, otherwise hold the packet
+// for latency +- jitter. Jitter can reorder packets, like a real link.
+static void SendPacket(NetplaySession* session, const NetPacket* packet) {
+    if (!session->hasPeer) return;
+    if (session->loss > 0.0f && NextRandomFloat(&session->rngState) < session->loss) {
+        atomic_fetch_add(&session->dropped, 1);
+        return;
+    }
+    if (session->latencyMs <= 0 && session->jitterMs <= 0) {
+        SendNow(session, packet, sizeof(*packet));
+        return;
+    }
+    if (session->delayedCount == NETSIM_QUEUE_CAPACITY) {
+        atomic_fetch_add(&session->dropped, 1);
+        return;
+    }
+    int delayMs = session->latencyMs;
+    if (session->jitterMs > 0) delayMs += NextRandomValue(&session->rngState, -session->jitterMs, session->jitterMs);
+    DelayedPacket* delayed = &session->delayed[session->delayedCount++];
+    delayed->due = Now() + (delayMs > 0 ? delayMs : 0) / 1000.0;
+    delayed->length = sizeof(*packet);
+    memcpy(delayed->data, packet, sizeof(*packet));
+}
+
+static void FlushDelayed(NetplaySession* session, double now) {
+    int kept = 0;
+    for (int i = 0; i < session->delayedCount; i++) {
+        DelayedPacket* delayed = &session->delayed[i];
+        if (delayed->due <= now) SendNow(session, delayed->data, delayed->length);
+        else session->delayed[kept++] = *delayed;
+    }
+    session->delayedCount = kept;
+}
+
+static NetPacket MakePacket(const NetplaySession* session, PacketType type) {
+    return (NetPacket){ .magic = NETPLAY_MAGIC, .type = type, .frame = session->frame, .seed = session->seed };
+}
+
+// Compares our checksum for the tick the peer last reported, once we
+// have it; each tick is compared at most once.
+static void CompareChecksums(NetplaySession* session) {
+    uint32_t frame = session->remoteCheckFrame;
+    if (frame == 0 || frame <= session->comparedFrame) return;
+    int slot = (frame / NETPLAY_CHECKSUM_INTERVAL) % NETPLAY_CHECKSUM_RING;
+    if (session->checkFrames[slot] != frame) return;
+    session->comparedFrame = frame;
+    atomic_fetch_add(&session->checks, 1);
+    if (session->checksums[slot] != session->remoteChecksum) atomic_fetch_add(&session->desyncs, 1);
+}
+
+// A tick's snapshot is final once every input before it is confirmed, so
+// that is when it is hashed for the peer.
+static void UpdateChecksums(NetplaySession* session) {
+    if (session->nextCheckFrame == 0) session->nextCheckFrame = NETPLAY_CHECKSUM_INTERVAL;
+    uint32_t frame;
+    while ((frame = session->nextCheckFrame) <= session->remoteFrames && frame < session->frame) {
+        session->nextCheckFrame += NETPLAY_CHECKSUM_INTERVAL;
+        if (frame + ROLLBACK_SNAPSHOTS <= session->frame) continue;
+        int slot = (frame / NETPLAY_CHECKSUM_INTERVAL) % NETPLAY_CHECKSUM_RING;
+        session->checkFrames[slot] = frame;
+        session->checksums[slot] = HashSimSnapshot(&session->snapshots[frame % ROLLBACK_SNAPSHOTS]);
+    }
+    CompareChecksums(session);
+}
+
+static void ReceiveInputs(NetplaySession* session, const NetPacket* packet) {
+    for (int i = 0; i < packet->count && i < NETPLAY_PACKET_INPUTS; i++) {
+        uint32_t frame = packet->start + i;
+        if (frame != session->remoteFrames) continue; // already have it, or a gap
+        // Keep clear of ring slots a rollback may still read
+        if (frame >= session->frame + NETPLAY_INPUT_RING - ROLLBACK_SNAPSHOTS) break;
+        PlayerInput input = packet->inputs[i];
+        session->remoteInputs[frame % NETPLAY_INPUT_RING] = input;
+        if (frame < session->frame && input != session->predicted[frame % NETPLAY_INPUT_RING] &&
+            frame < session->rollbackFrame) {
+            session->rollbackFrame = frame;
+        }
+        session->remoteFrames++;
+    }
+    if (packet->ack > session->remoteAck) session->remoteAck = packet->ack;
+    if (packet->frame >= session->remoteFrame) {
+        session->remoteFrame = packet->frame;
+        session->remoteAdvantage = packet->advantage;
+    }
+    if (packet->checkFrame > session->remoteCheckFrame) {
+        session->remoteCheckFrame = packet->checkFrame;
+        session->remoteChecksum = packet->checksum;
+    }
+    CompareChecksums(session);
+}
+
+static void HandlePacket(NetplaySession* session, const NetPacket* packet) {
+    NetplayPhase phase = GetNetplayPhase(session);
+    if (phase == NETPLAY_DISCONNECTED) return;
+    switch (packet->type) {
+        case PACKET_HELLO: {
+            if (!session->hosting) return;
+            if (phase == NETPLAY_WAITING) atomic_store(&session->phase, NETPLAY_CONNECTED);
+            // Answered every time: the first START may have been lost
+            NetPacket start = MakePacket(session, PACKET_START);
+            SendPacket(session, &start);
+            return;
+        }
+        case PACKET_START:
+        case PACKET_INPUT:
+            if (!session->hosting && phase == NETPLAY_WAITING) {
+                session->seed = packet->seed;
+                atomic_store(&session->phase, NETPLAY_CONNECTED);
+            }
+            if (packet->type == PACKET_INPUT) ReceiveInputs(session, packet);
+            return;
+        case PACKET_BYE:
+            atomic_store(&session->phase, NETPLAY_DISCONNECTED);
+            return;
+    }
+}
+
+static bool SameAddress(const struct sockaddr_storage* a, socklen_t aLength,
+                        const struct sockaddr_storage* b, socklen_t bLength) {
+    return aLength == bLength && memcmp(a, b, aLength) == 0;
+}
+
+// Sends queued packets that are due, reads everything that arrived, and
+// keeps knocking until the host answers.
+void PollNetplay(NetplaySession* session) {
+    double now = Now();
+    FlushDelayed(session, now);
+    NetPacket packet;
+    struct sockaddr_storage from;
+    socklen_t fromLength = sizeof(from);
+    ssize_t length;
+    while ((length = recvfrom(session->socket, &packet, sizeof(packet), 0, (struct sockaddr*)&from, &fromLength)) >= 0) {
+        bool valid = length == sizeof(packet) && packet.magic == NETPLAY_MAGIC;
+        // A joiner with another tuning table could never stay in sync
+        if (valid && !session->hasPeer && session->hosting && packet.type == PACKET_HELLO &&
+            packet.checksum == HashTuning(GetTuning())) {
+            session->peer = from;
+            session->peerLength = fromLength;
+            session->hasPeer = true;
+        }
+        if (valid && session->hasPeer && SameAddress(&from, fromLength, &session->peer, session->peerLength)) {
+            session->lastHeard = now;
+            HandlePacket(session, &packet);
+        }
+        fromLength = sizeof(from);
+    }
+    NetplayPhase phase = GetNetplayPhase(session);
+    if (!session->hosting && phase == NETPLAY_WAITING && now - session->lastHello >= HELLO_INTERVAL_SECONDS) {
+        NetPacket hello = MakePacket(session, PACKET_HELLO);
+        hello.checksum = HashTuning(GetTuning());
+        SendPacket(session, &hello);
+        session->lastHello = now;
+    }
+    if ((phase == NETPLAY_CONNECTED || phase == NETPLAY_PLAYING) && now - session->lastHeard > TIMEOUT_SECONDS) {
+        atomic_store(&session->phase, NETPLAY_DISCONNECTED);
+    }
+}
+
+// The remote input for `frame`: the real one when it has arrived,
+// otherwise the newest one we have. What was used is remembered so a
+// late arrival can tell whether the guess was wrong.
+static PlayerInputs InputsFor(NetplaySession* session, uint32_t frame) {
+    PlayerInput remote = INPUT_NONE;
+    if (frame < session->remoteFrames) remote = session->remoteInputs[frame % NETPLAY_INPUT_RING];
+    else if (session->remoteFrames > 0) remote = session->remoteInputs[(session->remoteFrames - 1) % NETPLAY_INPUT_RING];
+    session->predicted[frame % NETPLAY_INPUT_RING] = remote;
+    PlayerInput local = session->localInputs[frame % NETPLAY_INPUT_RING];
+    int remotePlayer = 1 - session->localPlayer;
+    return (PlayerInputs)(local << (session->localPlayer * PLAYER_INPUT_BITS)) |
+           (PlayerInputs)(remote << (remotePlayer * PLAYER_INPUT_BITS));
+}
+
+// A finished race restarts once both dinos hold jump. The next course is
+// derived from the last seed, so both ends agree on it without talking.
+static void StepVersus(GameState* game, PlayerInputs inputs) {
+    if (!game->gameOver) {
+        StepGame(game, inputs);
+        return;
+    }
+    for (int i = 0; i < game->playerCount; i++) {
+        if (!((inputs >> (i * PLAYER_INPUT_BITS)) & INPUT_JUMP)) return;
+    }
+    uint64_t seed = game->runSeed;
+    ResetSimState(game, NextRandom(&seed));
+}
+
+static void Rollback(NetplaySession* session, GameState* game) {
+    double start = Now();
+    uint32_t from = session->rollbackFrame;
+    RestoreSimState(game, &session->snapshots[from % ROLLBACK_SNAPSHOTS]);
+    TelemetryLog* telemetry = game->telemetry;
+    game->telemetry = NULL;
+    game->resimulating = true;
+    for (uint32_t frame = from; frame < session->frame; frame++) {
+        if (frame > from) SaveSimState(game, &session->snapshots[frame % ROLLBACK_SNAPSHOTS]);
+        StepVersus(game, InputsFor(session, frame));
+    }
+    game->resimulating = false;
+    game->telemetry = telemetry;
+    int micros = (int)((Now() - start) * 1e6);
+    atomic_fetch_add(&session->rollbacks, 1);
+    atomic_fetch_add(&session->resimulated, (int)(session->frame - from));
+    if (micros > atomic_load(&session->worstRollbackUs)) atomic_store(&session->worstRollbackUs, micros);
+}
+
+static bool AdvanceNetplay(NetplaySession* session, GameState* game, PlayerInput input) {
+    if (session->rollbackFrame < session->frame) Rollback(session, game);
+    session->rollbackFrame = UINT32_MAX;
+    // Never guess further ahead than the snapshots reach
+    if (session->frame >= session->remoteFrames + ROLLBACK_MAX_FRAMES) {
+        atomic_fetch_add(&session->stalls, 1);
+        return false;
+    }
+    // Both ends see the same gap from opposite sides, so half the
+    // difference is how far ahead we really are; latency cancels out.
+    // The end in front idles a tick now and then instead of rolling back.
+    int advantage = (int)(session->frame - session->remoteFrame);
+    if (session->frame - session->lastSyncFrame >= SYNC_INTERVAL && advantage - session->remoteAdvantage >= 2) {
+        session->lastSyncFrame = session->frame;
+        atomic_fetch_add(&session->stalls, 1);
+        return false;
+    }
+    session->localInputs[(session->frame + NETPLAY_INPUT_DELAY) % NETPLAY_INPUT_RING] = input;
+    SaveSimState(game, &session->snapshots[session->frame % ROLLBACK_SNAPSHOTS]);
+    StepVersus(game, InputsFor(session, session->frame));
+    session->frame++;
+    UpdateChecksums(session);
+    return true;
+}
+
+// Every unacknowledged local input goes out every tick, so a lost packet
+// is covered by the next one instead of a resend.
+static void SendInputs(NetplaySession* session) {
+    uint32_t end = session->frame + NETPLAY_INPUT_DELAY;
+    uint32_t start = session->remoteAck < end ? session->remoteAck : end;
+    if (end - start > NETPLAY_PACKET_INPUTS) start = end - NETPLAY_PACKET_INPUTS;
+    int advantage = (int)(session->frame - session->remoteFrame);
+    NetPacket packet = MakePacket(session, PACKET_INPUT);
+    packet.count = (uint8_t)(end - start);
+    packet.advantage = (int8_t)(advantage > 127 ? 127 : (advantage < -127 ? -127 : advantage));
+    packet.start = start;
+    packet.ack = session->remoteFrames;
+    if (session->nextCheckFrame > NETPLAY_CHECKSUM_INTERVAL) {
+        uint32_t checkFrame = session->nextCheckFrame - NETPLAY_CHECKSUM_INTERVAL;
+        int slot = (checkFrame / NETPLAY_CHECKSUM_INTERVAL) % NETPLAY_CHECKSUM_RING;
+        if (session->checkFrames[slot] == checkFrame) {
+            packet.checkFrame = checkFrame;
+            packet.checksum = session->checksums[slot];
+        }
+    }
+    for (int i = 0; i < packet.count; i++) {
+        packet.inputs[i] = session->localInputs[(start + i) % NETPLAY_INPUT_RING];
+    }
+    SendPacket(session, &packet);
+}
+
+// One sim tick of a versus match: simulates it (unless paused, or too far
+// ahead of the peer) and sends our inputs either way, so the peer never
+// mistakes a pause for a dropped connection. True when the sim moved.
+bool TickNetplay(NetplaySession* session, GameState* game, PlayerInput input, bool stepping) {
+    if (!session->inMatch || GetNetplayPhase(session) != NETPLAY_PLAYING) return false;
+    bool stepped = stepping && AdvanceNetplay(session, game, input);
+    // A rematch reseeds the run inside the sim. The scheduler follows the
+    // seed here, after any rollback, so re-run ticks never move it.
+    if (stepped) FollowObstacleSeed(game->scheduler, game->runSeed, game->obstacles.chunk.index + 1);
+    SendInputs(session);
+    return stepped;
+}
+
+void BeginNetplayMatch(NetplaySession* session, GameState* game) {
+    game->playerCount = 2;
+    game->isStoryMode = false;
+    game->autopilotEnabled = false;
+    if (game->scheduler) StartObstacleScheduler(game->scheduler, session->seed);
+    ResetSimState(game, session->seed);
+    session->inMatch = true;
+    atomic_store(&session->phase, NETPLAY_PLAYING);
+}
+
+void LeaveNetplay(NetplaySession* session) {
+    if (session->hasPeer && GetNetplayPhase(session) != NETPLAY_DISCONNECTED) {
+        NetPacket bye = MakePacket(session, PACKET_BYE);
+        SendNow(session, &bye, sizeof(bye));
+    }
+    session->inMatch = false;
+    atomic_store(&session->phase, NETPLAY_DISCONNECTED);
+}
+
+NetplayPhase GetNetplayPhase(const NetplaySession* session) {
+    return (NetplayPhase)atomic_load(&session->phase);
+}
+
+static int OpenSocket(NetplaySession* session, const char* host, const char* port) {
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_DGRAM, .ai_flags = host ? 0 : AI_PASSIVE };
+    struct addrinfo* addresses = NULL;
+    if (getaddrinfo(host, port, &hints, &addresses) != 0) return -1;
+    int fd = -1;
+    for (struct addrinfo* address = addresses; address; address = address->ai_next) {
+        fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) continue;
+        if (!host && bind(fd, address->ai_addr, address->ai_addrlen) != 0) {
+            close(fd);
+            fd = -1;
+            continue;
+        }
+        if (host) {
+            memcpy(&session->peer, address->ai_addr, address->ai_addrlen);
+            session->peerLength = address->ai_addrlen;
+            session->hasPeer = true;
+        }
+        break;
+    }
+    freeaddrinfo(addresses);
+    if (fd >= 0) fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+// `address` is "listen" or "listen:PORT" to host, "HOST" or "HOST:PORT"
+// to join. `conditions` is "LATENCY_MS[,JITTER_MS[,LOSS_PERCENT]]" for the
+// outgoing side, or NULL for a clean link. NULL when not set or the
+// socket can't be opened.
+NetplaySession* StartNetplay(const char* address, const char* conditions) {
+    if (!address || !*address) return NULL;
+    char host[128];
+    const char* port = NETPLAY_DEFAULT_PORT;
+    const char* colon = strrchr(address, ':');
+    if (colon) {
+        if ((size_t)(colon - address) >= sizeof(host)) return NULL;
+        snprintf(host, sizeof(host), "%.*s", (int)(colon - address), address);
+        port = colon + 1;
+    } else {
+        snprintf(host, sizeof(host), "%s", address);
+    }
+    NetplaySession* session = calloc(1, sizeof(NetplaySession));
+    if (!session) return NULL;
+    session->snapshots = calloc(ROLLBACK_SNAPSHOTS, sizeof(SimSnapshot));
+    session->hosting = strcmp(host, "listen") == 0;
+    session->localPlayer = session->hosting ? 0 : 1;
+    session->socket = session->snapshots ? OpenSocket(session, session->hosting ? NULL : host, port) : -1;
+    if (session->socket < 0) {
+        free(session->snapshots);
+        free(session);
+        return NULL;
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    SeedRng(&session->rngState, ((uint64_t)time(NULL) << 32) ^ (uint64_t)ts.tv_nsec ^ (uint64_t)getpid());
+    if (session->hosting) session->seed = NextRandom(&session->rngState);
+    session->rollbackFrame = UINT32_MAX;
+    if (conditions) {
+        float lossPercent = 0.0f;
+        sscanf(conditions, "%d,%d,%f", &session->latencyMs, &session->jitterMs, &lossPercent);
+        session->loss = lossPercent / 100.0f;
+    }
+    atomic_store(&session->phase, NETPLAY_WAITING);
+    return session;
+}
+
+void StopNetplay(NetplaySession* session) {
+    if (!session) return;
+    LeaveNetplay(session);
+    close(session->socket);
+    free(session->snapshots);
+    free(session);
+}
@@ -0,0 +1,88 @@
+#ifndef NETPLAY_H
+#define NETPLAY_H
+#include "types.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <sys/socket.h>
+
+#define NETPLAY_DEFAULT_PORT "7777"
+#define NETPLAY_MAX_PACKET 128
+
+typedef enum {
+    NETPLAY_WAITING,      // host listening / joiner knocking
+    NETPLAY_CONNECTED,    // both ends know the seed; the match can start
+    NETPLAY_PLAYING,
+    NETPLAY_DISCONNECTED  // peer left or went quiet
+} NetplayPhase;
+
+// An outgoing packet held back by the network conditioner
+typedef struct {
+    double due;
+    int length;
+    unsigned char data[NETPLAY_MAX_PACKET];
+} DelayedPacket;
+
+// Two-player versus over UDP with input-only lockstep. Each end simulates
+// every tick straight away with the remote input predicted (the last one
+// received); when the real input arrives and differs, the sim is restored
+// from the snapshot of that tick and re-run up to the present, all within
+// the one tick. Only the sim thread touches a session, apart from `phase`
+// and the stats, which the HUD reads.
+struct NetplaySession {
+    int socket;
+    bool hosting;
+    int localPlayer; // the host is player one
+    struct sockaddr_storage peer;
+    socklen_t peerLength;
+    bool hasPeer;
+    atomic_int phase;
+    bool inMatch;
+    uint64_t seed;
+
+    uint32_t frame;          // next tick to simulate
+    uint32_t remoteFrames;   // remote inputs are known for ticks below this
+    uint32_t remoteAck;      // the peer has our inputs for ticks below this
+    uint32_t remoteFrame;    // the peer's `frame` when it last sent
+    int remoteAdvantage;     // how far ahead of us the peer thinks it is
+    uint32_t rollbackFrame;  // earliest mispredicted tick, or UINT32_MAX
+    uint32_t lastSyncFrame;
+    PlayerInput localInputs[NETPLAY_INPUT_RING];
+    PlayerInput remoteInputs[NETPLAY_INPUT_RING];
+    PlayerInput predicted[NETPLAY_INPUT_RING];
+    SimSnapshot* snapshots;  // ROLLBACK_SNAPSHOTS, the state before each tick
+
+    uint32_t checkFrames[NETPLAY_CHECKSUM_RING];
+    uint64_t checksums[NETPLAY_CHECKSUM_RING];
+    uint32_t nextCheckFrame;
+    uint32_t remoteCheckFrame;
+    uint64_t remoteChecksum;
+    uint32_t comparedFrame;
+
+    // Latency/jitter/loss applied to everything this end sends
+    int latencyMs;
+    int jitterMs;
+    float loss;
+    uint64_t rngState;
+    DelayedPacket delayed[NETSIM_QUEUE_CAPACITY];
+    int delayedCount;
+
+    double lastHeard;
+    double lastHello;
+    atomic_int rollbacks;
+    atomic_int resimulated;   // ticks re-run by rollbacks
+    atomic_int worstRollbackUs;
+    atomic_int stalls;        // ticks spent waiting for the peer
+    atomic_int checks;        // checksums compared with the peer
+    atomic_int desyncs;
+    atomic_int dropped;       // packets the conditioner threw away
+};
+
+NetplaySession* StartNetplay(const char* address, const char* conditions);
+void StopNetplay(NetplaySession* session);
+NetplayPhase GetNetplayPhase(const NetplaySession* session);
+void PollNetplay(NetplaySession* session);
+void BeginNetplayMatch(NetplaySession* session, GameState* game);
+bool TickNetplay(NetplaySession* session, GameState* game, PlayerInput input, bool stepping);
+void LeaveNetplay(NetplaySession* session);
+
+#endif
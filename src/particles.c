@@ -0,0 +1,253 @@
+#include "particles.h"
+#include "rng.h"
+#include "render.h"
+#include <math.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// Cosmetic particles. The sim only reports EffectEvents; everything here
+// runs on frame time with its own RNG, so it never touches a replay.
+
+#define PARTICLE_BATCH_QUADS 1024
+#define MAX_EFFECT_EMITTERS 2
+
+typedef struct {
+    ParticleTexture texture;
+    int count;
+    float minAngle;
+    float maxAngle;
+    float minSpeed;
+    float maxSpeed;
+    float minLifetime;
+    float maxLifetime;
+    float minSize;
+    float maxSize;
+    Vector2 spread;
+    Color color;
+} ParticleEmitter;
+
+// Angles are in degrees with y pointing down, so -90 is straight up
+static const ParticleEmitter EFFECT_EMITTERS[EFFECT_TYPE_COUNT][MAX_EFFECT_EMITTERS] = {
+    [EFFECT_JUMP] = {
+        { PARTICLE_TEXTURE_DUST, 24, -170, -110, 60, 220, 0.25f, 0.5f, 6, 14, { 20, 2 }, { 83, 83, 83, 180 } },
+    },
+    [EFFECT_LANDING] = {
+        { PARTICLE_TEXTURE_DUST, 48, -175, -5, 40, 200, 0.3f, 0.6f, 6, 16, { 30, 2 }, { 83, 83, 83, 200 } },
+    },
+    [EFFECT_METEOR_IMPACT] = {
+        { PARTICLE_TEXTURE_DUST, 1400, -180, 0, 80, 520, 0.6f, 1.6f, 8, 24, { 50, 6 }, { 90, 80, 70, 220 } },
+        { PARTICLE_TEXTURE_SPARK, 600, -160, -20, 300, 950, 0.35f, 0.9f, 3, 6, { 30, 4 }, { 255, 170, 40, 255 } },
+    },
+    [EFFECT_NEAR_MISS] = {
+        { PARTICLE_TEXTURE_SPARK, 90, -150, -30, 150, 450, 0.2f, 0.45f, 3, 5, { 6, 6 }, { 255, 220, 80, 255 } },
+    },
+    [EFFECT_PROJECTILE_SPLASH] = {
+        { PARTICLE_TEXTURE_DUST, 10, -160, -20, 40, 160, 0.2f, 0.4f, 4, 9, { 4, 1 }, { 120, 60, 50, 160 } },
+    },
+    [EFFECT_PROJECTILE_HIT] = {
+        { PARTICLE_TEXTURE_SPARK, 60, -180, 180, 120, 380, 0.2f, 0.4f, 3, 5, { 4, 4 }, { 230, 50, 40, 255 } },
+    },
+};
+
+// How much bigger than the table entry an event is: meteors by size,
+// landings by how hard the dino came down.
+static float EffectScale(EffectType type, float size) {
+    switch (type) {
+        case EFFECT_METEOR_IMPACT: return size / METEOR_MAX_SIZE;
+        case EFFECT_LANDING: return fminf(2.0f, fmaxf(0.5f, size / 10.0f));
+        default: return 1.0f;
+    }
+}
+
+static float RandomRange(uint64_t* rng, float min, float max) {
+    return min + (max - min) * NextRandomFloat(rng);
+}
+
+ParticleSystem* CreateParticleSystem(void) {
+    ParticleSystem* system = calloc(1, sizeof(ParticleSystem));
+    if (!system) return NULL;
+    system->pools[PARTICLE_TEXTURE_DUST].gravity = 300.0f;
+    system->pools[PARTICLE_TEXTURE_DUST].drag = 2.5f;
+    system->pools[PARTICLE_TEXTURE_SPARK].gravity = 1400.0f;
+    system->pools[PARTICLE_TEXTURE_SPARK].drag = 0.5f;
+    system->emitScale = 1.0f;
+    SeedRng(&system->rngState, (uint64_t)time(NULL));
+    return system;
+}
+
+void LoadParticleTextures(ParticleSystem* system) {
+    Image dust = GenImageGradientRadial(16, 16, 0.0f, WHITE, BLANK);
+    system->pools[PARTICLE_TEXTURE_DUST].texture = LoadGameTextureFromImage(dust);
+    UnloadImage(dust);
+    Image spark = GenImageColor(4, 4, WHITE);
+    system->pools[PARTICLE_TEXTURE_SPARK].texture = LoadGameTextureFromImage(spark);
+    UnloadImage(spark);
+}
+
+void DestroyParticleSystem(ParticleSystem* system) {
+    if (!system) return;
+    for (int p = 0; p < PARTICLE_TEXTURE_COUNT; p++) {
+        UnloadGameTexture(system->pools[p].texture);
+    }
+    free(system);
+}
+
+void ClearParticles(ParticleSystem* system) {
+    for (int p = 0; p < PARTICLE_TEXTURE_COUNT; p++) {
+        system->pools[p].count = 0;
+    }
+}
+
+static int EmitBurst(ParticleSystem* system, const ParticleEmitter* emitter, Vector2 position, int count) {
+    ParticlePool* pool = &system->pools[emitter->texture];
+    int room = PARTICLE_POOL_CAPACITY - pool->count;
+    int emitted = count < room ? count : room;
+    system->pendingDropped += count - emitted;
+    system->pendingSpawned += emitted;
+    uint64_t* rng = &system->rngState;
+    for (int n = 0; n < emitted; n++) {
+        int i = pool->count++;
+        float angle = RandomRange(rng, emitter->minAngle, emitter->maxAngle) * DEG2RAD;
+        float speed = RandomRange(rng, emitter->minSpeed, emitter->maxSpeed);
+        pool->x[i] = position.x + RandomRange(rng, -emitter->spread.x, emitter->spread.x);
+        pool->y[i] = position.y + RandomRange(rng, -emitter->spread.y, emitter->spread.y);
+        pool->vx[i] = cosf(angle) * speed;
+        pool->vy[i] = sinf(angle) * speed;
+        pool->life[i] = 1.0f;
+        pool->fade[i] = 1.0f / RandomRange(rng, emitter->minLifetime, emitter->maxLifetime);
+        pool->size[i] = RandomRange(rng, emitter->minSize, emitter->maxSize);
+        pool->color[i] = emitter->color;
+    }
+    return emitted;
+}
+
+int EmitEffect(ParticleSystem* system, EffectType type, Vector2 position, float size) {
+    int emitted = 0;
+    float scale = EffectScale(type, size) * system->emitScale;
+    for (int e = 0; e < MAX_EFFECT_EMITTERS; e++) {
+        const ParticleEmitter* emitter = &EFFECT_EMITTERS[type][e];
+        if (emitter->count == 0) continue;
+        emitted += EmitBurst(system, emitter, position, (int)ceilf(emitter->count * scale));
+    }
+    return emitted;
+}
+
+typedef float ParticleLane __attribute__((vector_size(16)));
+typedef int32_t ParticleMask __attribute__((vector_size(16)));
+#define PARTICLE_LANE_WIDTH (int)(sizeof(ParticleLane) / sizeof(float))
+_Static_assert(PARTICLE_POOL_CAPACITY % 4 == 0, "particle pools must hold whole lanes");
+
+// Four particles per step with GCC/Clang vector extensions, so it stays
+// SIMD whatever the optimisation level. The pools are sized in whole
+// lanes, and the slack past `count` is never read back. Dead particles are
+// swap-removed afterwards so the live ones stay packed.
+static void IntegratePool(ParticlePool* pool, float deltaTime) {
+    float* restrict x = pool->x;
+    float* restrict y = pool->y;
+    float* restrict vx = pool->vx;
+    float* restrict vy = pool->vy;
+    float* restrict life = pool->life;
+    float* restrict fade = pool->fade;
+    const ParticleLane damping = (ParticleLane){} + fmaxf(0.0f, 1.0f - pool->drag * deltaTime);
+    const ParticleLane fall = (ParticleLane){} + pool->gravity * deltaTime;
+    const ParticleLane groundY = (ParticleLane){} + (BASE_RESOLUTION.y - GROUND_HEIGHT);
+    const ParticleLane dt = (ParticleLane){} + deltaTime;
+    int count = pool->count;
+    for (int i = 0; i < count; i += PARTICLE_LANE_WIDTH) {
+        ParticleLane px, py, pvx, pvy, plife, pfade;
+        memcpy(&px, x + i, sizeof px);
+        memcpy(&py, y + i, sizeof py);
+        memcpy(&pvx, vx + i, sizeof pvx);
+        memcpy(&pvy, vy + i, sizeof pvy);
+        memcpy(&plife, life + i, sizeof plife);
+        memcpy(&pfade, fade + i, sizeof pfade);
+        pvx *= damping;
+        pvy = pvy * damping + fall;
+        px += pvx * dt;
+        py += pvy * dt;
+        ParticleMask above = py < groundY;
+        py = (ParticleLane)(((ParticleMask)py & above) | ((ParticleMask)groundY & ~above));
+        plife -= pfade * dt;
+        memcpy(x + i, &px, sizeof px);
+        memcpy(y + i, &py, sizeof py);
+        memcpy(vx + i, &pvx, sizeof pvx);
+        memcpy(vy + i, &pvy, sizeof pvy);
+        memcpy(life + i, &plife, sizeof plife);
+    }
+    for (int i = 0; i < count;) {
+        if (life[i] > 0.0f) {
+            i++;
+            continue;
+        }
+        count--;
+        x[i] = x[count];
+        y[i] = y[count];
+        vx[i] = vx[count];
+        vy[i] = vy[count];
+        life[i] = life[count];
+        fade[i] = fade[count];
+        pool->size[i] = pool->size[count];
+        pool->color[i] = pool->color[count];
+    }
+    pool->count = count;
+}
+
+// Emission is throttled when the last frame's update and draw went over
+// PARTICLE_FRAME_BUDGET_MS, and recovers slowly once there is room again.
+void UpdateParticles(ParticleSystem* system, float deltaTime) {
+    double start = GetTime();
+    int live = 0;
+    for (int p = 0; p < PARTICLE_TEXTURE_COUNT; p++) {
+        IntegratePool(&system->pools[p], deltaTime);
+        live += system->pools[p].count;
+    }
+    system->stats.live = live;
+    system->stats.spawned = system->pendingSpawned;
+    system->stats.dropped = system->pendingDropped;
+    system->pendingSpawned = 0;
+    system->pendingDropped = 0;
+    system->stats.updateMs = (float)((GetTime() - start) * 1000.0);
+
+    float frameMs = system->stats.updateMs + system->stats.drawMs;
+    if (frameMs > PARTICLE_FRAME_BUDGET_MS) {
+        system->emitScale = fmaxf(0.1f, system->emitScale * 0.8f);
+    } else {
+        system->emitScale = fminf(1.0f, system->emitScale + 0.02f);
+    }
+}
+
+// One quad batch per pool, so each texture is a single rlBegin/rlEnd run
+// instead of a DrawTexturePro() call per particle.
+void DrawParticles(ParticleSystem* system, const WindowState* window, Vector2 shakeOffset) {
+    double start = GetTime();
+    float scale = window->scaleFactor;
+    for (int p = 0; p < PARTICLE_TEXTURE_COUNT; p++) {
+        const ParticlePool* pool = &system->pools[p];
+        if (pool->count == 0 || pool->texture.id == 0) continue;
+        for (int first = 0; first < pool->count; first += PARTICLE_BATCH_QUADS) {
+            int last = first + PARTICLE_BATCH_QUADS < pool->count ? first + PARTICLE_BATCH_QUADS : pool->count;
+            BeginRenderQuads(pool->texture, last - first);
+            for (int i = first; i < last; i++) {
+                Color color = pool->color[i];
+                color.a = (unsigned char)(color.a * pool->life[i]);
+                RenderQuad(pool->x[i] * scale + shakeOffset.x, pool->y[i] * scale + shakeOffset.y,
+                           pool->size[i] * scale * 0.5f, color);
+            }
+            EndRenderQuads();
+        }
+    }
+    system->stats.drawMs = (float)((GetTime() - start) * 1000.0);
+}
+
+void DrawParticleStats(const ParticleSystem* system, int posX, int posY, int fontSize) {
+    const ParticleStats* stats = &system->stats;
+    float frameMs = stats->updateMs + stats->drawMs;
+    Color color = frameMs > PARTICLE_FRAME_BUDGET_MS ? RED : DARKGRAY;
+    RenderText(TextFormat("particles %d live, +%d, %d dropped", stats->live, stats->spawned, stats->dropped),
+             posX, posY, fontSize, color);
+    RenderText(TextFormat("update %.2f ms  draw %.2f ms  budget %.1f ms  emit %d%%", stats->updateMs, stats->drawMs,
+                        PARTICLE_FRAME_BUDGET_MS, (int)(system->emitScale * 100)),
+             posX, posY + fontSize + 4, fontSize, color);
+}
@@ -0,0 +1,15 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+#include "raylib.h"
+#include "types.h"
+
+ParticleSystem* CreateParticleSystem(void);
+void LoadParticleTextures(ParticleSystem* system);
+void DestroyParticleSystem(ParticleSystem* system);
+void ClearParticles(ParticleSystem* system);
+int EmitEffect(ParticleSystem* system, EffectType type, Vector2 position, float size);
+void UpdateParticles(ParticleSystem* system, float deltaTime);
+void DrawParticles(ParticleSystem* system, const WindowState* window, Vector2 shakeOffset);
+void DrawParticleStats(const ParticleSystem* system, int posX, int posY, int fontSize);
+
+#endif
@@ -0,0 +1,359 @@
+#include "render.h"
+#include "softraster.h"
+#include "arena.h"
+#include "rlgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Per-frame command list. Everything DrawGame() wants on screen is queued
+// into an ordered layer; off-screen and invisible commands are dropped as
+// they are queued, and at submit time a full-screen opaque command (a
+// clear, or a rect covering the window) hides every command beneath it,
+// so overlay screens no longer pay for the world they cover.
+
+static const char* LAYER_NAMES[RENDER_LAYER_COUNT] = {
+    "sky", "ground", "world", "effects", "lighting", "hud", "overlay", "screen"
+};
+
+void BeginRenderList(RenderList* list, const WindowState* window, Vector2 shakeOffset) {
+    list->count = 0;
+    list->screen = (Rectangle){ 0, 0, window->width, window->height };
+    list->shakeOffset = shakeOffset;
+    memset(&list->building, 0, sizeof(list->building));
+}
+
+static RenderCommand* AddCommand(RenderList* list, RenderCommandType type, RenderLayer layer) {
+    if (list->count >= MAX_RENDER_COMMANDS) return NULL;
+    RenderCommand* command = &list->commands[list->count++];
+    command->type = type;
+    command->layer = layer;
+    return command;
+}
+
+// Drops what cannot show up: fully transparent, or entirely outside the window
+static bool Cull(RenderList* list, RenderLayer layer, Rectangle dest, Color color) {
+    if (color.a == 0 || dest.width <= 0 || dest.height <= 0 || !CheckCollisionRecs(dest, list->screen)) {
+        list->building.culled[layer]++;
+        return true;
+    }
+    return false;
+}
+
+static bool IsOccluder(const RenderList* list, const RenderCommand* command) {
+    if (command->color.a != 255) return false;
+    if (command->type == RENDER_COMMAND_CLEAR) return true;
+    if (command->type != RENDER_COMMAND_RECT) return false;
+    return command->dest.x <= 0 && command->dest.y <= 0 &&
+           command->dest.x + command->dest.width >= list->screen.width &&
+           command->dest.y + command->dest.height >= list->screen.height;
+}
+
+void PushClear(RenderList* list, RenderLayer layer, Color color) {
+    RenderCommand* command = AddCommand(list, RENDER_COMMAND_CLEAR, layer);
+    if (!command) return;
+    command->dest = list->screen;
+    command->color = color;
+}
+
+void PushSprite(RenderList* list, RenderLayer layer, Texture2D texture, Rectangle source, Rectangle dest, Color tint) {
+    if (Cull(list, layer, dest, tint)) return;
+    RenderCommand* command = AddCommand(list, RENDER_COMMAND_SPRITE, layer);
+    if (!command) return;
+    command->texture = texture;
+    command->source = source;
+    command->dest = dest;
+    command->color = tint;
+}
+
+void PushRect(RenderList* list, RenderLayer layer, Rectangle rect, Color color) {
+    if (Cull(list, layer, rect, color)) return;
+    RenderCommand* command = AddCommand(list, RENDER_COMMAND_RECT, layer);
+    if (!command) return;
+    command->dest = rect;
+    command->color = color;
+}
+
+void PushText(RenderList* list, RenderLayer layer, const char* text, int posX, int posY, int fontSize, Color color) {
+    Rectangle dest = { posX, posY, MeasureRenderText(text, fontSize), fontSize };
+    if (Cull(list, layer, dest, color)) return;
+    // TextFormat() recycles its buffers, so the string is copied now
+    const char* copy = FrameCopyText(text);
+    if (!copy) return;
+    RenderCommand* command = AddCommand(list, RENDER_COMMAND_TEXT, layer);
+    if (!command) return;
+    command->text = copy;
+    command->dest = dest;
+    command->fontSize = fontSize;
+    command->color = color;
+}
+
+// For batches that cull themselves (particles, projectiles) and passes
+// that need their own render state (the night mask)
+void PushCustom(RenderList* list, RenderLayer layer, RenderCallback callback) {
+    RenderCommand* command = AddCommand(list, RENDER_COMMAND_CUSTOM, layer);
+    if (!command) return;
+    command->callback = callback;
+    command->color = BLANK;
+}
+
+static void RunCommand(const RenderList* list, const RenderCommand* command, const WindowState* window,
+                       const GameState* game) {
+    switch (command->type) {
+        case RENDER_COMMAND_CLEAR:
+            RenderClear(command->color);
+            break;
+        case RENDER_COMMAND_SPRITE:
+            RenderSprite(command->texture, command->source, command->dest, command->color);
+            break;
+        case RENDER_COMMAND_RECT:
+            RenderRect(command->dest, command->color);
+            break;
+        case RENDER_COMMAND_TEXT:
+            RenderText(command->text, command->dest.x, command->dest.y, command->fontSize, command->color);
+            break;
+        case RENDER_COMMAND_CUSTOM:
+            command->callback(window, game, list->shakeOffset);
+            break;
+    }
+}
+
+// Orders the commands by layer (stable, so queue order holds within a
+// layer), skips everything under the topmost occluder and draws the rest.
+void SubmitRenderList(RenderList* list, const WindowState* window, const GameState* game) {
+    uint16_t order[MAX_RENDER_COMMANDS];
+    int layerStart[RENDER_LAYER_COUNT + 1] = {0};
+    for (int i = 0; i < list->count; i++) layerStart[list->commands[i].layer + 1]++;
+    for (int layer = 0; layer < RENDER_LAYER_COUNT; layer++) layerStart[layer + 1] += layerStart[layer];
+    for (int i = 0; i < list->count; i++) order[layerStart[list->commands[i].layer]++] = i;
+
+    int first = 0;
+    for (int k = list->count - 1; k >= 0; k--) {
+        if (IsOccluder(list, &list->commands[order[k]])) {
+            first = k;
+            break;
+        }
+    }
+    for (int k = 0; k < first; k++) {
+        list->building.occluded[list->commands[order[k]].layer]++;
+    }
+    for (int k = first; k < list->count; k++) {
+        const RenderCommand* command = &list->commands[order[k]];
+        RunCommand(list, command, window, game);
+        list->building.submitted[command->layer]++;
+    }
+    list->stats = list->building;
+}
+
+// Last submitted frame's counts; the current frame is still being queued
+void PushRenderStats(RenderList* list, RenderLayer layer, int posX, int posY, int fontSize) {
+    const RenderStats* stats = &list->stats;
+    int submitted = 0, culled = 0, occluded = 0;
+    char line[RENDER_TEXT_LENGTH] = "";
+    int length = 0;
+    for (int i = 0; i < RENDER_LAYER_COUNT; i++) {
+        submitted += stats->submitted[i];
+        culled += stats->culled[i];
+        occluded += stats->occluded[i];
+        if (stats->submitted[i] > 0 && length < (int)sizeof(line)) {
+            length += snprintf(line + length, sizeof(line) - length, "%s %d ", LAYER_NAMES[i], stats->submitted[i]);
+        }
+    }
+    PushText(list, layer, TextFormat("draws %d, %d off-screen, %d occluded", submitted, culled, occluded),
+             posX, posY, fontSize, DARKGRAY);
+    PushText(list, layer, line, posX, posY + fontSize + 4, fontSize, DARKGRAY);
+}
+
+// Backend. Every draw in the game goes through the calls below, so the
+// software backend can rasterize the same frame into a CPU framebuffer.
+// Its textures are CPU copies, and their ids index softTextures.
+
+static RenderBackend backend = RENDER_BACKEND_GPU;
+static SoftCanvas framebuffer;
+static SoftCanvas softTextures[MAX_SOFT_TEXTURES];
+static Texture2D presentTexture; // software frames reach an open window through this
+static const SoftCanvas* quadTexture;
+
+static void LoadPresentTexture(void) {
+    if (presentTexture.id != 0) UnloadTexture(presentTexture);
+    presentTexture = (Texture2D){0};
+    if (!IsWindowReady()) return;
+    Image image = { framebuffer.pixels, framebuffer.width, framebuffer.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    presentTexture = LoadTextureFromImage(image);
+}
+
+// Call before any texture is loaded; without a window only the software
+// backend works.
+bool InitRenderBackend(RenderBackend requested, int width, int height) {
+    backend = requested;
+    if (backend != RENDER_BACKEND_SOFTWARE) return true;
+    if (!InitSoftCanvas(&framebuffer, width, height)) return false;
+    SoftClear(&framebuffer, BLACK);
+    LoadPresentTexture();
+    return true;
+}
+
+RenderBackend GetRenderBackend(void) {
+    return backend;
+}
+
+void ResizeRenderBackend(int width, int height) {
+    if (backend != RENDER_BACKEND_SOFTWARE) return;
+    if (width == framebuffer.width && height == framebuffer.height) return;
+    if (!InitSoftCanvas(&framebuffer, width, height)) return;
+    SoftClear(&framebuffer, BLACK);
+    LoadPresentTexture();
+}
+
+void CloseRenderBackend(void) {
+    if (presentTexture.id != 0) UnloadTexture(presentTexture);
+    presentTexture = (Texture2D){0};
+    for (int i = 0; i < MAX_SOFT_TEXTURES; i++) FreeSoftCanvas(&softTextures[i]);
+    FreeSoftCanvas(&framebuffer);
+}
+
+// The finished software frame; NULL on the GPU backend
+SoftCanvas* GetRenderFramebuffer(void) {
+    return backend == RENDER_BACKEND_SOFTWARE ? &framebuffer : NULL;
+}
+
+static const SoftCanvas* SoftTexture(Texture2D texture) {
+    if (texture.id == 0 || texture.id > MAX_SOFT_TEXTURES) return NULL;
+    return &softTextures[texture.id - 1];
+}
+
+Texture2D LoadGameTextureFromImage(Image image) {
+    if (backend == RENDER_BACKEND_GPU) return LoadTextureFromImage(image);
+    Texture2D texture = {0};
+    if (!image.data) return texture;
+    for (int i = 0; i < MAX_SOFT_TEXTURES; i++) {
+        SoftCanvas* slot = &softTextures[i];
+        if (slot->pixels) continue;
+        Color* colors = LoadImageColors(image);
+        if (!colors || !InitSoftCanvas(slot, image.width, image.height)) {
+            UnloadImageColors(colors);
+            return texture;
+        }
+        memcpy(slot->pixels, colors, (size_t)image.width * image.height * sizeof(Color));
+        UnloadImageColors(colors);
+        TrimSoftCanvas(slot);
+        return (Texture2D){ .id = i + 1, .width = image.width, .height = image.height,
+                            .mipmaps = 1, .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    }
+    TraceLog(LOG_WARNING, "RENDER: more than %d software textures", MAX_SOFT_TEXTURES);
+    return texture;
+}
+
+Texture2D LoadGameTexture(const char* path) {
+    if (backend == RENDER_BACKEND_GPU) return LoadTexture(path);
+    Image image = LoadImage(path);
+    Texture2D texture = LoadGameTextureFromImage(image);
+    UnloadImage(image);
+    return texture;
+}
+
+void UnloadGameTexture(Texture2D texture) {
+    if (texture.id == 0) return;
+    if (backend == RENDER_BACKEND_GPU) {
+        UnloadTexture(texture);
+    } else if (texture.id <= MAX_SOFT_TEXTURES) {
+        FreeSoftCanvas(&softTextures[texture.id - 1]);
+    }
+}
+
+void BeginRenderFrame(void) {
+    if (backend == RENDER_BACKEND_GPU) BeginDrawing();
+}
+
+void EndRenderFrame(void) {
+    if (backend == RENDER_BACKEND_GPU) {
+        EndDrawing();
+        return;
+    }
+    if (presentTexture.id == 0) return;
+    UpdateTexture(presentTexture, framebuffer.pixels);
+    BeginDrawing();
+    DrawTexture(presentTexture, 0, 0, WHITE);
+    EndDrawing();
+}
+
+void RenderClear(Color color) {
+    if (backend == RENDER_BACKEND_GPU) ClearBackground(color);
+    else SoftClear(&framebuffer, color);
+}
+
+void RenderRect(Rectangle rect, Color color) {
+    if (backend == RENDER_BACKEND_GPU) DrawRectangleRec(rect, color);
+    else SoftFillRect(&framebuffer, rect, color);
+}
+
+void RenderRectLines(Rectangle rect, float thickness, Color color) {
+    if (backend == RENDER_BACKEND_GPU) DrawRectangleLinesEx(rect, thickness, color);
+    else SoftRectLines(&framebuffer, rect, thickness, color);
+}
+
+void RenderRoundedRect(Rectangle rect, float roundness, Color color) {
+    if (backend == RENDER_BACKEND_GPU) DrawRectangleRounded(rect, roundness, 32, color);
+    else SoftFillRoundedRect(&framebuffer, rect, roundness, color);
+}
+
+void RenderRoundedRectLines(Rectangle rect, float roundness, Color color) {
+    if (backend == RENDER_BACKEND_GPU) DrawRectangleRoundedLines(rect, roundness, 32, color);
+    else SoftRoundedRectLines(&framebuffer, rect, roundness, color);
+}
+
+void RenderSprite(Texture2D texture, Rectangle source, Rectangle dest, Color tint) {
+    if (backend == RENDER_BACKEND_GPU) {
+        DrawTexturePro(texture, source, dest, (Vector2){0}, 0, tint);
+        return;
+    }
+    const SoftCanvas* pixels = SoftTexture(texture);
+    if (pixels) SoftBlit(&framebuffer, pixels, source, dest, tint);
+}
+
+void RenderText(const char* text, int posX, int posY, int fontSize, Color color) {
+    if (backend == RENDER_BACKEND_GPU) DrawText(text, posX, posY, fontSize, color);
+    else SoftText(&framebuffer, text, posX, posY, fontSize, color);
+}
+
+int MeasureRenderText(const char* text, int fontSize) {
+    return backend == RENDER_BACKEND_GPU ? MeasureText(text, fontSize) : SoftMeasureText(text, fontSize);
+}
+
+// Square quads of one texture, for the particle and projectile batches;
+// on the GPU a run is one rlBegin/rlEnd
+void BeginRenderQuads(Texture2D texture, int quadCount) {
+    if (backend == RENDER_BACKEND_GPU) {
+        rlCheckRenderBatchLimit(quadCount * 4);
+        rlSetTexture(texture.id);
+        rlBegin(RL_QUADS);
+    } else {
+        quadTexture = SoftTexture(texture);
+    }
+}
+
+void RenderQuad(float centerX, float centerY, float half, Color color) {
+    if (backend == RENDER_BACKEND_SOFTWARE) {
+        if (!quadTexture) return;
+        Rectangle source = { 0, 0, quadTexture->width, quadTexture->height };
+        SoftBlit(&framebuffer, quadTexture, source, (Rectangle){ centerX - half, centerY - half, 2 * half, 2 * half }, color);
+        return;
+    }
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlTexCoord2f(0.0f, 0.0f);
+    rlVertex2f(centerX - half, centerY - half);
+    rlTexCoord2f(0.0f, 1.0f);
+    rlVertex2f(centerX - half, centerY + half);
+    rlTexCoord2f(1.0f, 1.0f);
+    rlVertex2f(centerX + half, centerY + half);
+    rlTexCoord2f(1.0f, 0.0f);
+    rlVertex2f(centerX + half, centerY - half);
+}
+
+void EndRenderQuads(void) {
+    if (backend == RENDER_BACKEND_GPU) {
+        rlEnd();
+        rlSetTexture(0);
+    }
+    quadTexture = NULL;
+}
@@ -0,0 +1,38 @@
+#ifndef RENDER_H
+#define RENDER_H
+#include "raylib.h"
+#include "types.h"
+#include <stdbool.h>
+
+void BeginRenderList(RenderList* list, const WindowState* window, Vector2 shakeOffset);
+void PushClear(RenderList* list, RenderLayer layer, Color color);
+void PushSprite(RenderList* list, RenderLayer layer, Texture2D texture, Rectangle source, Rectangle dest, Color tint);
+void PushRect(RenderList* list, RenderLayer layer, Rectangle rect, Color color);
+void PushText(RenderList* list, RenderLayer layer, const char* text, int posX, int posY, int fontSize, Color color);
+void PushCustom(RenderList* list, RenderLayer layer, RenderCallback callback);
+void SubmitRenderList(RenderList* list, const WindowState* window, const GameState* game);
+void PushRenderStats(RenderList* list, RenderLayer layer, int posX, int posY, int fontSize);
+
+bool InitRenderBackend(RenderBackend requested, int width, int height);
+RenderBackend GetRenderBackend(void);
+void ResizeRenderBackend(int width, int height);
+void CloseRenderBackend(void);
+SoftCanvas* GetRenderFramebuffer(void);
+Texture2D LoadGameTexture(const char* path);
+Texture2D LoadGameTextureFromImage(Image image);
+void UnloadGameTexture(Texture2D texture);
+void BeginRenderFrame(void);
+void EndRenderFrame(void);
+void RenderClear(Color color);
+void RenderRect(Rectangle rect, Color color);
+void RenderRectLines(Rectangle rect, float thickness, Color color);
+void RenderRoundedRect(Rectangle rect, float roundness, Color color);
+void RenderRoundedRectLines(Rectangle rect, float roundness, Color color);
+void RenderSprite(Texture2D texture, Rectangle source, Rectangle dest, Color tint);
+void RenderText(const char* text, int posX, int posY, int fontSize, Color color);
+int MeasureRenderText(const char* text, int fontSize);
+void BeginRenderQuads(Texture2D texture, int quadCount);
+void RenderQuad(float centerX, float centerY, float half, Color color);
+void EndRenderQuads(void);
+
+#endif
@@ -0,0 +1,142 @@
+#include "replay.h"
+#include "game.h"
+#include "tuning.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+void BeginReplayRecording(ReplayRecorder* recorder, const GameState* game) {
+    recorder->seed = game->runSeed;
+    recorder->storyMode = game->isStoryMode;
+    recorder->count = 0;
+    recorder->saved = false;
+}
+
+void RecordReplayInput(ReplayRecorder* recorder, PlayerInput input) {
+    if (recorder->count == recorder->capacity) {
+        int newCapacity = recorder->capacity ? recorder->capacity * 2 : SIM_TICK_RATE * 60;
+        PlayerInput* grown = realloc(recorder->inputs, newCapacity * sizeof(PlayerInput));
+        if (!grown) return;
+        recorder->inputs = grown;
+        recorder->capacity = newCapacity;
+    }
+    recorder->inputs[recorder->count++] = input;
+}
+
+bool SaveReplayRecording(ReplayRecorder* recorder, const GameState* game) {
+    recorder->saved = true;
+    if (recorder->count != (int)game->tick) return false;
+    mkdir(REPLAY_DIRECTORY, 0755);
+    char path[256];
+    snprintf(path, sizeof(path), "%s/run-%016llx%s", REPLAY_DIRECTORY,
+             (unsigned long long)recorder->seed, REPLAY_EXTENSION);
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    ReplayHeader header = {0};
+    memcpy(header.magic, REPLAY_MAGIC, sizeof(header.magic));
+    header.version = REPLAY_VERSION;
+    header.seed = recorder->seed;
+    header.tickCount = recorder->count;
+    header.score = game->score;
+    header.storyMode = recorder->storyMode;
+    header.won = game->gameWon;
+    header.tuningHash = HashTuning(GetTuning());
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(recorder->inputs, sizeof(PlayerInput), recorder->count, file) == (size_t)recorder->count;
+    fclose(file);
+    return ok;
+}
+
+void FreeReplayRecorder(ReplayRecorder* recorder) {
+    free(recorder->inputs);
+    recorder->inputs = NULL;
+    recorder->count = 0;
+    recorder->capacity = 0;
+}
+
+// The header's tick count is untrusted: it has to be sane and match the
+// bytes actually left in the file before anything is allocated for it
+bool LoadReplay(const char* path, Replay* replay) {
+    memset(replay, 0, sizeof(*replay));
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+    struct stat info;
+    bool ok = fstat(fileno(file), &info) == 0 &&
+              fread(&replay->header, sizeof(replay->header), 1, file) == 1 &&
+              memcmp(replay->header.magic, REPLAY_MAGIC, sizeof(replay->header.magic)) == 0 &&
+              replay->header.version == REPLAY_VERSION &&
+              replay->header.tickCount <= REPLAY_MAX_TICKS &&
+              (uint64_t)info.st_size == sizeof(replay->header) + (uint64_t)replay->header.tickCount * sizeof(PlayerInput);
+    if (ok) {
+        replay->inputs = malloc(replay->header.tickCount ? replay->header.tickCount * sizeof(PlayerInput) : 1);
+        ok = replay->inputs &&
+             fread(replay->inputs, sizeof(PlayerInput), replay->header.tickCount, file) == replay->header.tickCount;
+    }
+    fclose(file);
+    if (!ok) UnloadReplay(replay);
+    return ok;
+}
+
+void UnloadReplay(Replay* replay) {
+    free(replay->inputs);
+    replay->inputs = NULL;
+}
+
+// Re-runs the recorded inputs through the simulation and compares the
+// outcome with what the file claims. The run has to end on exactly the
+// last recorded tick; inputs after death or a run that never ends are
+// both treated as tampering. A run played under another tuning table
+// can't be re-simulated here at all.
+ReplayResult VerifyReplay(const Replay* replay) {
+    ReplayResult result = { .verdict = REPLAY_VERDICT_INVALID };
+    if (!replay->inputs) return result;
+    if (replay->header.tuningHash != HashTuning(GetTuning())) {
+        result.verdict = REPLAY_VERDICT_TUNING_MISMATCH;
+        return result;
+    }
+    GameState game = {0};
+    InitSimState(&game, replay->header.seed);
+    game.isStoryMode = replay->header.storyMode != 0;
+    for (uint32_t i = 0; i < replay->header.tickCount && !game.gameOver; i++) {
+        StepGame(&game, replay->inputs[i]);
+    }
+    result.score = game.score;
+    result.won = game.gameWon;
+    result.ticks = game.tick;
+    if (!game.gameOver || game.tick != replay->header.tickCount) {
+        result.verdict = REPLAY_VERDICT_LENGTH_MISMATCH;
+    } else if (game.score != replay->header.score) {
+        result.verdict = REPLAY_VERDICT_SCORE_MISMATCH;
+    } else if (game.gameWon != (replay->header.won != 0)) {
+        result.verdict = REPLAY_VERDICT_OUTCOME_MISMATCH;
+    } else {
+        result.verdict = REPLAY_VERDICT_OK;
+    }
+    return result;
+}
+
+const char* ReplayVerdictName(ReplayVerdict verdict) {
+    switch (verdict) {
+        case REPLAY_VERDICT_OK: return "OK";
+        case REPLAY_VERDICT_SCORE_MISMATCH: return "SCORE_MISMATCH";
+        case REPLAY_VERDICT_OUTCOME_MISMATCH: return "OUTCOME_MISMATCH";
+        case REPLAY_VERDICT_LENGTH_MISMATCH: return "LENGTH_MISMATCH";
+        case REPLAY_VERDICT_TUNING_MISMATCH: return "TUNING_MISMATCH";
+        case REPLAY_VERDICT_INVALID: return "INVALID";
+    }
+    return "UNKNOWN";
+}
+
+// FNV-1a over the seed and the inputs: identifies a run's replay without
+// shipping it, e.g. in leaderboard submissions
+uint64_t HashReplayInputs(uint64_t seed, const PlayerInput* inputs, int count) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int i = 0; i < 8; i++) {
+        hash = (hash ^ ((seed >> (8 * i)) & 0xFF)) * 0x100000001b3ULL;
+    }
+    for (int i = 0; i < count; i++) {
+        hash = (hash ^ inputs[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
@@ -0,0 +1,58 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+#include "types.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define REPLAY_MAGIC "DRPL"
+#define REPLAY_VERSION 4
+#define REPLAY_DIRECTORY "replays"
+#define REPLAY_EXTENSION ".rpl"
+#define REPLAY_MAX_TICKS (SIM_TICK_RATE * 60 * 60 * 24) // a day of play; longer files are rejected
+
+// On-disk layout: this header followed by tickCount PlayerInput bytes,
+// one per SIM_DT tick, written in native byte order like highscore.bin.
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint64_t seed;
+    uint32_t tickCount;
+    int32_t score;
+    uint8_t storyMode;
+    uint8_t won;
+    uint8_t reserved[2];
+    uint32_t tuningHash; // HashTuning() of the table the run was played with
+} ReplayHeader;
+
+typedef struct {
+    ReplayHeader header;
+    PlayerInput* inputs;
+} Replay;
+
+typedef enum {
+    REPLAY_VERDICT_OK,
+    REPLAY_VERDICT_SCORE_MISMATCH,
+    REPLAY_VERDICT_OUTCOME_MISMATCH,
+    REPLAY_VERDICT_LENGTH_MISMATCH,
+    REPLAY_VERDICT_TUNING_MISMATCH,
+    REPLAY_VERDICT_INVALID
+} ReplayVerdict;
+
+typedef struct {
+    ReplayVerdict verdict;
+    int score;
+    bool won;
+    uint32_t ticks;
+} ReplayResult;
+
+void BeginReplayRecording(ReplayRecorder* recorder, const GameState* game);
+void RecordReplayInput(ReplayRecorder* recorder, PlayerInput input);
+bool SaveReplayRecording(ReplayRecorder* recorder, const GameState* game);
+void FreeReplayRecorder(ReplayRecorder* recorder);
+bool LoadReplay(const char* path, Replay* replay);
+void UnloadReplay(Replay* replay);
+ReplayResult VerifyReplay(const Replay* replay);
+const char* ReplayVerdictName(ReplayVerdict verdict);
+uint64_t HashReplayInputs(uint64_t seed, const PlayerInput* inputs, int count);
+
+#endif
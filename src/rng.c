@@ -0,0 +1,31 @@
+#include "rng.h"
+
+// Per-run generator so a run is reproducible from its seed alone and
+// several simulations can run on different threads without sharing
+// raylib's global GetRandomValue() state.
+void SeedRng(uint64_t* state, uint64_t seed) {
+    *state = seed ? seed : 0x9E3779B97F4A7C15ULL;
+}
+
+uint64_t NextRandom(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Same contract as GetRandomValue(): inclusive range, swapped bounds allowed
+int NextRandomValue(uint64_t* state, int min, int max) {
+    if (min > max) {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+    uint64_t range = (uint64_t)((int64_t)max - min) + 1;
+    return (int)(min + (int64_t)(NextRandom(state) % range));
+}
+
+// Uniform in [0, 1), from the top 24 bits
+float NextRandomFloat(uint64_t* state) {
+    return (NextRandom(state) >> 40) * (1.0f / 16777216.0f);
+}
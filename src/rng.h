@@ -0,0 +1,10 @@
+#ifndef RNG_H
+#define RNG_H
+#include <stdint.h>
+
+void SeedRng(uint64_t* state, uint64_t seed);
+uint64_t NextRandom(uint64_t* state);
+int NextRandomValue(uint64_t* state, int min, int max);
+float NextRandomFloat(uint64_t* state);
+
+#endif
@@ -0,0 +1,320 @@
+#include "scheduler.h"
+#include "game.h"
+#include "rng.h"
+#include "collision.h"
+#include "atlas.h"
+#include "tuning.h"
+#include <math.h>
+#include <time.h>
+
+// Obstacles are laid out in chunks of SCHEDULE_CHUNK_TICKS. A chunk only
+// depends on the run seed and its index, so it doesn't matter whether the
+// worker made it ahead of time or the sim had to make it inline: the run
+// plays out the same and replays stay valid.
+
+#define MAX_JUMP_TICKS 128
+#define SCHEDULER_IDLE_NS 4000000L
+
+// What a fully charged jump looks like: the height of the dino's feet over
+// the ground on each airborne tick, counted from the tick W is pressed.
+typedef struct {
+    float arc[MAX_JUMP_TICKS];
+    int airTicks;
+    float playerLeft;
+    float playerRight;
+    float crouchTop;
+} JumpEnvelope;
+
+// When an obstacle overlaps the player's columns (in ticks after its
+// spawn), the heights it covers and which of those ticks of the jump arc
+// are above its top.
+typedef struct {
+    int enter;
+    int leave;
+    float top;
+    float bottom;
+    int rise;
+    int fall;
+    bool clearable;
+    bool duckable;
+} ObstacleProfile;
+
+typedef struct {
+    JumpEnvelope jump;
+    ObstacleProfile obstacles[OBSTACLE_BIRD + 1];
+    int carryTicks;
+} ScheduleLimits;
+
+// Greedy plan for getting past the chunk so far
+typedef struct {
+    bool jumped;
+    int jumpStart;
+    int grounded;
+    int ready;
+} SchedulePlan;
+
+static const int EASY_WEIGHTS[OBSTACLE_BIRD + 1] = { 4, 3, 1, 3, 1, 1, 2 };
+static const int HARD_WEIGHTS[OBSTACLE_BIRD + 1] = { 2, 2, 3, 2, 3, 3, 4 };
+
+// Built for the tuned speed and shared by every thread laying out chunks;
+// each chunk works from its own copy (see CopyLimits)
+static ScheduleLimits sharedLimits;
+static float sharedLimitsSpeed; // the obstacle speed `sharedLimits` was built for
+static pthread_mutex_t limitsLock = PTHREAD_MUTEX_INITIALIZER;
+
+static Rectangle MaskUnion(SpriteId a, SpriteId b) {
+    Rectangle ra = GetSpriteMask(a)->bounds;
+    Rectangle rb = GetSpriteMask(b)->bounds;
+    float left = fminf(ra.x, rb.x);
+    float top = fminf(ra.y, rb.y);
+    float right = fmaxf(ra.x + ra.width, rb.x + rb.width);
+    float bottom = fmaxf(ra.y + ra.height, rb.y + rb.height);
+    return (Rectangle){ left, top, right - left, bottom - top };
+}
+
+static void BuildObstacleProfile(ScheduleLimits* limits, ObstacleType type, float speed) {
+    const JumpEnvelope* jump = &limits->jump;
+    ObstacleProfile* profile = &limits->obstacles[type];
+    SpriteId first = type == OBSTACLE_BIRD ? SPRITE_BIRD_1 : SPRITE_CACTUS_1 + (type - OBSTACLE_CACTUS_1);
+    SpriteId second = type == OBSTACLE_BIRD ? SPRITE_BIRD_2 : first;
+    Rectangle bounds = MaskUnion(first, second);
+    const ObstacleDimensions dims = CACTUS_DIMENSIONS[type];
+    profile->top = dims.height - dims.yOffset - bounds.y;
+    profile->bottom = profile->top - bounds.height;
+
+    // UpdateObstacles() moves an obstacle on the tick it spawns, too.
+    // One tick of slack either side covers the floorf() in the hitbox.
+    float step = speed * SIM_DT;
+    profile->enter = -1;
+    profile->leave = -1;
+    for (int n = 0; n < 4 * SIM_TICK_RATE; n++) {
+        float left = BASE_RESOLUTION.x - (n + 1) * step + bounds.x;
+        if (left < jump->playerRight && left + bounds.width > jump->playerLeft) {
+            if (profile->enter < 0) profile->enter = n - 1;
+            profile->leave = n + 1;
+        }
+    }
+
+    profile->rise = -1;
+    profile->fall = -1;
+    for (int k = 0; k < jump->airTicks; k++) {
+        if (jump->arc[k] > profile->top) {
+            if (profile->rise < 0) profile->rise = k;
+            profile->fall = k;
+        }
+    }
+    profile->clearable = profile->rise >= 0 && profile->leave - profile->enter <= profile->fall - profile->rise;
+    profile->duckable = type == OBSTACLE_BIRD && jump->crouchTop < profile->bottom;
+}
+
+static void BuildLimits(ScheduleLimits* limits, float speed) {
+    InitCollisionMasks();
+    JumpEnvelope* jump = &limits->jump;
+    Rectangle run = MaskUnion(SPRITE_RUN_1, SPRITE_RUN_2);
+    Rectangle crouch = MaskUnion(SPRITE_CROUCH_1, SPRITE_CROUCH_2);
+    float feet = ATLAS_SPRITES[SPRITE_RUN_1].frame.y - (run.y + run.height);
+    jump->playerLeft = BASE_RESOLUTION.x * 0.1f + run.x;
+    jump->playerRight = jump->playerLeft + run.width;
+    jump->crouchTop = ATLAS_SPRITES[SPRITE_CROUCH_1].frame.y - crouch.y;
+
+    float y = 0.0f;
+    float velocity = JUMP_FORCE;
+    float chargeTime = 0.0f;
+    jump->airTicks = 0;
+    while (jump->airTicks < MAX_JUMP_TICKS) {
+        IntegrateJump(&y, &velocity, &chargeTime, true, SIM_DT);
+        if (y >= 0.0f) break;
+        jump->arc[jump->airTicks++] = feet - y;
+    }
+
+    // The last spawn of a chunk may still need dodging after the next
+    // chunk starts; this is how long that can take at worst.
+    limits->carryTicks = 0;
+    for (int type = 0; type <= OBSTACLE_BIRD; type++) {
+        BuildObstacleProfile(limits, type, speed);
+        const ObstacleProfile* profile = &limits->obstacles[type];
+        int busy = profile->leave + 2;
+        if (profile->clearable) busy = fmaxf(busy, profile->enter - profile->rise + jump->airTicks + 1);
+        if (busy > limits->carryTicks) limits->carryTicks = busy;
+    }
+}
+
+static bool ArcClears(const JumpEnvelope* jump, int jumpStart, int enter, int leave, float top) {
+    for (int t = enter; t <= leave; t++) {
+        int k = t - jumpStart;
+        if (k < 0 || k >= jump->airTicks || jump->arc[k] <= top) return false;
+    }
+    return true;
+}
+
+// Can the dino get past one more obstacle spawned on `tick`? Updates the
+// plan only when it can.
+static bool PlanObstacle(const ScheduleLimits* limits, SchedulePlan* plan, ObstacleType type, int tick) {
+    const ObstacleProfile* profile = &limits->obstacles[type];
+    int enter = tick + profile->enter;
+    int leave = tick + profile->leave;
+    if (plan->jumped && plan->grounded > enter) {
+        // Still in the air when it arrives, so the same jump has to clear it
+        return ArcClears(&limits->jump, plan->jumpStart, enter, leave, profile->top);
+    }
+    if (profile->duckable) {
+        plan->ready = fmaxf(plan->ready, leave + 2);
+        return true;
+    }
+    if (!profile->clearable) return false;
+    int jumpStart = fmaxf(plan->ready, leave - profile->fall);
+    if (jumpStart > enter - profile->rise) return false;
+    plan->jumped = true;
+    plan->jumpStart = jumpStart;
+    plan->grounded = jumpStart + limits->jump.airTicks;
+    plan->ready = plan->grounded + 1;
+    return true;
+}
+
+// Score only depends on time until the run ends, so the difficulty of a
+// chunk can be read off the score the run will have when it starts.
+static float ChunkDifficulty(uint32_t startTick) {
+    float expectedScore = startTick / (0.1f * SIM_TICK_RATE);
+    return fminf(1.0f, expectedScore / DIFFICULTY_RAMP_SCORE);
+}
+
+static ObstacleType PickObstacleType(const ScheduleLimits* limits, uint64_t* rng, float difficulty) {
+    int weights[OBSTACLE_BIRD + 1];
+    int total = 0;
+    for (int type = 0; type <= OBSTACLE_BIRD; type++) {
+        const ObstacleProfile* profile = &limits->obstacles[type];
+        weights[type] = 0;
+        if (profile->clearable || profile->duckable) {
+            weights[type] = (int)roundf(10.0f * (EASY_WEIGHTS[type] +
+                                        (HARD_WEIGHTS[type] - EASY_WEIGHTS[type]) * difficulty));
+        }
+        total += weights[type];
+    }
+    int roll = NextRandomValue(rng, 0, total - 1);
+    for (int type = 0; type <= OBSTACLE_BIRD; type++) {
+        if (roll < weights[type]) return type;
+        roll -= weights[type];
+    }
+    return OBSTACLE_CACTUS_1;
+}
+
+// Obstacle timings depend on the tuned speed, so the shared limits are
+// rebuilt whenever it has changed since. The caller gets a copy taken
+// under the lock: a rebuild for another speed can never change the
+// limits a chunk is being laid out with.
+static void CopyLimits(float speed, ScheduleLimits* limits) {
+    pthread_mutex_lock(&limitsLock);
+    if (sharedLimitsSpeed != speed) {
+        BuildLimits(&sharedLimits, speed);
+        sharedLimitsSpeed = speed;
+    }
+    *limits = sharedLimits;
+    pthread_mutex_unlock(&limitsLock);
+}
+
+void GenerateObstacleChunk(uint64_t runSeed, uint32_t index, ObstacleChunk* chunk) {
+    const TuningParams* tuning = GetTuning();
+    ScheduleLimits limits;
+    CopyLimits(tuning->obstacleSpeed, &limits);
+    uint64_t rng;
+    SeedRng(&rng, runSeed ^ ((uint64_t)(index + 1) * 0x9E3779B97F4A7C15ULL));
+
+    int start = index * SCHEDULE_CHUNK_TICKS;
+    int end = start + SCHEDULE_CHUNK_TICKS;
+    float difficulty = ChunkDifficulty(start);
+    int minGap = (tuning->minSpawnInterval + (tuning->hardMinSpawnInterval - tuning->minSpawnInterval) * difficulty) * SIM_TICK_RATE;
+    int maxGap = (tuning->maxSpawnInterval + (tuning->hardMaxSpawnInterval - tuning->maxSpawnInterval) * difficulty) * SIM_TICK_RATE;
+
+    chunk->seed = runSeed;
+    chunk->index = index;
+    chunk->count = 0;
+    SchedulePlan plan = { .jumped = false, .ready = start + limits.carryTicks };
+    int tick = start;
+    while (chunk->count < SCHEDULE_MAX_CHUNK_SPAWNS) {
+        tick += NextRandomValue(&rng, minGap, maxGap);
+        ObstacleType type = PickObstacleType(&limits, &rng, difficulty);
+        // Push the spawn back until the envelope says it can be cleared
+        while (tick < end && !PlanObstacle(&limits, &plan, type, tick)) tick += 2;
+        if (tick >= end) break;
+        chunk->spawns[chunk->count++] = (ScheduledSpawn){ (uint32_t)tick, type };
+    }
+}
+
+static void* SchedulerWorker(void* arg) {
+    ObstacleScheduler* scheduler = arg;
+    uint64_t seed = atomic_load(&scheduler->seed);
+    while (atomic_load_explicit(&scheduler->running, memory_order_acquire)) {
+        uint64_t followed = atomic_load_explicit(&scheduler->seed, memory_order_acquire);
+        if (followed != seed) {
+            seed = followed;
+            scheduler->nextIndex = atomic_load(&scheduler->firstIndex);
+        }
+        unsigned tail = atomic_load_explicit(&scheduler->tail, memory_order_relaxed);
+        unsigned head = atomic_load_explicit(&scheduler->head, memory_order_acquire);
+        if (tail - head < SCHEDULE_QUEUE_CHUNKS) {
+            GenerateObstacleChunk(seed, scheduler->nextIndex++, &scheduler->queue[tail % SCHEDULE_QUEUE_CHUNKS]);
+            atomic_store_explicit(&scheduler->tail, tail + 1, memory_order_release);
+        } else {
+            nanosleep(&(struct timespec){ 0, SCHEDULER_IDLE_NS }, NULL);
+        }
+    }
+    return NULL;
+}
+
+// Called by whichever thread steps the game: the sim thread, or the main
+// thread when there is none. Never by two at once, so the ring can be
+// reset once the old worker has been joined.
+void StartObstacleScheduler(ObstacleScheduler* scheduler, uint64_t runSeed) {
+    StopObstacleScheduler(scheduler);
+    atomic_store(&scheduler->head, 0);
+    atomic_store(&scheduler->tail, 0);
+    atomic_store(&scheduler->seed, runSeed);
+    atomic_store(&scheduler->firstIndex, 0);
+    scheduler->nextIndex = 0;
+    atomic_store(&scheduler->hits, 0);
+    atomic_store(&scheduler->misses, 0);
+    atomic_store(&scheduler->running, true);
+    scheduler->started = pthread_create(&scheduler->thread, NULL, SchedulerWorker, scheduler) == 0;
+}
+
+void StopObstacleScheduler(ObstacleScheduler* scheduler) {
+    if (!scheduler->started) return;
+    atomic_store(&scheduler->running, false);
+    pthread_join(scheduler->thread, NULL);
+    scheduler->started = false;
+}
+
+// The consumer's side: moves a running worker on to another run, starting
+// at chunk `index`, without the join a restart would cost. What was queued
+// for the old run is dropped; a chunk the worker is still finishing for it
+// is skipped by TakeObstacleChunk().
+void FollowObstacleSeed(ObstacleScheduler* scheduler, uint64_t runSeed, uint32_t index) {
+    if (!scheduler || !scheduler->started || atomic_load(&scheduler->seed) == runSeed) return;
+    atomic_store_explicit(&scheduler->head, atomic_load_explicit(&scheduler->tail, memory_order_acquire),
+                          memory_order_release);
+    atomic_store(&scheduler->firstIndex, index);
+    atomic_store_explicit(&scheduler->seed, runSeed, memory_order_release);
+}
+
+// Takes chunk `index` off the ring, dropping anything older. If the worker
+// hasn't got there (or there is no worker) the chunk is generated inline.
+void TakeObstacleChunk(ObstacleScheduler* scheduler, uint64_t runSeed, uint32_t index, ObstacleChunk* chunk) {
+    if (scheduler) {
+        unsigned head = atomic_load_explicit(&scheduler->head, memory_order_relaxed);
+        unsigned tail = atomic_load_explicit(&scheduler->tail, memory_order_acquire);
+        while (head != tail) {
+            const ObstacleChunk* queued = &scheduler->queue[head % SCHEDULE_QUEUE_CHUNKS];
+            if (queued->seed == runSeed && queued->index > index) break;
+            head++;
+            if (queued->seed == runSeed && queued->index == index) {
+                *chunk = *queued;
+                atomic_store_explicit(&scheduler->head, head, memory_order_release);
+                atomic_fetch_add(&scheduler->hits, 1);
+                return;
+            }
+        }
+        atomic_store_explicit(&scheduler->head, head, memory_order_release);
+        atomic_fetch_add(&scheduler->misses, 1);
+    }
+    GenerateObstacleChunk(runSeed, index, chunk);
+}
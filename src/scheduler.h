@@ -0,0 +1,30 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+#include "types.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+// Single-producer/single-consumer ring: the worker fills chunks ahead of
+// the sim, the sim thread takes them at chunk boundaries.
+struct ObstacleScheduler {
+    ObstacleChunk queue[SCHEDULE_QUEUE_CHUNKS];
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_bool running;
+    _Atomic uint64_t seed;   // the run the worker lays out chunks for
+    atomic_uint firstIndex;  // where it starts after FollowObstacleSeed()
+    uint32_t nextIndex;      // worker only
+    pthread_t thread;
+    bool started;
+    atomic_int hits;    // chunks taken ready from the ring this run (F3)
+    atomic_int misses;  // chunks the sim had to build itself
+};
+
+void GenerateObstacleChunk(uint64_t runSeed, uint32_t index, ObstacleChunk* chunk);
+void StartObstacleScheduler(ObstacleScheduler* scheduler, uint64_t runSeed);
+void StopObstacleScheduler(ObstacleScheduler* scheduler);
+void FollowObstacleSeed(ObstacleScheduler* scheduler, uint64_t runSeed, uint32_t index);
+void TakeObstacleChunk(ObstacleScheduler* scheduler, uint64_t runSeed, uint32_t index, ObstacleChunk* chunk);
+
+#endif
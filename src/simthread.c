@@ -0,0 +1,408 @@
+#include "simthread.h"
+#include "netplay.h"
+#include "game.h"
+#include "replay.h"
+#include "autopilot.h"
+#include "particles.h"
+#include "input.h"
+#include "sound.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// `middle` holds the index of the spare snapshot, plus a flag telling the
+// reader it was published since its last acquire. Writer and reader each
+// own one other snapshot and only ever trade with `middle`, so neither
+// waits on the other.
+#define SNAPSHOT_INDEX 3u
+#define SNAPSHOT_FRESH 4u
+#define NANOSECONDS 1000000000L
+
+// Particles belong to the render thread, so effect events cross over in
+// a single-producer/single-consumer ring; a full ring drops the newest.
+static void QueueEffects(SimThread* sim) {
+    const GameState* game = sim->game;
+    unsigned tail = atomic_load_explicit(&sim->effectTail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&sim->effectHead, memory_order_acquire);
+    for (int i = 0; i < game->effectCount && tail - head < SIM_EFFECT_QUEUE; i++) {
+        sim->effects[tail % SIM_EFFECT_QUEUE] = game->effects[i];
+        tail++;
+    }
+    atomic_store_explicit(&sim->effectTail, tail, memory_order_release);
+}
+
+static void ApplySimCommand(SimThread* sim, const SimCommand* command) {
+    GameState* game = sim->game;
+    switch (command->type) {
+        case SIM_COMMAND_START:
+            game->isStoryMode = command->storyMode;
+            game->playerCount = command->playerCount;
+            sim->inMenu = false;
+            ResetGame(game);
+            break;
+        case SIM_COMMAND_RESTART:
+            StopAllSounds(game);
+            ResetGame(game);
+            break;
+        case SIM_COMMAND_MAIN_MENU:
+            StopAllSounds(game);
+            game->pauseMenu.isPaused = false;
+            sim->inMenu = true;
+            ResetGame(game);
+            break;
+        case SIM_COMMAND_TOGGLE_PAUSE:
+            game->pauseMenu.isPaused = !game->pauseMenu.isPaused;
+            break;
+        case SIM_COMMAND_RESUME:
+            game->pauseMenu.isPaused = false;
+            break;
+        case SIM_COMMAND_TOGGLE_AUTOPILOT:
+            game->autopilotEnabled = !game->autopilotEnabled;
+            break;
+        case SIM_COMMAND_TOGGLE_PROFILER:
+            game->showProfiler = !game->showProfiler;
+            break;
+    }
+}
+
+static void ApplySimCommands(SimThread* sim) {
+    unsigned head = atomic_load_explicit(&sim->commandHead, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&sim->commandTail, memory_order_acquire);
+    for (; head != tail; head++) ApplySimCommand(sim, &sim->commands[head % SIM_COMMAND_QUEUE]);
+    atomic_store_explicit(&sim->commandHead, head, memory_order_release);
+}
+
+// Waiting in the menu, a versus match starts as soon as the peer is
+// there; back in the menu a match that lost its peer is over for both ends
+static void UpdateNetplayMenu(SimThread* sim) {
+    GameState* game = sim->game;
+    if (!game->netplay || !sim->inMenu) return;
+    if (GetNetplayPhase(game->netplay) == NETPLAY_CONNECTED) {
+        BeginNetplayMatch(game->netplay, game);
+        sim->inMenu = false;
+        atomic_store(&sim->matchStarted, true);
+    } else if (game->netplay->inMatch) {
+        LeaveNetplay(game->netplay);
+    }
+}
+
+static void PollSimNetplay(SimThread* sim) {
+    PollNetplay(sim->game->netplay);
+    UpdateNetplayMenu(sim);
+    atomic_store(&sim->versus, sim->game->netplay->inMatch);
+}
+
+static void PlayEndSound(GameState* game) {
+    if (!game->gameOver) return;
+    if (game->gameWon) {
+        PlayWinSound(game);
+    } else {
+        PlayGameOverSound(game);
+    }
+}
+
+static void StepSim(SimThread* sim) {
+    GameState* game = sim->game;
+    // Read before the commands, so a run started together with stepping
+    // is always reset before its first tick
+    bool stepping = atomic_load(&sim->stepping);
+    ApplySimCommands(sim);
+    // Sampled as late as possible: right before the tick that uses it
+    double pressTime = 0.0;
+    PlayerInputs inputs = game->input ? TakeTickInput(game->input, &pressTime) : INPUT_NONE;
+    if (game->netplay) {
+        PollSimNetplay(sim);
+        // Versus ticks go through the session, which also keeps running
+        // through game over so both ends can agree on a rematch
+        if (game->netplay->inMatch) {
+            stepping = stepping && !game->pauseMenu.isPaused;
+            if (stepping && pressTime > 0.0) game->inputTime = pressTime;
+            if (TickNetplay(game->netplay, game, inputs & PLAYER_INPUT_MASK, stepping)) {
+                QueueEffects(sim);
+                UpdateClouds(game, NULL, SIM_DT);
+                PlayEndSound(game);
+            }
+            return;
+        }
+    }
+    if (!stepping || game->gameOver || game->pauseMenu.isPaused) return;
+    if (game->autopilotEnabled) {
+        // The bot only ever drives player one
+        inputs = (inputs & ~PLAYER_INPUT_MASK) | ChooseAutopilotInput(game, &sim->autopilot);
+    } else if (pressTime > 0.0) {
+        game->inputTime = pressTime;
+    }
+    bool race = game->playerCount > 1;
+    if (!race) RecordReplayInput(&game->replay, inputs);
+    StepGame(game, inputs);
+    QueueEffects(sim);
+    UpdateClouds(game, NULL, SIM_DT);
+    PlayEndSound(game);
+    if (game->gameOver && !race && !game->replay.saved) {
+        // Only runs with a complete replay, and none the bot played; races
+        // are neither recorded nor ranked
+        if (SaveReplayRecording(&game->replay, game) && !game->autopilotEnabled) {
+            ScoreRecord record = {
+                .seed = game->runSeed,
+                .replayHash = HashReplayInputs(game->runSeed, game->replay.inputs, game->replay.count),
+                .score = game->score,
+                .ticks = game->tick,
+                .storyMode = game->isStoryMode,
+                .won = game->gameWon
+            };
+            SubmitScore(sim->leaderboard, &record);
+        }
+    }
+}
+
+_Static_assert(MAX_OBSTACLES <= LIVE_MAX_OBSTACLES && MAX_METEORS <= LIVE_MAX_METEORS,
+               "live frames must have room for every obstacle and meteor");
+
+static LiveEntity ToLiveEntity(Rectangle rect, int kind) {
+    return (LiveEntity){ rect.x, rect.y, rect.width, rect.height, kind };
+}
+
+static void ExportLiveFrame(LiveState* live, const GameState* game) {
+    LiveFrame frame = {
+        .runSeed = game->runSeed,
+        .tick = game->tick,
+        .score = game->score,
+        .highScore = game->highScore,
+        .hp = game->hp,
+        .bossHP = game->bossHP,
+        .playerVelocity = game->players[0].baseJumpVelocity,
+        .projectileCount = game->projectiles.count,
+        .player = ToLiveEntity(game->players[0].rect, 0)
+    };
+    // In LiveFlags order
+    bool flags[] = { game->gameOver, game->gameWon, game->isStoryMode, game->bossActive,
+                     game->players[0].isJumping, game->players[0].isCrouching, game->nightModeActive, game->pauseMenu.isPaused };
+    for (int i = 0; i < (int)(sizeof(flags) / sizeof(flags[0])); i++) {
+        if (flags[i]) frame.flags |= 1u << i;
+    }
+    for (int i = 0; i < MAX_OBSTACLES; i++) {
+        const Obstacle* obs = &game->obstacles.obstacles[i];
+        if (obs->active) frame.obstacles[frame.obstacleCount++] = ToLiveEntity(obs->rect, obs->type);
+    }
+    for (int i = 0; i < MAX_METEORS; i++) {
+        const Meteor* meteor = &game->meteors[i];
+        if (meteor->active) frame.meteors[frame.meteorCount++] = ToLiveEntity(meteor->rect, meteor->state);
+    }
+    WriteLiveFrame(live, &frame);
+}
+
+// Sim thread only, after the tick: nothing else reads `game`, so the copy
+// and the exports need no lock
+static void PublishSnapshot(SimThread* sim) {
+    if (sim->live) ExportLiveFrame(sim->live, sim->game);
+    SubmitBroadcastFrame(sim->broadcast, sim->game);
+    if (!sim->snapshots[0]) return;
+    memcpy(sim->snapshots[sim->back], sim->game, sizeof(GameState));
+    sim->back = atomic_exchange(&sim->middle, sim->back | SNAPSHOT_FRESH) & SNAPSHOT_INDEX;
+}
+
+// The newest published state, owned by the caller until the next acquire
+GameState* AcquireSimFrame(SimThread* sim) {
+    if (!sim->snapshots[0]) return sim->game;
+    if (atomic_load(&sim->middle) & SNAPSHOT_FRESH) {
+        sim->front = atomic_exchange(&sim->middle, sim->front) & SNAPSHOT_INDEX;
+    }
+    return sim->snapshots[sim->front];
+}
+
+static long long NowNanoseconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * NANOSECONDS + now.tv_nsec;
+}
+
+static struct timespec ToTimespec(long long nanoseconds) {
+    return (struct timespec){ nanoseconds / NANOSECONDS, nanoseconds % NANOSECONDS };
+}
+
+// Ticks against an absolute deadline so the rate stays exact. A tick due
+// within half a tick of its deadline runs as soon as a frame has sampled
+// input (SyncSimFrame), so the press is in the state that frame draws;
+// without frames it runs half a tick late. A short stall is caught up tick
+// by tick; a long one (debugger, suspend) is dropped, like the
+// frame-driven loop's step cap.
+static void* SimWorker(void* arg) {
+    SimThread* sim = arg;
+    const long long tick = NANOSECONDS / SIM_TICK_RATE;
+    long long next = NowNanoseconds();
+    pthread_mutex_lock(&sim->wakeLock);
+    while (atomic_load(&sim->running)) {
+        long long now = NowNanoseconds();
+        unsigned request = sim->frameRequest;
+        bool frame = request != sim->frameAnswered;
+        if (frame && now < next - tick / 2) {
+            // Too early for the next tick: the frame draws what it has
+            sim->frameAnswered = request;
+            pthread_cond_broadcast(&sim->frameSynced);
+            frame = false;
+        }
+        if (!frame && now < next + tick / 2) {
+            struct timespec deadline = ToTimespec(next + tick / 2);
+            pthread_cond_timedwait(&sim->wake, &sim->wakeLock, &deadline);
+            continue;
+        }
+        pthread_mutex_unlock(&sim->wakeLock);
+        StepSim(sim);
+        PublishSnapshot(sim);
+        next += tick;
+        now = NowNanoseconds();
+        if (now - next > MAX_SIM_STEPS_PER_FRAME * tick) next = now;
+        pthread_mutex_lock(&sim->wakeLock);
+        if (frame) {
+            sim->frameAnswered = request;
+            pthread_cond_broadcast(&sim->frameSynced);
+        }
+    }
+    // Nobody waits on a stopped sim
+    sim->frameAnswered = sim->frameRequest;
+    pthread_cond_broadcast(&sim->frameSynced);
+    pthread_mutex_unlock(&sim->wakeLock);
+    return NULL;
+}
+
+static void DestroySimWake(SimThread* sim) {
+    pthread_cond_destroy(&sim->frameSynced);
+    pthread_cond_destroy(&sim->wake);
+    pthread_mutex_destroy(&sim->wakeLock);
+}
+
+// Returns false when the sim has to be driven from the frame loop with
+// RunSimFrame() instead; without snapshot memory frames read `game` directly.
+bool StartSimThread(SimThread* sim, GameState* game) {
+    sim->game = game;
+    for (int i = 0; i < SIM_SNAPSHOT_COUNT; i++) {
+        sim->snapshots[i] = malloc(sizeof(GameState));
+        if (sim->snapshots[i]) {
+            memcpy(sim->snapshots[i], game, sizeof(GameState));
+            continue;
+        }
+        for (int j = 0; j < i; j++) {
+            free(sim->snapshots[j]);
+            sim->snapshots[j] = NULL;
+        }
+        break;
+    }
+    sim->front = 0;
+    atomic_store(&sim->middle, 1);
+    sim->back = 2;
+    atomic_store(&sim->effectHead, 0);
+    atomic_store(&sim->effectTail, 0);
+    atomic_store(&sim->commandHead, 0);
+    atomic_store(&sim->commandTail, 0);
+    atomic_store(&sim->versus, false);
+    atomic_store(&sim->matchStarted, false);
+    sim->inMenu = true;
+    sim->accumulator = 0.0f;
+    // Without snapshots the render thread reads `game` itself, so the sim
+    // must not tick it from another thread
+    sim->started = false;
+    if (!sim->snapshots[0]) return false;
+    // The worker sleeps on CLOCK_MONOTONIC deadlines
+    pthread_condattr_t clock;
+    pthread_condattr_init(&clock);
+    pthread_condattr_setclock(&clock, CLOCK_MONOTONIC);
+    pthread_mutex_init(&sim->wakeLock, NULL);
+    pthread_cond_init(&sim->wake, &clock);
+    pthread_cond_init(&sim->frameSynced, &clock);
+    pthread_condattr_destroy(&clock);
+    sim->frameRequest = 0;
+    sim->frameAnswered = 0;
+    atomic_store(&sim->running, true);
+    sim->started = pthread_create(&sim->thread, NULL, SimWorker, sim) == 0;
+    if (!sim->started) DestroySimWake(sim);
+    return sim->started;
+}
+
+void StopSimThread(SimThread* sim) {
+    atomic_store(&sim->running, false);
+    if (sim->started) {
+        pthread_mutex_lock(&sim->wakeLock);
+        pthread_cond_signal(&sim->wake);
+        pthread_mutex_unlock(&sim->wakeLock);
+        pthread_join(sim->thread, NULL);
+        DestroySimWake(sim);
+    }
+    sim->started = false;
+    for (int i = 0; i < SIM_SNAPSHOT_COUNT; i++) {
+        free(sim->snapshots[i]);
+        sim->snapshots[i] = NULL;
+    }
+}
+
+// Main thread only. False when the queue is full and the command was dropped.
+bool PostSimCommand(SimThread* sim, SimCommand command) {
+    unsigned tail = atomic_load_explicit(&sim->commandTail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&sim->commandHead, memory_order_acquire);
+    if (tail - head >= SIM_COMMAND_QUEUE) return false;
+    sim->commands[tail % SIM_COMMAND_QUEUE] = command;
+    atomic_store_explicit(&sim->commandTail, tail + 1, memory_order_release);
+    return true;
+}
+
+bool IsSimVersus(SimThread* sim) {
+    return atomic_load(&sim->versus);
+}
+
+// True once for each versus match the sim started from the menu
+bool TakeSimMatchStart(SimThread* sim) {
+    return atomic_exchange(&sim->matchStarted, false);
+}
+
+void SetSimStepping(SimThread* sim, bool stepping) {
+    atomic_store(&sim->stepping, stepping);
+}
+
+// Main thread, right after sampling input: wakes the sim for its due tick
+// and waits until that tick is published, so the frame about to be drawn
+// already includes the input. The wait is bounded; a slow tick shows up a
+// frame later instead of stalling the frame.
+void SyncSimFrame(SimThread* sim) {
+    if (!sim->started) return;
+    struct timespec deadline = ToTimespec(NowNanoseconds() + SIM_FRAME_SYNC_MS * 1000000LL);
+    pthread_mutex_lock(&sim->wakeLock);
+    unsigned request = ++sim->frameRequest;
+    pthread_cond_signal(&sim->wake);
+    while ((int)(request - sim->frameAnswered) > 0) {
+        if (pthread_cond_timedwait(&sim->frameSynced, &sim->wakeLock, &deadline) != 0) break;
+    }
+    pthread_mutex_unlock(&sim->wakeLock);
+}
+
+// Fallback when no sim thread could be started: the old accumulator loop
+void RunSimFrame(SimThread* sim, float deltaTime) {
+    if (sim->started) return;
+    // Commands and the peer can't wait for a tick: in the menu no tick comes
+    ApplySimCommands(sim);
+    const GameState* game = sim->game;
+    if (game->netplay) PollSimNetplay(sim);
+    // A versus session ticks through pause and game over, like the sim thread
+    bool versus = game->netplay && game->netplay->inMatch;
+    if (!versus && (!atomic_load(&sim->stepping) || game->gameOver || game->pauseMenu.isPaused)) {
+        sim->accumulator = 0.0f;
+    } else {
+        sim->accumulator += deltaTime;
+    }
+    int steps = 0;
+    while (sim->accumulator >= SIM_DT && steps < MAX_SIM_STEPS_PER_FRAME) {
+        StepSim(sim);
+        sim->accumulator -= SIM_DT;
+        steps++;
+    }
+    if (steps == MAX_SIM_STEPS_PER_FRAME) sim->accumulator = 0.0f;
+    PublishSnapshot(sim);
+}
+
+void DrainSimEffects(SimThread* sim, ParticleSystem* particles) {
+    unsigned head = atomic_load_explicit(&sim->effectHead, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&sim->effectTail, memory_order_acquire);
+    for (; head != tail; head++) {
+        const EffectEvent* effect = &sim->effects[head % SIM_EFFECT_QUEUE];
+        if (particles) EmitEffect(particles, effect->type, effect->position, effect->size);
+    }
+    atomic_store_explicit(&sim->effectHead, head, memory_order_release);
+}
@@ -0,0 +1,83 @@
+#ifndef SIMTHREAD_H
+#define SIMTHREAD_H
+#include "types.h"
+#include "livestate.h"
+#include "leaderboard.h"
+#include "broadcast.h"
+#include "autopilot.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+// What the main thread can ask of the game. Commands cross over in a
+// queue and are applied by the sim between ticks, so only the sim thread
+// ever touches `game`.
+typedef enum {
+    SIM_COMMAND_START,         // a new run in `storyMode` with `playerCount` dinos
+    SIM_COMMAND_RESTART,       // the same mode again after a game over
+    SIM_COMMAND_MAIN_MENU,     // drop the run and wait in the menu
+    SIM_COMMAND_TOGGLE_PAUSE,
+    SIM_COMMAND_RESUME,
+    SIM_COMMAND_TOGGLE_AUTOPILOT,
+    SIM_COMMAND_TOGGLE_PROFILER
+} SimCommandType;
+
+typedef struct {
+    SimCommandType type;
+    bool storyMode;
+    int playerCount;
+} SimCommand;
+
+// The sim ticks `game` on its own thread at SIM_TICK_RATE and publishes a
+// copy after every tick into a triple buffer; the render thread draws the
+// newest copy and never touches `game` itself. Each frame wakes the sim
+// with SyncSimFrame() right after sampling input, so a due tick runs on
+// that input before the frame is drawn. Menus, pause and restart go
+// through PostSimCommand().
+// Set `live` before starting to also export every tick to shared memory,
+// `leaderboard` to submit the player's finished runs, and `broadcast` to
+// stream every tick to spectators.
+typedef struct {
+    GameState* game;
+    GameState* snapshots[SIM_SNAPSHOT_COUNT];
+    atomic_uint middle;
+    int back;
+    int front;
+    atomic_bool stepping;
+    atomic_bool running;
+    EffectEvent effects[SIM_EFFECT_QUEUE];
+    atomic_uint effectHead;
+    atomic_uint effectTail;
+    SimCommand commands[SIM_COMMAND_QUEUE];
+    atomic_uint commandHead;
+    atomic_uint commandTail;
+    atomic_bool versus;        // a versus match is running
+    atomic_bool matchStarted;  // set when one starts, cleared by TakeSimMatchStart()
+    bool inMenu;               // sim thread only: waiting in the menu
+    LiveState* live;
+    LeaderboardClient* leaderboard;
+    BroadcastServer* broadcast;
+    AutopilotMemory autopilot; // sim thread only
+    // Frame handshake only (see SyncSimFrame); `game` is never locked
+    pthread_mutex_t wakeLock;
+    pthread_cond_t wake;          // a frame sampled input
+    pthread_cond_t frameSynced;   // the tick for that frame is published
+    unsigned frameRequest;
+    unsigned frameAnswered;
+    pthread_t thread;
+    bool started;
+    float accumulator;
+} SimThread;
+
+bool StartSimThread(SimThread* sim, GameState* game);
+void StopSimThread(SimThread* sim);
+bool PostSimCommand(SimThread* sim, SimCommand command);
+bool IsSimVersus(SimThread* sim);
+bool TakeSimMatchStart(SimThread* sim);
+void SetSimStepping(SimThread* sim, bool stepping);
+void SyncSimFrame(SimThread* sim);
+void RunSimFrame(SimThread* sim, float deltaTime);
+GameState* AcquireSimFrame(SimThread* sim);
+void DrainSimEffects(SimThread* sim, ParticleSystem* particles);
+
+#endif
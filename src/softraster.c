@@ -0,0 +1,290 @@
+#include "softraster.h"
+#include "arena.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// CPU rasterizer behind the software render backend. It covers only what
+// the game draws: filled and outlined (rounded) rects, nearest-sampled
+// sprites, a built-in 5x7 font, and the two lightmap passes. Blending
+// follows raylib's defaults (alpha, additive, multiplied), and a pixel is
+// covered when its centre is inside the shape, as on the GPU.
+
+// Columns of the classic 5x7 font for ASCII 32..126, bit 0 at the top
+static const unsigned char FONT_5X7[95][5] = {
+    {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+    {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x56,0x20,0x50}, {0x00,0x05,0x03,0x00,0x00},
+    {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x2A,0x1C,0x7F,0x1C,0x2A}, {0x08,0x08,0x3E,0x08,0x08},
+    {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},
+    {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4B,0x31},
+    {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},
+    {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1E}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},
+    {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},
+    {0x32,0x49,0x79,0x41,0x3E}, {0x7E,0x11,0x11,0x11,0x7E}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+    {0x7F,0x41,0x41,0x22,0x1C}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x49,0x49,0x7A},
+    {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+    {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x0C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+    {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},
+    {0x01,0x01,0x7F,0x01,0x01}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+    {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7F,0x41,0x41,0x00},
+    {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7F,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+    {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7F,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},
+    {0x38,0x44,0x44,0x48,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7E,0x09,0x01,0x02}, {0x0C,0x52,0x52,0x52,0x3E},
+    {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x44,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+    {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x18,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+    {0x7C,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7C}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},
+    {0x04,0x3F,0x44,0x40,0x20}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+    {0x44,0x28,0x10,0x28,0x44}, {0x0C,0x50,0x50,0x50,0x3C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+    {0x00,0x00,0x7F,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x10,0x08,0x08,0x10,0x08}
+};
+#define FONT_ADVANCE 6   // glyph columns plus one of spacing
+#define FONT_BASE_SIZE 10 // raylib's default font size; larger sizes scale it up
+
+bool InitSoftCanvas(SoftCanvas* canvas, int width, int height) {
+    Color* pixels = CountedRealloc(canvas->pixels, (size_t)width * height * sizeof(Color));
+    if (!pixels) return false;
+    canvas->pixels = pixels;
+    canvas->width = width;
+    canvas->height = height;
+    CountedFree(canvas->spans);
+    canvas->spans = NULL;
+    return true;
+}
+
+void FreeSoftCanvas(SoftCanvas* canvas) {
+    CountedFree(canvas->pixels);
+    CountedFree(canvas->spans);
+    *canvas = (SoftCanvas){0};
+}
+
+// Records each row's visible columns, so SoftBlit() can skip the
+// transparent margins of sprites such as the mostly empty cloud layer
+bool TrimSoftCanvas(SoftCanvas* canvas) {
+    int* spans = CountedRealloc(canvas->spans, (size_t)canvas->height * 2 * sizeof(int));
+    if (!spans) return false;
+    for (int y = 0; y < canvas->height; y++) {
+        const Color* row = canvas->pixels + y * canvas->width;
+        int first = 0, last = canvas->width;
+        while (first < last && row[first].a == 0) first++;
+        while (last > first && row[last - 1].a == 0) last--;
+        spans[2 * y] = first;
+        spans[2 * y + 1] = last;
+    }
+    canvas->spans = spans;
+    return true;
+}
+
+// a * b / 255, exact when either side is 0 or 255
+static inline unsigned char Mul255(int a, int b) {
+    return (unsigned char)((a * (b + 1)) >> 8);
+}
+
+// Every channel, alpha included, is weighted by the source alpha, as
+// glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) does; two channels
+// per multiply.
+static inline void BlendPixel(Color* dst, Color src) {
+    if (src.a == 255) {
+        *dst = src;
+        return;
+    }
+    uint32_t s, d;
+    memcpy(&s, &src, sizeof(s));
+    memcpy(&d, dst, sizeof(d));
+    uint32_t alpha = src.a + (src.a >> 7);
+    uint32_t inverse = 256 - alpha;
+    uint32_t rb = (((s & 0x00FF00FF) * alpha + (d & 0x00FF00FF) * inverse) >> 8) & 0x00FF00FF;
+    uint32_t ga = (((s >> 8) & 0x00FF00FF) * alpha + ((d >> 8) & 0x00FF00FF) * inverse) & 0xFF00FF00;
+    uint32_t out = rb | ga;
+    memcpy(dst, &out, sizeof(out));
+}
+
+// Pixel span whose centres fall inside [start, start + length)
+static void Span(float start, float length, int limit, int* first, int* last) {
+    *first = (int)floorf(start + 0.5f);
+    *last = (int)floorf(start + length + 0.5f);
+    if (*first < 0) *first = 0;
+    if (*last > limit) *last = limit;
+}
+
+void SoftClear(SoftCanvas* canvas, Color color) {
+    int count = canvas->width * canvas->height;
+    for (int i = 0; i < count; i++) canvas->pixels[i] = color;
+}
+
+void SoftFillRect(SoftCanvas* canvas, Rectangle rect, Color color) {
+    if (color.a == 0) return;
+    int x0, x1, y0, y1;
+    Span(rect.x, rect.width, canvas->width, &x0, &x1);
+    Span(rect.y, rect.height, canvas->height, &y0, &y1);
+    for (int y = y0; y < y1; y++) {
+        Color* row = canvas->pixels + y * canvas->width;
+        for (int x = x0; x < x1; x++) BlendPixel(&row[x], color);
+    }
+}
+
+// Distance outside a rect whose corners are rounded by `radius`; <= 0 inside
+static float RoundedDistance(Rectangle rect, float radius, float px, float py) {
+    float cx = fminf(fmaxf(px, rect.x + radius), rect.x + rect.width - radius);
+    float cy = fminf(fmaxf(py, rect.y + radius), rect.y + rect.height - radius);
+    return hypotf(px - cx, py - cy) - radius;
+}
+
+static void FillRounded(SoftCanvas* canvas, Rectangle rect, float roundness, float thickness, Color color) {
+    if (color.a == 0 || rect.width <= 0 || rect.height <= 0) return;
+    float radius = roundness * fminf(rect.width, rect.height) / 2;
+    int x0, x1, y0, y1;
+    Span(rect.x, rect.width, canvas->width, &x0, &x1);
+    Span(rect.y, rect.height, canvas->height, &y0, &y1);
+    for (int y = y0; y < y1; y++) {
+        Color* row = canvas->pixels + y * canvas->width;
+        for (int x = x0; x < x1; x++) {
+            float distance = RoundedDistance(rect, radius, x + 0.5f, y + 0.5f);
+            if (distance > 0 || (thickness > 0 && distance <= -thickness)) continue;
+            BlendPixel(&row[x], color);
+        }
+    }
+}
+
+void SoftFillRoundedRect(SoftCanvas* canvas, Rectangle rect, float roundness, Color color) {
+    FillRounded(canvas, rect, roundness, 0, color);
+}
+
+void SoftRoundedRectLines(SoftCanvas* canvas, Rectangle rect, float roundness, Color color) {
+    FillRounded(canvas, rect, roundness, 1, color);
+}
+
+void SoftRectLines(SoftCanvas* canvas, Rectangle rect, float thickness, Color color) {
+    float t = fminf(thickness, fminf(rect.width, rect.height) / 2);
+    SoftFillRect(canvas, (Rectangle){ rect.x, rect.y, rect.width, t }, color);
+    SoftFillRect(canvas, (Rectangle){ rect.x, rect.y + rect.height - t, rect.width, t }, color);
+    SoftFillRect(canvas, (Rectangle){ rect.x, rect.y + t, t, rect.height - 2 * t }, color);
+    SoftFillRect(canvas, (Rectangle){ rect.x + rect.width - t, rect.y + t, t, rect.height - 2 * t }, color);
+}
+
+// Nearest-neighbour, like the GPU path's point-filtered textures; the
+// texel is tinted, then alpha blended.
+void SoftBlit(SoftCanvas* canvas, const SoftCanvas* texture, Rectangle source, Rectangle dest, Color tint) {
+    if (tint.a == 0 || dest.width <= 0 || dest.height <= 0 || !texture->pixels) return;
+    int x0, x1, y0, y1;
+    Span(dest.x, dest.width, canvas->width, &x0, &x1);
+    Span(dest.y, dest.height, canvas->height, &y0, &y1);
+    if (x0 >= x1 || y0 >= y1) return;
+    float stepX = source.width / dest.width;
+    float stepY = source.height / dest.height;
+    int minX = (int)source.x, maxX = (int)(source.x + source.width) - 1;
+    int minY = (int)source.y, maxY = (int)(source.y + source.height) - 1;
+    if (minX < 0) minX = 0;
+    if (minY < 0) minY = 0;
+    if (maxX >= texture->width) maxX = texture->width - 1;
+    if (maxY >= texture->height) maxY = texture->height - 1;
+    bool white = tint.r == 255 && tint.g == 255 && tint.b == 255 && tint.a == 255;
+    // Texel coordinates step in 16.16 fixed point across the span
+    int32_t stepU = (int32_t)(stepX * 65536.0f);
+    int32_t startU = (int32_t)((source.x + (x0 + 0.5f - dest.x) * stepX) * 65536.0f);
+    for (int y = y0; y < y1; y++) {
+        int v = (int)floorf(source.y + (y + 0.5f - dest.y) * stepY);
+        v = v < minY ? minY : (v > maxY ? maxY : v);
+        const Color* texels = texture->pixels + v * texture->width;
+        Color* row = canvas->pixels + y * canvas->width;
+        int first = x0, last = x1;
+        if (texture->spans) {
+            // Pixels sampling the row's visible columns, give or take one for rounding
+            int from = texture->spans[2 * v], to = texture->spans[2 * v + 1];
+            if (from >= to) continue;
+            int spanFirst = (int)floorf(dest.x + (from - source.x) / stepX - 0.5f);
+            int spanLast = (int)ceilf(dest.x + (to - source.x) / stepX + 0.5f);
+            if (spanFirst > first) first = spanFirst;
+            if (spanLast < last) last = spanLast;
+        }
+        int32_t uFixed = startU + (first - x0) * stepU;
+        for (int x = first; x < last; x++, uFixed += stepU) {
+            int u = uFixed >> 16;
+            u = u < minX ? minX : (u > maxX ? maxX : u);
+            Color texel = texels[u];
+            if (texel.a == 0) continue;
+            if (!white) {
+                texel = (Color){ Mul255(texel.r, tint.r), Mul255(texel.g, tint.g),
+                                 Mul255(texel.b, tint.b), Mul255(texel.a, tint.a) };
+            }
+            BlendPixel(&row[x], texel);
+        }
+    }
+}
+
+static float FontScale(int fontSize) {
+    return fontSize > FONT_BASE_SIZE ? (float)fontSize / FONT_BASE_SIZE : 1.0f;
+}
+
+int SoftMeasureText(const char* text, int fontSize) {
+    int length = (int)strlen(text);
+    if (length == 0) return 0;
+    return (int)((length * FONT_ADVANCE - 1) * FontScale(fontSize));
+}
+
+// Glyphs sit one font pixel below `posY`, inside a FONT_BASE_SIZE-tall cell
+void SoftText(SoftCanvas* canvas, const char* text, int posX, int posY, int fontSize, Color color) {
+    float scale = FontScale(fontSize);
+    float penX = posX;
+    for (const unsigned char* c = (const unsigned char*)text; *c; c++, penX += FONT_ADVANCE * scale) {
+        const unsigned char* glyph = FONT_5X7[(*c >= 32 && *c <= 126 ? *c : '?') - 32];
+        for (int column = 0; column < 5; column++) {
+            for (int row = 0; row < 7; row++) {
+                if (!(glyph[column] & (1 << row))) continue;
+                SoftFillRect(canvas, (Rectangle){ penX + column * scale, posY + (row + 1) * scale, scale, scale }, color);
+            }
+        }
+    }
+}
+
+// Additive radial ramp from `inner` at the centre to `outer` at `radius`,
+// like DrawCircleGradient() under BLEND_ADDITIVE
+void SoftAddCircleGradient(SoftCanvas* canvas, Vector2 center, float radius, Color inner, Color outer) {
+    if (radius <= 0) return;
+    int x0, x1, y0, y1;
+    Span(center.x - radius, 2 * radius, canvas->width, &x0, &x1);
+    Span(center.y - radius, 2 * radius, canvas->height, &y0, &y1);
+    for (int y = y0; y < y1; y++) {
+        Color* row = canvas->pixels + y * canvas->width;
+        for (int x = x0; x < x1; x++) {
+            float t = hypotf(x + 0.5f - center.x, y + 0.5f - center.y) / radius;
+            if (t >= 1.0f) continue;
+            float a = (inner.a + (outer.a - inner.a) * t) / 255.0f;
+            int r = row[x].r + (int)((inner.r + (outer.r - inner.r) * t) * a);
+            int g = row[x].g + (int)((inner.g + (outer.g - inner.g) * t) * a);
+            int b = row[x].b + (int)((inner.b + (outer.b - inner.b) * t) * a);
+            row[x].r = r > 255 ? 255 : r;
+            row[x].g = g > 255 ? 255 : g;
+            row[x].b = b > 255 ? 255 : b;
+        }
+    }
+}
+
+// Stretches `factor` over the whole canvas with bilinear filtering and
+// multiplies it in, like BLEND_MULTIPLIED with an opaque source
+void SoftMultiply(SoftCanvas* canvas, const SoftCanvas* factor) {
+    float stepX = (float)factor->width / canvas->width;
+    float stepY = (float)factor->height / canvas->height;
+    for (int y = 0; y < canvas->height; y++) {
+        float v = fmaxf((y + 0.5f) * stepY - 0.5f, 0.0f);
+        int v0 = (int)v;
+        int v1 = v0 + 1 < factor->height ? v0 + 1 : v0;
+        int fy = (int)((v - v0) * 256);
+        const Color* top = factor->pixels + v0 * factor->width;
+        const Color* bottom = factor->pixels + v1 * factor->width;
+        Color* row = canvas->pixels + y * canvas->width;
+        for (int x = 0; x < canvas->width; x++) {
+            float u = fmaxf((x + 0.5f) * stepX - 0.5f, 0.0f);
+            int u0 = (int)u;
+            int u1 = u0 + 1 < factor->width ? u0 + 1 : u0;
+            int fx = (int)((u - u0) * 256);
+            Color a = top[u0], b = top[u1], c = bottom[u0], d = bottom[u1];
+            int r = ((a.r * (256 - fx) + b.r * fx) * (256 - fy) + (c.r * (256 - fx) + d.r * fx) * fy) >> 16;
+            int g = ((a.g * (256 - fx) + b.g * fx) * (256 - fy) + (c.g * (256 - fx) + d.g * fx) * fy) >> 16;
+            int bl = ((a.b * (256 - fx) + b.b * fx) * (256 - fy) + (c.b * (256 - fx) + d.b * fx) * fy) >> 16;
+            row[x].r = Mul255(row[x].r, r);
+            row[x].g = Mul255(row[x].g, g);
+            row[x].b = Mul255(row[x].b, bl);
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef SOFTRASTER_H
+#define SOFTRASTER_H
+#include "raylib.h"
+#include "types.h"
+#include <stdbool.h>
+
+bool InitSoftCanvas(SoftCanvas* canvas, int width, int height);
+void FreeSoftCanvas(SoftCanvas* canvas);
+bool TrimSoftCanvas(SoftCanvas* canvas);
+void SoftClear(SoftCanvas* canvas, Color color);
+void SoftFillRect(SoftCanvas* canvas, Rectangle rect, Color color);
+void SoftFillRoundedRect(SoftCanvas* canvas, Rectangle rect, float roundness, Color color);
+void SoftRectLines(SoftCanvas* canvas, Rectangle rect, float thickness, Color color);
+void SoftRoundedRectLines(SoftCanvas* canvas, Rectangle rect, float roundness, Color color);
+void SoftBlit(SoftCanvas* canvas, const SoftCanvas* texture, Rectangle source, Rectangle dest, Color tint);
+void SoftText(SoftCanvas* canvas, const char* text, int posX, int posY, int fontSize, Color color);
+int SoftMeasureText(const char* text, int fontSize);
+void SoftAddCircleGradient(SoftCanvas* canvas, Vector2 center, float radius, Color inner, Color outer);
+void SoftMultiply(SoftCanvas* canvas, const SoftCanvas* factor);
+
+#endif
@@ -22,7 +22,11 @@ void UnloadSounds(GameState* game) {
     CloseAudioDevice();
 }
 
+// Gameplay code also runs headless (replay verification, tools) where no
+// audio device was ever opened, so the in-sim sounds check for it first.
+// Ticks re-run by a rollback already made their sound the first time.
 void PlayJumpSound(GameState* game) {
+    if (!IsAudioDeviceReady() || game->resimulating) return;
     PlaySound(game->jumpSound);
 }
 
@@ -41,6 +45,7 @@ void PlayWinSound(GameState* game) {
 }
 
 void PlayMeteorImpactSound(GameState* game) {
+    if (!IsAudioDeviceReady() || game->resimulating) return;
     PlaySound(game->meteorImpactSound);
 }
 
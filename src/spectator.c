@@ -0,0 +1,204 @@
+#include "spectator.h"
+#include <string.h>
+
+#define HEADER_BYTES 7
+#define ENTITY_BYTES 9
+
+enum {
+    CHANGED_SCORE = 1 << 0,
+    CHANGED_FLAGS = 1 << 1,
+    CHANGED_HP = 1 << 2,
+    CHANGED_BOSS_HP = 1 << 3,
+    CHANGED_PROJECTILES = 1 << 4
+};
+
+static uint8_t* Put8(uint8_t* out, uint8_t value) {
+    *out = value;
+    return out + 1;
+}
+
+static uint8_t* Put16(uint8_t* out, uint16_t value) {
+    out[0] = (uint8_t)value;
+    out[1] = (uint8_t)(value >> 8);
+    return out + 2;
+}
+
+static uint8_t* Put32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+    return out + 4;
+}
+
+static uint16_t Get16(const uint8_t* in) {
+    return (uint16_t)(in[0] | in[1] << 8);
+}
+
+static uint32_t Get32(const uint8_t* in) {
+    return (uint32_t)in[0] | (uint32_t)in[1] << 8 | (uint32_t)in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+static uint8_t* PutEntity(uint8_t* out, const SpectatorEntity* entity) {
+    out = Put8(out, entity->sprite);
+    out = Put16(out, (uint16_t)entity->x);
+    out = Put16(out, (uint16_t)entity->y);
+    out = Put16(out, entity->width);
+    return Put16(out, entity->height);
+}
+
+static SpectatorEntity GetEntity(const uint8_t* in) {
+    return (SpectatorEntity){ in[0], (int16_t)Get16(in + 1), (int16_t)Get16(in + 3), Get16(in + 5), Get16(in + 7) };
+}
+
+static uint8_t* PutHeader(uint8_t* out, SpectatorMessageType type, uint32_t tick) {
+    out = Put16(out, 0); // patched once the length is known
+    out = Put8(out, type);
+    return Put32(out, tick);
+}
+
+static int Finish(uint8_t* start, const uint8_t* end) {
+    int length = (int)(end - start);
+    Put16(start, (uint16_t)length);
+    return length;
+}
+
+// Returns the message length; `out` needs SPECTATOR_MAX_MESSAGE bytes
+int EncodeSpectatorKey(const SpectatorFrame* frame, uint8_t* out) {
+    uint8_t* p = PutHeader(out, SPECTATOR_KEY, frame->tick);
+    p = Put32(p, (uint32_t)frame->score);
+    p = Put16(p, frame->flags);
+    p = Put16(p, (uint16_t)frame->hp);
+    p = Put16(p, (uint16_t)frame->bossHP);
+    p = Put16(p, frame->projectiles);
+    uint8_t* count = p++;
+    *count = 0;
+    for (int id = 0; id < SPECTATOR_MAX_ENTITIES; id++) {
+        if (!(frame->present & (1u << id))) continue;
+        p = Put8(p, (uint8_t)id);
+        p = PutEntity(p, &frame->entities[id]);
+        (*count)++;
+    }
+    return Finish(out, p);
+}
+
+static bool FitsByte(int value) {
+    return value >= -128 && value <= 127;
+}
+
+// What changed from `base` to `frame`. Each list starts with its count.
+int EncodeSpectatorDelta(const SpectatorFrame* base, const SpectatorFrame* frame, uint8_t* out) {
+    uint8_t* p = PutHeader(out, SPECTATOR_DELTA, frame->tick);
+    uint8_t changed = 0;
+    if (frame->score != base->score) changed |= CHANGED_SCORE;
+    if (frame->flags != base->flags) changed |= CHANGED_FLAGS;
+    if (frame->hp != base->hp) changed |= CHANGED_HP;
+    if (frame->bossHP != base->bossHP) changed |= CHANGED_BOSS_HP;
+    if (frame->projectiles != base->projectiles) changed |= CHANGED_PROJECTILES;
+    p = Put8(p, changed);
+    if (changed & CHANGED_SCORE) p = Put32(p, (uint32_t)frame->score);
+    if (changed & CHANGED_FLAGS) p = Put16(p, frame->flags);
+    if (changed & CHANGED_HP) p = Put16(p, (uint16_t)frame->hp);
+    if (changed & CHANGED_BOSS_HP) p = Put16(p, (uint16_t)frame->bossHP);
+    if (changed & CHANGED_PROJECTILES) p = Put16(p, frame->projectiles);
+
+    uint32_t removed = base->present & ~frame->present;
+    uint32_t full = 0, sprites = 0, moves = 0;
+    for (int id = 0; id < SPECTATOR_MAX_ENTITIES; id++) {
+        uint32_t bit = 1u << id;
+        if (!(frame->present & bit)) continue;
+        const SpectatorEntity* now = &frame->entities[id];
+        const SpectatorEntity* was = &base->entities[id];
+        if (!(base->present & bit) || now->width != was->width || now->height != was->height ||
+            !FitsByte(now->x - was->x) || !FitsByte(now->y - was->y)) {
+            full |= bit;
+            continue;
+        }
+        if (now->sprite != was->sprite) sprites |= bit;
+        if (now->x != was->x || now->y != was->y) moves |= bit;
+    }
+    uint32_t lists[] = { removed, full, sprites, moves };
+    for (int list = 0; list < 4; list++) {
+        uint8_t* count = p++;
+        *count = 0;
+        for (int id = 0; id < SPECTATOR_MAX_ENTITIES; id++) {
+            if (!(lists[list] & (1u << id))) continue;
+            const SpectatorEntity* now = &frame->entities[id];
+            const SpectatorEntity* was = &base->entities[id];
+            p = Put8(p, (uint8_t)id);
+            if (list == 1) p = PutEntity(p, now);
+            if (list == 2) p = Put8(p, now->sprite);
+            if (list == 3) {
+                p = Put8(p, (uint8_t)(int8_t)(now->x - was->x));
+                p = Put8(p, (uint8_t)(int8_t)(now->y - was->y));
+            }
+            (*count)++;
+        }
+    }
+    return Finish(out, p);
+}
+
+// Applies one message from the front of `data` to `state`. Returns the
+// bytes it used, 0 when the message hasn't fully arrived yet, or -1 when
+// the stream is corrupt.
+int DecodeSpectatorMessage(const uint8_t* data, int length, SpectatorFrame* state) {
+    if (length < HEADER_BYTES) return 0;
+    int size = Get16(data);
+    if (size < HEADER_BYTES || size > SPECTATOR_MAX_MESSAGE) return -1;
+    if (length < size) return 0;
+    const uint8_t* p = data + HEADER_BYTES;
+    const uint8_t* end = data + size;
+    uint8_t type = data[2];
+    state->tick = Get32(data + 3);
+    // Every read below is bounds-checked against the declared size
+#define NEED(bytes) do { if (end - p < (bytes)) return -1; } while (0)
+    if (type == SPECTATOR_KEY) {
+        NEED(13);
+        state->score = (int32_t)Get32(p);
+        state->flags = Get16(p + 4);
+        state->hp = (int16_t)Get16(p + 6);
+        state->bossHP = (int16_t)Get16(p + 8);
+        state->projectiles = Get16(p + 10);
+        int count = p[12];
+        p += 13;
+        state->present = 0;
+        for (int i = 0; i < count; i++) {
+            NEED(1 + ENTITY_BYTES);
+            int id = p[0];
+            if (id >= SPECTATOR_MAX_ENTITIES) return -1;
+            state->entities[id] = GetEntity(p + 1);
+            state->present |= 1u << id;
+            p += 1 + ENTITY_BYTES;
+        }
+        return size;
+    }
+    if (type != SPECTATOR_DELTA) return -1;
+    NEED(1);
+    uint8_t changed = *p++;
+    if (changed & CHANGED_SCORE) { NEED(4); state->score = (int32_t)Get32(p); p += 4; }
+    if (changed & CHANGED_FLAGS) { NEED(2); state->flags = Get16(p); p += 2; }
+    if (changed & CHANGED_HP) { NEED(2); state->hp = (int16_t)Get16(p); p += 2; }
+    if (changed & CHANGED_BOSS_HP) { NEED(2); state->bossHP = (int16_t)Get16(p); p += 2; }
+    if (changed & CHANGED_PROJECTILES) { NEED(2); state->projectiles = Get16(p); p += 2; }
+    static const int RECORD_BYTES[] = { 1, 1 + ENTITY_BYTES, 2, 3 };
+    for (int list = 0; list < 4; list++) {
+        NEED(1);
+        int count = *p++;
+        for (int i = 0; i < count; i++) {
+            NEED(RECORD_BYTES[list]);
+            int id = p[0];
+            if (id >= SPECTATOR_MAX_ENTITIES) return -1;
+            SpectatorEntity* entity = &state->entities[id];
+            if (list == 0) state->present &= ~(1u << id);
+            if (list == 1) {
+                *entity = GetEntity(p + 1);
+                state->present |= 1u << id;
+            }
+            if (list == 2) entity->sprite = p[1];
+            if (list == 3) {
+                entity->x = (int16_t)(entity->x + (int8_t)p[1]);
+                entity->y = (int16_t)(entity->y + (int8_t)p[2]);
+            }
+            p += RECORD_BYTES[list];
+        }
+    }
+#undef NEED
+    return size;
+}
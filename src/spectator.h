@@ -0,0 +1,60 @@
+#ifndef SPECTATOR_H
+#define SPECTATOR_H
+#include <stdbool.h>
+#include <stdint.h>
+
+// Wire format of the spectator broadcast. Plain C with no raylib
+// dependency, like livestate.h, so a thin client only needs this header
+// and spectator.c. Multi-byte fields are little-endian; positions and
+// sizes are in SPECTATOR_QUANTUM steps of the 1600x900 base resolution.
+//
+// Every message is [u16 length][u8 type][u32 tick] and a body. A key
+// message carries the whole state; a delta carries what changed since the
+// message before it: removed entities, new or resized ones in full,
+// sprite changes, and position changes as signed byte offsets.
+
+#define SPECTATOR_DEFAULT_PORT "8790"
+#define SPECTATOR_QUANTUM 0.5f
+#define SPECTATOR_PLAYER_IDS 8
+#define SPECTATOR_OBSTACLE_IDS 8
+#define SPECTATOR_METEOR_IDS 16
+#define SPECTATOR_FIRST_OBSTACLE SPECTATOR_PLAYER_IDS
+#define SPECTATOR_FIRST_METEOR (SPECTATOR_FIRST_OBSTACLE + SPECTATOR_OBSTACLE_IDS)
+#define SPECTATOR_MAX_ENTITIES (SPECTATOR_FIRST_METEOR + SPECTATOR_METEOR_IDS)
+#define SPECTATOR_MAX_MESSAGE 1024
+#define SPECTATOR_EMPTY_DELTA 12 // header, change mask and four empty lists
+#define SPECTATOR_FADED 0x80 // sprite bit: a knocked-out dino
+
+typedef enum {
+    SPECTATOR_KEY = 1,
+    SPECTATOR_DELTA = 2
+} SpectatorMessageType;
+
+typedef struct {
+    uint8_t sprite; // SpriteId, plus SPECTATOR_FADED
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+} SpectatorEntity;
+
+// Entities are indexed by id: players first, then obstacle and meteor
+// pool slots, so an entity keeps its id for as long as it is on screen.
+typedef struct {
+    uint32_t tick;
+    int32_t score;
+    uint16_t flags; // LiveFlags
+    int16_t hp;
+    int16_t bossHP;
+    uint16_t projectiles;
+    uint32_t present; // one bit per entity id
+    SpectatorEntity entities[SPECTATOR_MAX_ENTITIES];
+} SpectatorFrame;
+
+_Static_assert(SPECTATOR_MAX_ENTITIES <= 32, "presence is a 32-bit mask");
+
+int EncodeSpectatorKey(const SpectatorFrame* frame, uint8_t* out);
+int EncodeSpectatorDelta(const SpectatorFrame* base, const SpectatorFrame* frame, uint8_t* out);
+int DecodeSpectatorMessage(const uint8_t* data, int length, SpectatorFrame* state);
+
+#endif
@@ -0,0 +1,183 @@
+#include "telemetry.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#define TELEMETRY_IDLE_FLUSH_POLLS 50
+#define TELEMETRY_POLL_NS 20000000L
+#define MAX_VARINT_BYTES 10
+
+void RecordTelemetry(TelemetryLog* log, uint32_t tick, TelemetryEventType type, int detail, int64_t value) {
+    if (!log) return;
+    unsigned tail = atomic_load_explicit(&log->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&log->head, memory_order_acquire);
+    if (tail - head >= TELEMETRY_QUEUE_CAPACITY) {
+        atomic_fetch_add_explicit(&log->dropped, 1, memory_order_relaxed);
+        return;
+    }
+    log->queue[tail % TELEMETRY_QUEUE_CAPACITY] = (TelemetryEvent){ tick, type, detail, value };
+    atomic_store_explicit(&log->tail, tail + 1, memory_order_release);
+}
+
+static uint64_t ZigZag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static int64_t UnZigZag(uint64_t value) {
+    return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static int PutVarint(uint8_t* out, uint64_t value) {
+    int length = 0;
+    while (value >= 0x80) {
+        out[length++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (uint8_t)value;
+    return length;
+}
+
+// Returns bytes consumed, 0 when the varint runs past `end`
+static int GetVarint(const uint8_t* in, const uint8_t* end, uint64_t* value) {
+    *value = 0;
+    for (int length = 0; length < MAX_VARINT_BYTES && in + length < end; length++) {
+        *value |= (uint64_t)(in[length] & 0x7F) << (7 * length);
+        if (!(in[length] & 0x80)) return length + 1;
+    }
+    return 0;
+}
+
+static void WriteBlock(FILE* file, const TelemetryEvent* events, int count) {
+    uint8_t ticks[TELEMETRY_BLOCK_EVENTS * MAX_VARINT_BYTES];
+    uint8_t types[TELEMETRY_BLOCK_EVENTS];
+    uint8_t details[TELEMETRY_BLOCK_EVENTS];
+    uint8_t values[TELEMETRY_BLOCK_EVENTS * MAX_VARINT_BYTES];
+    TelemetryBlockHeader header = { .version = TELEMETRY_VERSION, .columns = TELEMETRY_COLUMNS, .count = count };
+    memcpy(header.magic, TELEMETRY_MAGIC, sizeof(header.magic));
+    int64_t previousTick = 0;
+    for (int i = 0; i < count; i++) {
+        header.columnBytes[0] += PutVarint(ticks + header.columnBytes[0], ZigZag((int64_t)events[i].tick - previousTick));
+        previousTick = events[i].tick;
+        types[i] = events[i].type;
+        details[i] = events[i].detail;
+        header.columnBytes[3] += PutVarint(values + header.columnBytes[3], ZigZag(events[i].value));
+    }
+    header.columnBytes[1] = count;
+    header.columnBytes[2] = count;
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(ticks, 1, header.columnBytes[0], file);
+    fwrite(types, 1, count, file);
+    fwrite(details, 1, count, file);
+    fwrite(values, 1, header.columnBytes[3], file);
+    fflush(file);
+}
+
+// Batches events into blocks; a block is written when full, at the end of
+// a run, or after about a second without new events.
+static void* TelemetryWorker(void* arg) {
+    TelemetryLog* log = arg;
+    TelemetryEvent* block = log->block;
+    int count = 0;
+    int idlePolls = 0;
+    for (;;) {
+        bool running = atomic_load_explicit(&log->running, memory_order_acquire);
+        unsigned head = atomic_load_explicit(&log->head, memory_order_relaxed);
+        unsigned tail = atomic_load_explicit(&log->tail, memory_order_acquire);
+        bool runEnded = false;
+        for (; head != tail && count < TELEMETRY_BLOCK_EVENTS; head++) {
+            block[count] = log->queue[head % TELEMETRY_QUEUE_CAPACITY];
+            runEnded |= block[count].type == TELEMETRY_RUN_END;
+            count++;
+        }
+        atomic_store_explicit(&log->head, head, memory_order_release);
+        idlePolls = head == tail && !runEnded ? idlePolls + 1 : 0;
+        if (count > 0 && (count == TELEMETRY_BLOCK_EVENTS || runEnded || idlePolls >= TELEMETRY_IDLE_FLUSH_POLLS || !running)) {
+            WriteBlock(log->file, block, count);
+            count = 0;
+        }
+        if (!running && head == tail) break;
+        if (head == tail) {
+            struct timespec pause = { 0, TELEMETRY_POLL_NS };
+            nanosleep(&pause, NULL);
+        }
+    }
+    return NULL;
+}
+
+// Appends to `path`; NULL when the file or the thread can't be had, and
+// every RecordTelemetry() on NULL is a no-op.
+TelemetryLog* StartTelemetry(const char* path) {
+    mkdir(TELEMETRY_DIRECTORY, 0755);
+    TelemetryLog* log = calloc(1, sizeof(TelemetryLog));
+    if (!log) return NULL;
+    log->file = fopen(path, "ab");
+    if (!log->file) {
+        free(log);
+        return NULL;
+    }
+    atomic_store(&log->running, true);
+    if (pthread_create(&log->thread, NULL, TelemetryWorker, log) != 0) {
+        fclose(log->file);
+        free(log);
+        return NULL;
+    }
+    return log;
+}
+
+// Writes out whatever is still queued before returning
+void StopTelemetry(TelemetryLog* log) {
+    if (!log) return;
+    atomic_store_explicit(&log->running, false, memory_order_release);
+    pthread_join(log->thread, NULL);
+    fclose(log->file);
+    free(log);
+}
+
+// Decodes the next block: its event count, 0 at end of file, -1 if the
+// block is damaged or bigger than `capacity`.
+int ReadTelemetryBlock(FILE* file, TelemetryEvent* events, int capacity) {
+    TelemetryBlockHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1) return 0;
+    if (memcmp(header.magic, TELEMETRY_MAGIC, sizeof(header.magic)) != 0 || header.version != TELEMETRY_VERSION ||
+        header.columns != TELEMETRY_COLUMNS || header.count > (uint32_t)capacity ||
+        header.columnBytes[1] != header.count || header.columnBytes[2] != header.count ||
+        header.columnBytes[0] > header.count * MAX_VARINT_BYTES || header.columnBytes[3] > header.count * MAX_VARINT_BYTES) {
+        return -1;
+    }
+    size_t total = 0;
+    for (int c = 0; c < TELEMETRY_COLUMNS; c++) total += header.columnBytes[c];
+    uint8_t* data = malloc(total ? total : 1);
+    if (!data || fread(data, 1, total, file) != total) {
+        free(data);
+        return -1;
+    }
+    const uint8_t* ticks = data;
+    const uint8_t* types = ticks + header.columnBytes[0];
+    const uint8_t* details = types + header.count;
+    const uint8_t* values = details + header.count;
+    const uint8_t* ticksEnd = types;
+    const uint8_t* valuesEnd = values + header.columnBytes[3];
+    int64_t tick = 0;
+    int count = header.count;
+    for (int i = 0; i < count; i++) {
+        uint64_t raw;
+        int used = GetVarint(ticks, ticksEnd, &raw);
+        if (!used) break;
+        ticks += used;
+        tick += UnZigZag(raw);
+        events[i].tick = (uint32_t)tick;
+        events[i].type = types[i];
+        events[i].detail = details[i];
+        used = GetVarint(values, valuesEnd, &raw);
+        if (!used) break;
+        values += used;
+        events[i].value = UnZigZag(raw);
+        if (i == count - 1) {
+            free(data);
+            return count;
+        }
+    }
+    free(data);
+    return count == 0 ? 0 : -1;
+}
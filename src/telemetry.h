@@ -0,0 +1,44 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+#include "types.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define TELEMETRY_DIRECTORY "telemetry"
+#define TELEMETRY_FILE "telemetry/events.dtl"
+#define TELEMETRY_MAGIC "DTLM"
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_COLUMNS 4
+
+// Single-producer/single-consumer: whichever thread steps the game
+// records, the writer thread encodes and appends. A full queue drops events rather than stall the game.
+struct TelemetryLog {
+    TelemetryEvent queue[TELEMETRY_QUEUE_CAPACITY];
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_uint dropped;
+    atomic_bool running;
+    pthread_t thread;
+    FILE* file;
+    TelemetryEvent block[TELEMETRY_BLOCK_EVENTS];
+};
+
+// On disk: blocks of up to TELEMETRY_BLOCK_EVENTS events, each a header
+// followed by one column per field - tick as zigzag varint deltas, type
+// and detail as raw bytes, value as zigzag varints.
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t columns;
+    uint32_t count;
+    uint32_t columnBytes[TELEMETRY_COLUMNS];
+} TelemetryBlockHeader;
+
+TelemetryLog* StartTelemetry(const char* path);
+void StopTelemetry(TelemetryLog* log);
+void RecordTelemetry(TelemetryLog* log, uint32_t tick, TelemetryEventType type, int detail, int64_t value);
+int ReadTelemetryBlock(FILE* file, TelemetryEvent* events, int capacity);
+
+#endif
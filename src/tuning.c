@@ -0,0 +1,103 @@
+#include "tuning.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DEFAULT_TUNING_VALUES { 1.5f, 2.0f, 0.7f, 1.2f, 700.0f, 0.5f, 1.5f, 100.0f }
+
+const TuningParams DEFAULT_TUNING = DEFAULT_TUNING_VALUES;
+
+// Ranges keep every candidate playable: the scheduler can still fit a
+// clearable obstacle at the top speed, and the boss never comes before
+// the pre-boss lull has had room to start
+const TuningParamInfo TUNING_PARAMS[TUNING_PARAM_COUNT] = {
+    { "min_spawn_interval", offsetof(TuningParams, minSpawnInterval), 0.5f, 4.0f },
+    { "max_spawn_interval", offsetof(TuningParams, maxSpawnInterval), 0.5f, 4.0f },
+    { "hard_min_spawn_interval", offsetof(TuningParams, hardMinSpawnInterval), 0.3f, 3.0f },
+    { "hard_max_spawn_interval", offsetof(TuningParams, hardMaxSpawnInterval), 0.3f, 3.0f },
+    { "obstacle_speed", offsetof(TuningParams, obstacleSpeed), 400.0f, 1100.0f },
+    { "meteor_spawn_interval_min", offsetof(TuningParams, meteorSpawnIntervalMin), 0.2f, 4.0f },
+    { "meteor_spawn_interval_max", offsetof(TuningParams, meteorSpawnIntervalMax), 0.2f, 4.0f },
+    { "boss_threshold_score", offsetof(TuningParams, bossThresholdScore), 40.0f, 1000.0f }
+};
+
+static TuningParams active = DEFAULT_TUNING_VALUES;
+
+const TuningParams* GetTuning(void) {
+    return &active;
+}
+
+// Only between runs: the sim and the obstacle scheduler read the table
+// without locking
+void SetTuning(const TuningParams* params) {
+    active = *params;
+    ClampTuning(&active);
+}
+
+float* TuningValue(TuningParams* params, int index) {
+    return (float*)((char*)params + TUNING_PARAMS[index].offset);
+}
+
+float ReadTuningValue(const TuningParams* params, int index) {
+    return *(const float*)((const char*)params + TUNING_PARAMS[index].offset);
+}
+
+void ClampTuning(TuningParams* params) {
+    for (int i = 0; i < TUNING_PARAM_COUNT; i++) {
+        float* value = TuningValue(params, i);
+        if (isnan(*value)) *value = ReadTuningValue(&DEFAULT_TUNING, i);
+        *value = fminf(fmaxf(*value, TUNING_PARAMS[i].min), TUNING_PARAMS[i].max);
+    }
+    params->maxSpawnInterval = fmaxf(params->maxSpawnInterval, params->minSpawnInterval);
+    params->hardMaxSpawnInterval = fmaxf(params->hardMaxSpawnInterval, params->hardMinSpawnInterval);
+    params->meteorSpawnIntervalMax = fmaxf(params->meteorSpawnIntervalMax, params->meteorSpawnIntervalMin);
+    params->bossThresholdScore = roundf(params->bossThresholdScore);
+}
+
+// "name value" lines over the defaults; '#' starts a comment and unknown
+// names are skipped. False when the file can't be read, leaving the
+// defaults in `params`.
+bool LoadTuning(const char* path, TuningParams* params) {
+    *params = DEFAULT_TUNING;
+    FILE* file = fopen(path, "r");
+    if (!file) return false;
+    char line[128];
+    while (fgets(line, sizeof(line), file)) {
+        char name[64];
+        float value;
+        if (line[0] == '#' || sscanf(line, "%63s %f", name, &value) != 2) continue;
+        for (int i = 0; i < TUNING_PARAM_COUNT; i++) {
+            if (strcmp(name, TUNING_PARAMS[i].name) == 0) *TuningValue(params, i) = value;
+        }
+    }
+    fclose(file);
+    ClampTuning(params);
+    return true;
+}
+
+// `comment` goes at the top, one '#' line per line of it
+bool SaveTuning(const char* path, const TuningParams* params, const char* comment) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    for (const char* c = comment; c && *c;) {
+        const char* end = strchr(c, '\n');
+        int length = end ? (int)(end - c) : (int)strlen(c);
+        fprintf(file, "# %.*s\n", length, c);
+        c += length + (end ? 1 : 0);
+    }
+    for (int i = 0; i < TUNING_PARAM_COUNT; i++) {
+        fprintf(file, "%s %.9g\n", TUNING_PARAMS[i].name, ReadTuningValue(params, i));
+    }
+    return fclose(file) == 0;
+}
+
+// FNV-1a over the values, so a replay can tell which table it was
+// recorded under
+uint32_t HashTuning(const TuningParams* params) {
+    uint32_t hash = 2166136261u;
+    const unsigned char* bytes = (const unsigned char*)params;
+    for (size_t i = 0; i < sizeof(TuningParams); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
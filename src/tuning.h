@@ -0,0 +1,46 @@
+#ifndef TUNING_H
+#define TUNING_H
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TUNING_FILE "tuning.txt"
+#define TUNING_PARAM_COUNT 8
+
+// Difficulty knobs the sim reads at run time instead of compile-time
+// constants. The game loads TUNING_FILE over the defaults at startup;
+// tools/difficulty_tuner.c searches them and writes such a file. Every
+// field is a float so the tuner can treat them alike.
+typedef struct {
+    float minSpawnInterval;      // seconds between obstacles at the start of a run
+    float maxSpawnInterval;
+    float hardMinSpawnInterval;  // ... once the difficulty ramp tops out
+    float hardMaxSpawnInterval;
+    float obstacleSpeed;         // base pixels per second
+    float meteorSpawnIntervalMin;
+    float meteorSpawnIntervalMax;
+    float bossThresholdScore;
+} TuningParams;
+
+// Name in the file, where it lives, and the range anything loaded or
+// searched is clamped to
+typedef struct {
+    const char* name;
+    size_t offset;
+    float min;
+    float max;
+} TuningParamInfo;
+
+extern const TuningParams DEFAULT_TUNING;
+extern const TuningParamInfo TUNING_PARAMS[TUNING_PARAM_COUNT];
+
+const TuningParams* GetTuning(void);
+void SetTuning(const TuningParams* params);
+float* TuningValue(TuningParams* params, int index);
+float ReadTuningValue(const TuningParams* params, int index);
+void ClampTuning(TuningParams* params);
+bool LoadTuning(const char* path, TuningParams* params);
+bool SaveTuning(const char* path, const TuningParams* params, const char* comment);
+uint32_t HashTuning(const TuningParams* params);
+
+#endif
@@ -0,0 +1,57 @@
+#include "tween.h"
+
+static float Ease(EaseType ease, float t) {
+    switch (ease) {
+        case EASE_IN_QUAD: return t * t;
+        case EASE_OUT_QUAD: return t * (2.0f - t);
+        case EASE_IN_OUT_QUAD: return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+        case EASE_OUT_CUBIC: return 1.0f - (1.0f - t) * (1.0f - t) * (1.0f - t);
+        default: return t;
+    }
+}
+
+// Returns false when the timeline is full; the effect is then skipped
+bool StartTween(Timeline* timeline, Tween tween) {
+    if (timeline->count >= MAX_TWEENS) return false;
+    timeline->tweens[timeline->count++] = tween;
+    return true;
+}
+
+void StopTweens(Timeline* timeline, uint32_t target) {
+    int kept = 0;
+    for (int i = 0; i < timeline->count; i++) {
+        if (timeline->tweens[i].target != target) timeline->tweens[kept++] = timeline->tweens[i];
+    }
+    timeline->count = kept;
+}
+
+// One pass over every running tween. Finished tweens are compacted out in
+// order and their callbacks run afterwards, so a callback can start new
+// tweens; those first advance on the next update.
+void UpdateTimeline(GameState* game, float deltaTime) {
+    Timeline* timeline = &game->timeline;
+    Tween finished[MAX_TWEENS];
+    int finishedCount = 0;
+    int kept = 0;
+    for (int i = 0; i < timeline->count; i++) {
+        Tween* tween = &timeline->tweens[i];
+        tween->elapsed += deltaTime;
+        if (tween->elapsed < tween->delay) {
+            timeline->tweens[kept++] = *tween;
+            continue;
+        }
+        float* value = (float*)((char*)game + tween->target);
+        if (tween->elapsed >= tween->delay + tween->duration) {
+            *value = tween->to;
+            finished[finishedCount++] = *tween;
+            continue;
+        }
+        float t = (tween->elapsed - tween->delay) / tween->duration;
+        *value = tween->from + (tween->to - tween->from) * Ease(tween->ease, t);
+        timeline->tweens[kept++] = *tween;
+    }
+    timeline->count = kept;
+    for (int i = 0; i < finishedCount; i++) {
+        if (finished[i].onComplete) finished[i].onComplete(game, finished[i].tag);
+    }
+}
@@ -0,0 +1,12 @@
+#ifndef TWEEN_H
+#define TWEEN_H
+#include "types.h"
+#include <stddef.h>
+
+#define TWEEN_TARGET(field) ((uint32_t)offsetof(GameState, field))
+
+bool StartTween(Timeline* timeline, Tween tween);
+void StopTweens(Timeline* timeline, uint32_t target);
+void UpdateTimeline(GameState* game, float deltaTime);
+
+#endif
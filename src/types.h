@@ -2,6 +2,8 @@
 #define TYPES_H
 #include "raylib.h"
 #include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
 #define NUM_RESOLUTIONS 4
 #define GROUND_HEIGHT 100
 #define FRAME_DELAY 0.15f
@@ -11,30 +13,54 @@
 #define JUMP_CHARGE_FORCE -4.5f
 #define FAST_FALL_VELOCITY 20.0f
 #define MAX_OBSTACLES 7
-#define MIN_SPAWN_INTERVAL 1.5f
-#define MAX_SPAWN_INTERVAL 2.0f
-#define OBSTACLE_SPEED 700.0f
+// Spawn intervals, obstacle speed and the boss threshold are tuned at run
+// time; see src/tuning.c
+#define DIFFICULTY_RAMP_SCORE 1200
+#define SCHEDULE_CHUNK_TICKS (4 * SIM_TICK_RATE)
+#define SCHEDULE_MAX_CHUNK_SPAWNS 8
+#define SCHEDULE_QUEUE_CHUNKS 4
 #define BIRD_ANIM_DELAY 0.2f
-#define COLLISION_OFFSET 3
 #define DAY_DURATION 20.0f
 #define NIGHT_DURATION 10.0f
 #define FADE_DURATION 0.2f
 #define LIGHT_RADIUS 400.0f
 #define NIGHT_ALPHA 255
 #define FADE_DISTANCE 100.0f
-#define BOSS_THRESHOLD_SCORE 100
+#define LIGHTMAP_SCALE 4
+#define MAX_LIGHTS 64
+#define BOSS_AURA_RADIUS 260.0f
+#define IMPACT_FLASH_TIME 0.4f
 #define BOSS_HP_MAX 3
 #define SCREEN_SHAKE_DURATION 1.0f
 #define SCREEN_SHAKE_INTENSITY 10.0f
-#define PRE_BOSS_THRESHOLD (BOSS_THRESHOLD_SCORE - 20)
+#define PRE_BOSS_MARGIN 20 // obstacles stop this many points before the boss
 #define MAX_METEORS 15
-#define METEOR_SPAWN_INTERVAL_MIN 0.5f
-#define METEOR_SPAWN_INTERVAL_MAX 1.5f
 #define METEOR_FALL_SPEED_X 700.0f
 #define METEOR_FALL_SPEED_Y 1000.0f
 #define METEOR_ANIM_DELAY 0.08f
 #define METEOR_GROUND_LIFETIME 10.0f
 #define METEOR_IMPACT_FRAMES 3
+#define METEOR_MIN_SIZE 100
+#define METEOR_MAX_SIZE 160
+#define ANIM_MAX_CLIP_FRAMES 4
+#define MAX_TWEENS 32
+#define MAX_PLAYERS 8
+#define ANIMATOR_PLAYERS 0
+#define ANIMATOR_OBSTACLES (ANIMATOR_PLAYERS + MAX_PLAYERS)
+#define ANIMATOR_METEORS (ANIMATOR_OBSTACLES + MAX_OBSTACLES)
+#define MAX_ANIMATORS (ANIMATOR_METEORS + MAX_METEORS)
+#define MAX_PROJECTILES 4096
+#define PROJECTILE_RADIUS 6
+#define PROJECTILE_DAMAGE 10
+#define PLAYER_HP_MAX 100
+#define BOSS_ORIGIN_X 1450.0f
+#define BOSS_ORIGIN_Y 180.0f
+#define GRID_CELL_SIZE 64
+#define GRID_ORIGIN_X -128
+#define GRID_ORIGIN_Y -256
+#define GRID_COLUMNS 29
+#define GRID_ROWS 17
+#define GRID_CELLS (GRID_COLUMNS * GRID_ROWS)
 #define MAX_CLOUDS 4
 #define CLOUD_MIN_SPEED 50.0f
 #define CLOUD_MAX_SPEED 150.0f
@@ -42,6 +68,33 @@
 #define CLOUD_MAX_ALPHA 0.9f
 #define CLOUD_SPAWN_INTERVAL_MIN 2.0f
 #define CLOUD_SPAWN_INTERVAL_MAX 5.0f
+#define COLLISION_ALPHA_THRESHOLD 128
+#define SIM_TICK_RATE 60
+#define SIM_DT (1.0f / SIM_TICK_RATE)
+#define MAX_SIM_STEPS_PER_FRAME 8
+#define SIM_SNAPSHOT_COUNT 3
+#define SIM_EFFECT_QUEUE 256
+#define SIM_COMMAND_QUEUE 16
+#define SIM_FRAME_SYNC_MS 4
+#define INPUT_QUEUE_CAPACITY 64
+#define INPUT_LATENCY_SAMPLES 64
+#define GAMEPAD_AXIS_THRESHOLD 0.5f
+#define TELEMETRY_QUEUE_CAPACITY 4096
+#define TELEMETRY_BLOCK_EVENTS 1024
+#define LEADERBOARD_BATCH 32
+#define LEADERBOARD_INBOX 64
+#define ROLLBACK_MAX_FRAMES 8
+#define ROLLBACK_SNAPSHOTS 16
+#define NETPLAY_INPUT_DELAY 2
+#define NETPLAY_INPUT_RING 64
+#define NETPLAY_PACKET_INPUTS 32
+#define NETPLAY_CHECKSUM_INTERVAL 60
+#define NETPLAY_CHECKSUM_RING 8
+#define NETSIM_QUEUE_CAPACITY 256
+#define MAX_EFFECT_EVENTS 16
+#define NEAR_MISS_DISTANCE 24.0f
+#define PARTICLE_POOL_CAPACITY 16384
+#define PARTICLE_FRAME_BUDGET_MS 2.0f
 static const Vector2 BASE_RESOLUTION = { 1600, 900 };
 typedef enum {
     GAME_STATE_MENU,
@@ -49,28 +102,53 @@ typedef enum {
     GAME_STATE_GAME_OVER,
     GAME_STATE_RESOLUTION
 } GameStates;
+// Screen-space light for the night lightmap; `color` fades to nothing at
+// `radius`.
 typedef struct {
-    Rectangle rect;
+    Vector2 center;
+    float radius;
+    Color color;
+} Light;
+typedef struct {
+    Light lights[MAX_LIGHTS];
+    int count;
+    unsigned char darkness;
+    int hidden; // sprites skipped because no light reaches them
+} LightList;
+// Retained menu layout: rects, text positions and text widths are worked
+// out when a screen is laid out (startup and RescaleGame), not per frame
+#define MAX_UI_NODES 8
+typedef struct {
+    int id; // reported when hovered or clicked; -1 for labels
     const char* text;
-    int textWidth;
-} MenuButton;
-typedef struct {
-    MenuButton playButton;
-    MenuButton storyButton;
-    MenuButton quitButton;
-    MenuButton resolutionButton;
-    bool playHovered;
-    bool storyHovered;
-    bool quitHovered;
-    bool resolutionHovered;
-} MenuState;
+    Rectangle rect; // empty for labels
+    Vector2 textPos;
+    int fontSize;
+    Color textColor;
+} UiNode;
+typedef struct {
+    UiNode nodes[MAX_UI_NODES];
+    int count;
+    bool outlined; // buttons get a border
+    int hovered;   // id of the button under the mouse, or -1
+} UiScreen;
+typedef enum {
+    MENU_PLAY,
+    MENU_STORY,
+    MENU_RACE,
+    MENU_RESOLUTION,
+    MENU_QUIT
+} MenuAction;
+typedef enum {
+    PAUSE_CONTINUE,
+    PAUSE_MAIN_MENU
+} PauseAction;
+#define RESOLUTION_BACK NUM_RESOLUTIONS // resolution buttons use their index
 typedef struct {
-    Rectangle rect;
     const char* text;
-    int textWidth;
     int width;
     int height;
-} ResolutionButton;
+} ResolutionOption;
 typedef enum {
     OBSTACLE_CACTUS_1,
     OBSTACLE_CACTUS_2,
@@ -80,6 +158,107 @@ typedef enum {
     OBSTACLE_CACTUS_6,
     OBSTACLE_BIRD
 } ObstacleType;
+typedef enum {
+    SPRITE_RUN_1,
+    SPRITE_RUN_2,
+    SPRITE_CROUCH_1,
+    SPRITE_CROUCH_2,
+    SPRITE_CACTUS_1,
+    SPRITE_CACTUS_2,
+    SPRITE_CACTUS_3,
+    SPRITE_CACTUS_4,
+    SPRITE_CACTUS_5,
+    SPRITE_CACTUS_6,
+    SPRITE_BIRD_1,
+    SPRITE_BIRD_2,
+    SPRITE_METEOR_FALL_1,
+    SPRITE_METEOR_FALL_2,
+    SPRITE_METEOR_IMPACT_1,
+    SPRITE_METEOR_IMPACT_2,
+    SPRITE_METEOR_IMPACT_3,
+    SPRITE_COUNT
+} SpriteId;
+// One frame of resources/atlas.png, generated by tools/atlas_packer.c into
+// src/atlas.h. Gameplay works in the untrimmed `frame` size; `source` holds
+// only the visible pixels, drawn at `offset` within the frame, and `hitbox`
+// is the frame's opaque bounds.
+typedef struct {
+    Vector2 frame;
+    Vector2 offset;
+    Rectangle source;
+    Rectangle hitbox;
+} AtlasSprite;
+typedef enum {
+    ANIM_CLIP_RUN,
+    ANIM_CLIP_CROUCH,
+    ANIM_CLIP_CACTUS_1,
+    ANIM_CLIP_CACTUS_2,
+    ANIM_CLIP_CACTUS_3,
+    ANIM_CLIP_CACTUS_4,
+    ANIM_CLIP_CACTUS_5,
+    ANIM_CLIP_CACTUS_6,
+    ANIM_CLIP_BIRD,
+    ANIM_CLIP_METEOR_FALL,
+    ANIM_CLIP_METEOR_IMPACT,
+    ANIM_CLIP_COUNT
+} AnimClipId;
+typedef enum {
+    ANIM_LOOP,
+    ANIM_ONCE // holds the last frame
+} AnimLoopMode;
+typedef struct {
+    SpriteId sprite;
+    float duration; // 0 for a frame that never steps
+} AnimFrame;
+typedef struct {
+    AnimFrame frames[ANIM_MAX_CLIP_FRAMES];
+    int frameCount;
+    AnimLoopMode mode;
+} AnimClip;
+// One per animated entity, kept together in GameState.animators so the
+// whole set steps in one pass per tick. `stepped` is set by the pass that
+// changed the frame.
+typedef struct {
+    uint8_t clip;
+    uint8_t frame;
+    bool active;
+    bool stepped;
+    float time;
+} Animator;
+typedef enum {
+    EASE_LINEAR,
+    EASE_IN_QUAD,
+    EASE_OUT_QUAD,
+    EASE_IN_OUT_QUAD,
+    EASE_OUT_CUBIC
+} EaseType;
+typedef struct GameState GameState;
+typedef void (*TweenCallback)(GameState* game, int tag);
+// Eases one float field of GameState from `from` to `to`. The field is named
+// by its byte offset (TWEEN_TARGET) so the timeline stays valid when the
+// state is copied. Nothing is written until `delay` has passed.
+typedef struct {
+    uint32_t target;
+    float from;
+    float to;
+    float delay;
+    float duration;
+    float elapsed;
+    EaseType ease;
+    TweenCallback onComplete;
+    int tag;
+} Tween;
+typedef struct {
+    Tween tweens[MAX_TWEENS];
+    int count;
+} Timeline;
+typedef struct {
+    int width;
+    int height;
+    int wordsPerRow;
+    Rectangle bounds;
+    uint64_t* bits;
+} CollisionMask;
 typedef struct {
     float width;
     float height;
@@ -99,20 +278,27 @@ typedef struct {
     Rectangle collisionRect;
     bool active;
     ObstacleType type;
-    int currentFrame;
-    float frameTime;
     bool hasPassedPlayer;
+    float nearestGap;
 } Obstacle;
+typedef struct {
+    uint32_t tick;
+    ObstacleType type;
+} ScheduledSpawn;
+// SCHEDULE_CHUNK_TICKS worth of spawns, a pure function of (seed, index)
+typedef struct {
+    uint64_t seed;
+    uint32_t index;
+    int count;
+    ScheduledSpawn spawns[SCHEDULE_MAX_CHUNK_SPAWNS];
+} ObstacleChunk;
+typedef struct ObstacleScheduler ObstacleScheduler;
 typedef struct {
     Obstacle obstacles[7];
-    float spawnTimer;
-    float nextSpawnTime;
+    ObstacleChunk chunk;
+    int nextSpawn;
 } ObstaclePool;
 typedef struct {
-    Rectangle continueButton;
-    Rectangle mainMenuButton;
-    bool continueHovered;
-    bool mainMenuHovered;
     bool isPaused;
 } PauseMenuState;
 typedef enum {
@@ -125,12 +311,52 @@ typedef struct {
     Rectangle rect;
     Rectangle collisionRect;
     MeteorState state;
-    int currentFrame;
-    float frameTime;
     float impactTime;
+    float alpha;
     bool active;
     bool hasDealtDamage;
 } Meteor;
+typedef enum {
+    BOSS_PATTERN_VOLLEY,
+    BOSS_PATTERN_SPIRAL,
+    BOSS_PATTERN_RAIN
+} BossPatternType;
+// One step of the boss script: `count` projectiles (spiral arms) every
+// `interval` seconds. `spread` is the spacing inside a volley or the width
+// of the rain band; `spin` is how far a spiral turns (degrees) or a rain
+// band sweeps (px) per second.
+typedef struct {
+    BossPatternType type;
+    float duration;
+    float interval;
+    int count;
+    float speed;
+    float spread;
+    float spin;
+} BossPattern;
+typedef struct {
+    int phase;
+    int step;
+    float stepTimer;
+    float fireTimer;
+    float angle;
+    float sweepX;
+    float sweepDirection;
+} BossState;
+// Projectiles are kept packed (structure of arrays) and bucketed into a
+// uniform grid every tick: cellStart[c]..cellStart[c + 1] indexes
+// cellEntries for the projectiles whose centre is in cell c.
+typedef struct {
+    float x[MAX_PROJECTILES];
+    float y[MAX_PROJECTILES];
+    float vx[MAX_PROJECTILES];
+    float vy[MAX_PROJECTILES];
+    bool alive[MAX_PROJECTILES];
+    int count;
+    uint16_t cellStart[GRID_CELLS + 1];
+    uint16_t cellEntries[MAX_PROJECTILES];
+    int candidatesTested;
+} ProjectilePool;
 typedef struct {
     Vector2 position;
     float speed;
@@ -138,9 +364,122 @@ typedef struct {
     float alpha;
     bool active;
 } Cloud;
+typedef enum {
+    INPUT_NONE = 0,
+    INPUT_JUMP = 1 << 0,
+    INPUT_CROUCH = 1 << 1
+} PlayerInputFlags;
+typedef uint8_t PlayerInput;
+// Every local player's held input, PLAYER_INPUT_BITS per player. Player 0
+// sits in the low bits, so a single PlayerInput is also a valid value.
+typedef uint16_t PlayerInputs;
+#define PLAYER_INPUT_BITS 2
+#define PLAYER_INPUT_MASK ((1 << PLAYER_INPUT_BITS) - 1)
+// A change in held keys/buttons, stamped with InputClock() when sampled
+typedef struct {
+    double time;
+    PlayerInputs held;
+} InputEvent;
+typedef struct InputQueue InputQueue;
+// Run analytics; `tick` is the run's sim tick when it happened
+typedef enum {
+    TELEMETRY_RUN_START,    // detail: story mode, value: run seed
+    TELEMETRY_RUN_END,      // detail: won, value: score
+    TELEMETRY_SPAWN,        // detail: obstacle type
+    TELEMETRY_JUMP,         // value: gap to the nearest obstacle ahead, -1 if none
+    TELEMETRY_DEATH,        // detail: DeathCause, value: obstacle type or -1
+    TELEMETRY_NIGHT,        // detail: 1 at nightfall, 0 at daybreak
+    TELEMETRY_BOSS_DAMAGE,  // value: boss HP left
+    TELEMETRY_PLAYER_HIT,   // value: player HP left
+    TELEMETRY_EVENT_COUNT
+} TelemetryEventType;
+typedef enum {
+    DEATH_OBSTACLE,
+    DEATH_METEOR,
+    DEATH_PROJECTILE,
+    DEATH_CAUSE_COUNT
+} DeathCause;
+typedef struct {
+    uint32_t tick;
+    uint8_t type;
+    uint8_t detail;
+    int64_t value;
+} TelemetryEvent;
+typedef struct TelemetryLog TelemetryLog;
+typedef struct NetplaySession NetplaySession;
+// A finished run as sent to the leaderboard
+typedef struct {
+    uint64_t seed;
+    uint64_t replayHash;
+    int score;
+    uint32_t ticks;
+    bool storyMode;
+    bool won;
+} ScoreRecord;
+typedef struct {
+    uint64_t seed;
+    bool storyMode;
+    PlayerInput* inputs;
+    int count;
+    int capacity;
+    bool saved;
+} ReplayRecorder;
+// Things the sim wants shown but doesn't depend on; the render thread
+// turns them into particles.
+typedef enum {
+    EFFECT_JUMP,
+    EFFECT_LANDING,
+    EFFECT_METEOR_IMPACT,
+    EFFECT_NEAR_MISS,
+    EFFECT_PROJECTILE_SPLASH,
+    EFFECT_PROJECTILE_HIT,
+    EFFECT_TYPE_COUNT
+} EffectType;
+typedef struct {
+    EffectType type;
+    Vector2 position;
+    float size;
+} EffectEvent;
+typedef enum {
+    PARTICLE_TEXTURE_DUST,
+    PARTICLE_TEXTURE_SPARK,
+    PARTICLE_TEXTURE_COUNT
+} ParticleTexture;
+// Structure of arrays so integration streams through each field; all
+// particles in a pool share one texture and are drawn in one batch.
+typedef struct {
+    float x[PARTICLE_POOL_CAPACITY];
+    float y[PARTICLE_POOL_CAPACITY];
+    float vx[PARTICLE_POOL_CAPACITY];
+    float vy[PARTICLE_POOL_CAPACITY];
+    float life[PARTICLE_POOL_CAPACITY];
+    float fade[PARTICLE_POOL_CAPACITY];
+    float size[PARTICLE_POOL_CAPACITY];
+    Color color[PARTICLE_POOL_CAPACITY];
+    int count;
+    float gravity;
+    float drag;
+    Texture2D texture;
+} ParticlePool;
+typedef struct {
+    int live;
+    int spawned;
+    int dropped;
+    float updateMs;
+    float drawMs;
+} ParticleStats;
+typedef struct {
+    ParticlePool pools[PARTICLE_TEXTURE_COUNT];
+    uint64_t rngState;
+    float emitScale;
+    int pendingSpawned;
+    int pendingDropped;
+    ParticleStats stats;
+} ParticleSystem;
+// One dino. A normal run has one; a race puts up to MAX_PLAYERS on the same
+// obstacle field, all at the same x.
 typedef struct {
     Rectangle rect;
-    Vector2 screenPosition;
     Vector2 basePosition;
     Vector2 baseSize;
     float baseJumpVelocity;
@@ -148,11 +487,49 @@ typedef struct {
     bool isCrouching;
     bool isJumpCharging;
     float jumpChargeTime;
+    PlayerInput prevInput;
+    bool alive;
+    int finalScore; // the score when this dino was knocked out
+} Player;
+// Everything StepGame reads or writes, saved before every versus tick so a
+// late remote input can rewind and re-run the ticks it changed. The
+// projectile pool is packed, so only its first `count` entries are copied.
+typedef struct {
+    Player players[MAX_PLAYERS];
+    int playerCount;
+    bool isStoryMode;
+    Animator animators[MAX_ANIMATORS];
+    Timeline timeline;
+    int score;
+    float scoreTimer;
+    ObstaclePool obstacles;
+    bool gameOver;
+    bool gameWon;
+    bool nightModeActive;
+    bool isNight;
+    float dayCycleTimer;
+    float nightAlpha;
+    bool bossActive;
+    int bossHP;
+    int hp;
+    float screenShakeIntensity;
+    Meteor meteors[MAX_METEORS];
+    float meteorSpawnTimer;
+    float nextMeteorSpawnTime;
+    BossState boss;
+    ProjectilePool projectiles;
+    uint64_t runSeed;
+    uint64_t rngState;
+    uint32_t tick;
+} SimSnapshot;
+struct GameState {
+    Player players[MAX_PLAYERS];
+    int playerCount;
     Texture2D spriteSheet;
     Rectangle runFrames[2];
     Rectangle crouchFrames[2];
-    int currentFrame;
-    float frameTime;
+    Animator animators[MAX_ANIMATORS];
+    Timeline timeline;
     float runFrameHeight;
     float crouchFrameHeight;
     int score;
@@ -161,20 +538,20 @@ typedef struct {
     ObstaclePool obstacles;
     bool gameOver;
     bool nightModeActive;
-    float nightCycleTimer;
     bool isNight;
     float dayCycleTimer;
-    RenderTexture2D lightMask;
     float nightAlpha;
     PauseMenuState pauseMenu;
     bool isStoryMode;
     bool bossActive;
     int bossHP;
-    float screenShakeTimer;
     float screenShakeIntensity;
     Meteor meteors[15];
     float meteorSpawnTimer;
     float nextMeteorSpawnTime;
+    BossState boss;
+    ProjectilePool projectiles;
+    Texture2D projectileTexture;
     int hp;
     bool gameWon;
     Sound jumpSound;
@@ -187,14 +564,104 @@ typedef struct {
     Cloud clouds[MAX_CLOUDS];
     float cloudSpawnTimer;
     float nextCloudSpawnTime;
-} GameState;
+
+    uint64_t runSeed;
+    uint64_t rngState;
+    uint32_t tick;
+    ReplayRecorder replay;
+    bool autopilotEnabled;
+    ObstacleScheduler* scheduler;
+    EffectEvent effects[MAX_EFFECT_EVENTS];
+    int effectCount;
+    ParticleSystem* particles;
+    bool showProfiler;
+    InputQueue* input;
+    double inputTime;
+    TelemetryLog* telemetry;
+    NetplaySession* netplay;
+    bool resimulating; // rollback re-runs: no sounds, no telemetry
+};
 typedef struct {
     int width;
     int height;
     bool isFullscreen;
     float scaleFactor;
-    ResolutionButton resolutions[4];
-    MenuState menu;
+    ResolutionOption resolutions[NUM_RESOLUTIONS];
+    UiScreen mainMenu;
+    UiScreen resolutionMenu;
+    UiScreen pauseMenu;
     GameStates gameState;
+    RenderTexture2D lightMask; // sized for the window by RescaleGame()
 } WindowState;
+// Render command list: DrawGame() queues per layer, SubmitRenderList() draws
+#define MAX_RENDER_COMMANDS 256
+#define RENDER_TEXT_LENGTH 64
+typedef enum {
+    RENDER_LAYER_SKY,
+    RENDER_LAYER_GROUND,
+    RENDER_LAYER_WORLD,
+    RENDER_LAYER_EFFECTS,
+    RENDER_LAYER_LIGHTING,
+    RENDER_LAYER_HUD,
+    RENDER_LAYER_OVERLAY,
+    RENDER_LAYER_SCREEN,
+    RENDER_LAYER_COUNT
+} RenderLayer;
+typedef enum {
+    RENDER_COMMAND_CLEAR,
+    RENDER_COMMAND_SPRITE,
+    RENDER_COMMAND_RECT,
+    RENDER_COMMAND_TEXT,
+    RENDER_COMMAND_CUSTOM
+} RenderCommandType;
+typedef void (*RenderCallback)(const WindowState* window, const GameState* game, Vector2 shakeOffset);
+typedef struct {
+    RenderCommandType type;
+    RenderLayer layer;
+    Rectangle dest;
+    Rectangle source;
+    Texture2D texture;
+    Color color;
+    int fontSize;
+    const char* text; // in the frame arena
+    RenderCallback callback;
+} RenderCommand;
+typedef struct {
+    int submitted[RENDER_LAYER_COUNT];
+    int culled[RENDER_LAYER_COUNT];
+    int occluded[RENDER_LAYER_COUNT];
+} RenderStats;
+typedef struct {
+    RenderCommand commands[MAX_RENDER_COMMANDS];
+    int count;
+    Rectangle screen;
+    Vector2 shakeOffset;
+    RenderStats building;
+    RenderStats stats;
+} RenderList;
+// Per-frame memory: transient data is bump-allocated from the frame arena,
+// which is reset at the top of every frame, and raylib's heap allocations
+// are counted so a steady-state frame can be checked to make none
+#define FRAME_ARENA_BYTES (64 * 1024)
+typedef struct {
+    long frames;
+    long allocatingFrames; // frames that hit the heap without expecting to
+    int lastAllocations;   // heap allocations made during the last frame
+    size_t lastBytes;
+    size_t arenaUsed;      // frame arena bytes the last frame used
+    size_t arenaPeak;
+} MemoryStats;
+// Where the draw calls land: the GPU through raylib, or a CPU framebuffer
+// that needs no display (headless benchmarks, golden images)
+typedef enum {
+    RENDER_BACKEND_GPU,
+    RENDER_BACKEND_SOFTWARE
+} RenderBackend;
+#define MAX_SOFT_TEXTURES 16
+typedef struct {
+    Color* pixels;
+    int width;
+    int height;
+    int* spans; // textures: per row, first and one past last visible column
+} SoftCanvas;
 #endif
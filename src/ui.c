@@ -0,0 +1,69 @@
+#include "ui.h"
+#include "render.h"
+#include <stddef.h>
+
+void ClearUiScreen(UiScreen* screen, bool outlined) {
+    screen->count = 0;
+    screen->outlined = outlined;
+    screen->hovered = -1;
+}
+
+// NULL when the screen is full; the node is then left out
+static UiNode* AddUiNode(UiScreen* screen) {
+    if (screen->count >= MAX_UI_NODES) return NULL;
+    return &screen->nodes[screen->count++];
+}
+
+bool AddUiLabel(UiScreen* screen, const char* text, int centerX, int posY, int fontSize, Color color) {
+    UiNode* node = AddUiNode(screen);
+    if (!node) return false;
+    *node = (UiNode){
+        .id = -1,
+        .text = text,
+        .textPos = { centerX - MeasureRenderText(text, fontSize) / 2, posY },
+        .fontSize = fontSize,
+        .textColor = color
+    };
+    return true;
+}
+
+// The label is centred horizontally and sits `textOffsetY` below the top
+bool AddUiButton(UiScreen* screen, int id, const char* text, Rectangle rect, int fontSize, float textOffsetY,
+                 Color textColor) {
+    UiNode* node = AddUiNode(screen);
+    if (!node) return false;
+    *node = (UiNode){
+        .id = id,
+        .text = text,
+        .rect = rect,
+        .textPos = { rect.x + (rect.width - MeasureRenderText(text, fontSize)) / 2, rect.y + textOffsetY },
+        .fontSize = fontSize,
+        .textColor = textColor
+    };
+    return true;
+}
+
+// Id of the button containing `point`, or -1
+int UiNodeAt(const UiScreen* screen, Vector2 point) {
+    for (int i = 0; i < screen->count; i++) {
+        const UiNode* node = &screen->nodes[i];
+        if (node->id >= 0 && CheckCollisionPointRec(point, node->rect)) return node->id;
+    }
+    return -1;
+}
+
+int UpdateUiHover(UiScreen* screen, Vector2 mouse) {
+    screen->hovered = UiNodeAt(screen, mouse);
+    return screen->hovered;
+}
+
+void DrawUiScreen(const UiScreen* screen) {
+    for (int i = 0; i < screen->count; i++) {
+        const UiNode* node = &screen->nodes[i];
+        if (node->id >= 0) {
+            RenderRect(node->rect, node->id == screen->hovered ? SKYBLUE : LIGHTGRAY);
+            if (screen->outlined) RenderRectLines(node->rect, 2, DARKGRAY);
+        }
+        RenderText(node->text, node->textPos.x, node->textPos.y, node->fontSize, node->textColor);
+    }
+}
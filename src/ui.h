@@ -0,0 +1,15 @@
+#ifndef UI_H
+#define UI_H
+#include "raylib.h"
+#include "types.h"
+#include <stdbool.h>
+
+void ClearUiScreen(UiScreen* screen, bool outlined);
+bool AddUiLabel(UiScreen* screen, const char* text, int centerX, int posY, int fontSize, Color color);
+bool AddUiButton(UiScreen* screen, int id, const char* text, Rectangle rect, int fontSize, float textOffsetY,
+                 Color textColor);
+int UiNodeAt(const UiScreen* screen, Vector2 point);
+int UpdateUiHover(UiScreen* screen, Vector2 mouse);
+void DrawUiScreen(const UiScreen* screen);
+
+#endif
@@ -8,7 +8,7 @@
 #include "window.h"
 #include "menu.h"
 #include "draw.h"
-#include "sound.h"
+#include "ui.h"
 
 void SaveHighScore(int highScore) {
     FILE* file = fopen("highscore.bin", "wb");
@@ -43,122 +43,122 @@ bool IsButtonHoveredScaled(const Rectangle* button, float scale) {
     return CheckCollisionPointRec(mouse, scaled);
 }
 
-void HandleInput(WindowState* window, GameState* game) {
+static PlayerInput ReadGamepadInput(int gamepad) {
+    PlayerInput input = INPUT_NONE;
+    if (!IsGamepadAvailable(gamepad)) return input;
+    if (IsGamepadButtonDown(gamepad, GAMEPAD_BUTTON_RIGHT_FACE_DOWN) ||
+        IsGamepadButtonDown(gamepad, GAMEPAD_BUTTON_LEFT_FACE_UP)) input |= INPUT_JUMP;
+    if (IsGamepadButtonDown(gamepad, GAMEPAD_BUTTON_LEFT_FACE_DOWN) ||
+        GetGamepadAxisMovement(gamepad, GAMEPAD_AXIS_LEFT_Y) > GAMEPAD_AXIS_THRESHOLD) input |= INPUT_CROUCH;
+    return input;
+}
+
+PlayerInput ReadPlayerInput(void) {
+    PlayerInput input = INPUT_NONE;
+    if (IsKeyDown(KEY_W)) input |= INPUT_JUMP;
+    if (IsKeyDown(KEY_S)) input |= INPUT_CROUCH;
+    return input | ReadGamepadInput(0);
+}
+
+// A race seats the two keyboard players first (W/S, then the arrow keys)
+// and hands every connected gamepad the next dino.
+PlayerInputs ReadPlayerInputs(int playerCount) {
+    if (playerCount <= 1) return ReadPlayerInput();
+    PlayerInputs inputs = INPUT_NONE;
+    for (int player = 0; player < playerCount; player++) {
+        PlayerInput input = INPUT_NONE;
+        if (player < 2) {
+            if (IsKeyDown(player == 0 ? KEY_W : KEY_UP)) input |= INPUT_JUMP;
+            if (IsKeyDown(player == 0 ? KEY_S : KEY_DOWN)) input |= INPUT_CROUCH;
+        } else {
+            input = ReadGamepadInput(player - 2);
+        }
+        inputs |= (PlayerInputs)(input << (player * PLAYER_INPUT_BITS));
+    }
+    return inputs;
+}
+
+int CountRacePlayers(void) {
+    int count = 2;
+    for (int gamepad = 0; gamepad < MAX_PLAYERS - 2; gamepad++) {
+        if (IsGamepadAvailable(gamepad)) count++;
+    }
+    return count;
+}
+
+// `game` is the newest published frame; anything that changes the game
+// itself is posted to the sim thread
+void HandleInput(WindowState* window, const GameState* game, SimThread* sim) {
     if (game->pauseMenu.isPaused) {
-        HandlePauseMenuInput(window, game);
+        HandlePauseMenuInput(window, sim);
         return;
     }
 
     Vector2 mousePos = GetMousePosition();
     if (window->gameState == GAME_STATE_MENU) {
-        window->menu.playHovered = IsButtonHovered(&window->menu.playButton.rect);
-        window->menu.storyHovered = IsButtonHovered(&window->menu.storyButton.rect);
-        window->menu.quitHovered = IsButtonHovered(&window->menu.quitButton.rect);
-        window->menu.resolutionHovered = IsButtonHovered(&window->menu.resolutionButton.rect);
+        int action = UpdateUiHover(&window->mainMenu, mousePos);
         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            if (window->menu.playHovered) {
+            if (action == MENU_PLAY) {
+                window->gameState = GAME_STATE_PLAYING;
+                PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_START, .storyMode = false, .playerCount = 1 });
+            } else if (action == MENU_STORY) {
                 window->gameState = GAME_STATE_PLAYING;
-                game->isStoryMode = false;
-                ResetGame(game);
-            } else if (window->menu.storyHovered) {
+                PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_START, .storyMode = true, .playerCount = 1 });
+            } else if (action == MENU_RACE) {
+                // Endless only: the boss fight is single-player
                 window->gameState = GAME_STATE_PLAYING;
-                game->isStoryMode = true;
-                ResetGame(game);
-            } else if (window->menu.quitHovered) {
+                PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_START, .storyMode = false, .playerCount = CountRacePlayers() });
+            } else if (action == MENU_QUIT) {
                 CloseWindow();
                 exit(0);
-            } else if (window->menu.resolutionHovered) {
+            } else if (action == MENU_RESOLUTION) {
                 window->gameState = GAME_STATE_RESOLUTION;
             }
         }
         return;
     }
     if (window->gameState == GAME_STATE_RESOLUTION) {
+        int choice = UpdateUiHover(&window->resolutionMenu, mousePos);
         if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            for (int i = 0; i < NUM_RESOLUTIONS; i++) {
-                if (IsButtonHovered(&window->resolutions[i].rect)) {
-                    if (i == NUM_RESOLUTIONS - 1) {
-                        ChangeResolution(window, game, 0, 0, true);
-                    } else {
-                        ChangeResolution(window, game, window->resolutions[i].width, window->resolutions[i].height, false);
-                    }
-                    break;
-                }
-            }
-            Rectangle backButton = { window->width / 2 - 100, window->height - 100, 200, 50 };
-            if (IsButtonHovered(&backButton)) {
+            if (choice == RESOLUTION_BACK) {
                 window->gameState = GAME_STATE_MENU;
+            } else if (choice == NUM_RESOLUTIONS - 1) {
+                ChangeResolution(window, 0, 0, true);
+            } else if (choice >= 0) {
+                ChangeResolution(window, window->resolutions[choice].width, window->resolutions[choice].height, false);
             }
         }
         return;
     }
-    static bool wasWPressed = false;
-    bool isWPressed = IsKeyDown(KEY_W);
-    bool wasCrouching = game->isCrouching;
     if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-        Vector2 mousePos = GetMousePosition();
-        for (int i = 0; i < NUM_RESOLUTIONS; i++) {
-            if (CheckCollisionPointRec(mousePos, window->resolutions[i].rect)) {
-                if (i == NUM_RESOLUTIONS - 1) {
-                    HandleFullscreenToggle(window);
-                } else {
-                    if (window->isFullscreen) HandleFullscreenToggle(window);
-                    window->width = window->resolutions[i].width;
-                    window->height = window->resolutions[i].height;
-                    SetWindowSize(window->width, window->height);
-                }
-                RescaleGame(game, window);
-                break;
+        int choice = UiNodeAt(&window->resolutionMenu, mousePos);
+        if (choice >= 0 && choice < NUM_RESOLUTIONS) {
+            if (choice == NUM_RESOLUTIONS - 1) {
+                HandleFullscreenToggle(window);
+            } else {
+                if (window->isFullscreen) HandleFullscreenToggle(window);
+                window->width = window->resolutions[choice].width;
+                window->height = window->resolutions[choice].height;
+                SetWindowSize(window->width, window->height);
             }
+            RescaleGame(window);
         }
     }
     if (IsKeyPressed(KEY_F11)) HandleFullscreenToggle(window);
+    if (IsKeyPressed(KEY_P)) PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_TOGGLE_AUTOPILOT });
+    if (IsKeyPressed(KEY_F3)) PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_TOGGLE_PROFILER });
     if (game->gameWon && IsKeyPressed(KEY_SPACE)) {
-        StopAllSounds(game);
         window->gameState = GAME_STATE_MENU;
-        ResetGame(game);
+        PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_MAIN_MENU });
         return;
     }
-    if (game->gameOver && !game->gameWon && IsKeyPressed(KEY_SPACE)) {
-        StopAllSounds(game);
-        ResetGame(game);
+    // A versus rematch is agreed in the sim itself (both players jump)
+    if (game->gameOver && !game->gameWon && !IsSimVersus(sim) && IsKeyPressed(KEY_SPACE)) {
         window->gameState = GAME_STATE_PLAYING;
+        PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_RESTART });
         return;
     }
-    game->isCrouching = IsKeyDown(KEY_S);
-    if (!game->isJumping && (game->isCrouching != wasCrouching)) {
-        float newHeight = game->isCrouching ? game->crouchFrameHeight : game->runFrameHeight;
-        game->basePosition.y = BASE_RESOLUTION.y - GROUND_HEIGHT - newHeight;
-        game->currentFrame = 0;
-        game->frameTime = 0;
-        const Rectangle* newFrame = game->isCrouching ? &game->crouchFrames[0] : &game->runFrames[0];
-        game->baseSize.x = newFrame->width;
-        game->baseSize.y = game->isCrouching ? game->crouchFrameHeight : game->runFrameHeight;
-    }
-    if (!game->isJumping && !game->isCrouching) {
-        if (!wasWPressed && isWPressed) {
-            game->isJumping = true;
-            game->isJumpCharging = true;
-            game->jumpChargeTime = 0.0f;
-            game->baseJumpVelocity = JUMP_FORCE;
-            
-            PlayJumpSound(game);
-        }
-    }
-    if (wasWPressed && !isWPressed) {
-        game->isJumpCharging = false;
-    }
-    wasWPressed = isWPressed;
-    if (game->isCrouching && game->isJumping) {
-        game->baseJumpVelocity = FAST_FALL_VELOCITY;
-    }
-    if (window->gameState == GAME_STATE_PLAYING) {
-        if (IsKeyPressed(KEY_O)) {
-            game->pauseMenu.isPaused = !game->pauseMenu.isPaused;
-        }
-        if (game->pauseMenu.isPaused) {
-            HandlePauseMenuInput(window, game);
-            return;
-        }
+    if (window->gameState == GAME_STATE_PLAYING && IsKeyPressed(KEY_O)) {
+        PostSimCommand(sim, (SimCommand){ .type = SIM_COMMAND_TOGGLE_PAUSE });
     }
 }
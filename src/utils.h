@@ -3,11 +3,15 @@
 #include <stdbool.h>
 #include "raylib.h"
 #include "types.h"
+#include "simthread.h"
 
 int LoadHighScore();
 void SaveHighScore(int highScore);
 bool IsButtonHovered(const Rectangle* button);
 bool IsButtonHoveredScaled(const Rectangle* button, float scale);
-void HandleInput(WindowState* window, GameState* game);
+PlayerInput ReadPlayerInput(void);
+PlayerInputs ReadPlayerInputs(int playerCount);
+int CountRacePlayers(void);
+void HandleInput(WindowState* window, const GameState* game, SimThread* sim);
 
 #endif
@@ -0,0 +1,209 @@
+#include "video.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+// Offline video export. The target picks the output: a path ending in
+// ".y4m" is written as YUV4MPEG2, "|command" pipes the same stream into an
+// encoder (e.g. "|ffmpeg -y -i - clip.mp4"), and anything else is a
+// directory that gets frame_000000.png onwards.
+
+static size_t FrameBytes(const VideoEncoder* encoder) {
+    return (size_t)encoder->width * encoder->height * sizeof(Color);
+}
+
+static size_t PlaneBytes(const VideoEncoder* encoder) {
+    int chromaWidth = (encoder->width + 1) / 2;
+    int chromaHeight = (encoder->height + 1) / 2;
+    return (size_t)encoder->width * encoder->height + 2 * (size_t)chromaWidth * chromaHeight;
+}
+
+// Full-range BT.601 (C420jpeg), chroma averaged over each 2x2 block
+static void ConvertToYuv(const VideoEncoder* encoder, const Color* pixels, unsigned char* planes) {
+    int width = encoder->width, height = encoder->height;
+    int chromaWidth = (width + 1) / 2, chromaHeight = (height + 1) / 2;
+    unsigned char* luma = planes;
+    unsigned char* cb = luma + (size_t)width * height;
+    unsigned char* cr = cb + (size_t)chromaWidth * chromaHeight;
+    for (int i = 0; i < width * height; i++) {
+        Color c = pixels[i];
+        luma[i] = (unsigned char)((77 * c.r + 150 * c.g + 29 * c.b + 128) >> 8);
+    }
+    for (int cy = 0; cy < chromaHeight; cy++) {
+        for (int cx = 0; cx < chromaWidth; cx++) {
+            int r = 0, g = 0, b = 0, n = 0;
+            for (int y = 2 * cy; y < 2 * cy + 2 && y < height; y++) {
+                for (int x = 2 * cx; x < 2 * cx + 2 && x < width; x++) {
+                    Color c = pixels[y * width + x];
+                    r += c.r;
+                    g += c.g;
+                    b += c.b;
+                    n++;
+                }
+            }
+            if (n == 4) {
+                r >>= 2;
+                g >>= 2;
+                b >>= 2;
+            } else {
+                r /= n;
+                g /= n;
+                b /= n;
+            }
+            int u = 128 + ((-43 * r - 85 * g + 128 * b + 128) >> 8);
+            int v = 128 + ((128 * r - 107 * g - 21 * b + 128) >> 8);
+            cb[cy * chromaWidth + cx] = (unsigned char)(u < 0 ? 0 : (u > 255 ? 255 : u));
+            cr[cy * chromaWidth + cx] = (unsigned char)(v < 0 ? 0 : (v > 255 ? 255 : v));
+        }
+    }
+}
+
+static bool EncodeFrame(VideoEncoder* encoder, const Color* pixels, int index) {
+    if (encoder->output == VIDEO_OUTPUT_PNG) {
+        char path[600];
+        snprintf(path, sizeof(path), "%s/frame_%06d.png", encoder->target, index);
+        Image image = { (void*)pixels, encoder->width, encoder->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        return ExportImage(image, path);
+    }
+    ConvertToYuv(encoder, pixels, encoder->planes);
+    return fputs("FRAME\n", encoder->file) >= 0 &&
+           fwrite(encoder->planes, 1, PlaneBytes(encoder), encoder->file) == PlaneBytes(encoder);
+}
+
+static void* VideoWorker(void* arg) {
+    VideoEncoder* encoder = arg;
+    for (int index = 0;; index++) {
+        pthread_mutex_lock(&encoder->lock);
+        while (encoder->count == 0 && !encoder->stopping) {
+            pthread_cond_wait(&encoder->queued, &encoder->lock);
+        }
+        if (encoder->count == 0) {
+            pthread_mutex_unlock(&encoder->lock);
+            break;
+        }
+        // The slot stays counted until it is encoded, so it isn't reused early
+        const Color* pixels = encoder->slots[encoder->head];
+        pthread_mutex_unlock(&encoder->lock);
+
+        if (!atomic_load(&encoder->failed)) {
+            if (EncodeFrame(encoder, pixels, index)) atomic_fetch_add(&encoder->written, 1);
+            else atomic_store(&encoder->failed, true);
+        }
+
+        pthread_mutex_lock(&encoder->lock);
+        encoder->head = (encoder->head + 1) % VIDEO_QUEUE_FRAMES;
+        encoder->count--;
+        pthread_cond_signal(&encoder->freed);
+        pthread_mutex_unlock(&encoder->lock);
+    }
+    return NULL;
+}
+
+static bool OpenOutput(VideoEncoder* encoder) {
+    if (encoder->output == VIDEO_OUTPUT_PNG) {
+        mkdir(encoder->target, 0755);
+        struct stat info;
+        return stat(encoder->target, &info) == 0 && S_ISDIR(info.st_mode);
+    }
+    encoder->file = encoder->output == VIDEO_OUTPUT_PIPE ? popen(encoder->target, "w") : fopen(encoder->target, "wb");
+    if (!encoder->file) return false;
+    fprintf(encoder->file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", encoder->width, encoder->height, encoder->fps);
+    return true;
+}
+
+static void FreeVideoEncoder(VideoEncoder* encoder) {
+    for (int i = 0; i < VIDEO_QUEUE_FRAMES; i++) free(encoder->slots[i]);
+    free(encoder->planes);
+    free(encoder);
+}
+
+VideoEncoder* StartVideoEncoder(const char* target, int width, int height, int fps) {
+    VideoEncoder* encoder = calloc(1, sizeof(VideoEncoder));
+    if (!encoder) return NULL;
+    size_t length = strlen(target);
+    if (target[0] == '|') {
+        encoder->output = VIDEO_OUTPUT_PIPE;
+        target++;
+    } else if (length > 4 && strcmp(target + length - 4, ".y4m") == 0) {
+        encoder->output = VIDEO_OUTPUT_Y4M;
+    } else {
+        encoder->output = VIDEO_OUTPUT_PNG;
+    }
+    snprintf(encoder->target, sizeof(encoder->target), "%s", target);
+    encoder->width = width;
+    encoder->height = height;
+    encoder->fps = fps;
+    bool ok = true;
+    for (int i = 0; i < VIDEO_QUEUE_FRAMES; i++) {
+        encoder->slots[i] = malloc(FrameBytes(encoder));
+        ok = ok && encoder->slots[i];
+    }
+    if (encoder->output != VIDEO_OUTPUT_PNG) {
+        encoder->planes = malloc(PlaneBytes(encoder));
+        ok = ok && encoder->planes;
+    }
+    if (!ok || !OpenOutput(encoder)) {
+        FreeVideoEncoder(encoder);
+        return NULL;
+    }
+    pthread_mutex_init(&encoder->lock, NULL);
+    pthread_cond_init(&encoder->queued, NULL);
+    pthread_cond_init(&encoder->freed, NULL);
+    if (pthread_create(&encoder->thread, NULL, VideoWorker, encoder) != 0) {
+        pthread_cond_destroy(&encoder->freed);
+        pthread_cond_destroy(&encoder->queued);
+        pthread_mutex_destroy(&encoder->lock);
+        if (encoder->file) {
+            if (encoder->output == VIDEO_OUTPUT_PIPE) pclose(encoder->file);
+            else fclose(encoder->file);
+        }
+        FreeVideoEncoder(encoder);
+        return NULL;
+    }
+    return encoder;
+}
+
+// Copies `pixels` (width x height RGBA) into the queue, waiting while the
+// queue is full. False once the encoder has failed.
+bool SubmitVideoFrame(VideoEncoder* encoder, const Color* pixels) {
+    if (atomic_load(&encoder->failed)) return false;
+    pthread_mutex_lock(&encoder->lock);
+    if (encoder->count == VIDEO_QUEUE_FRAMES) {
+        atomic_fetch_add(&encoder->stalls, 1);
+        while (encoder->count == VIDEO_QUEUE_FRAMES) pthread_cond_wait(&encoder->freed, &encoder->lock);
+    }
+    int slot = (encoder->head + encoder->count) % VIDEO_QUEUE_FRAMES;
+    pthread_mutex_unlock(&encoder->lock);
+
+    // Only this thread writes free slots, so the copy needs no lock
+    memcpy(encoder->slots[slot], pixels, FrameBytes(encoder));
+
+    pthread_mutex_lock(&encoder->lock);
+    encoder->count++;
+    pthread_cond_signal(&encoder->queued);
+    pthread_mutex_unlock(&encoder->lock);
+    return true;
+}
+
+// Drains the queue and closes the output; returns the frames written, or
+// -1 if writing failed along the way
+int StopVideoEncoder(VideoEncoder* encoder) {
+    if (!encoder) return -1;
+    pthread_mutex_lock(&encoder->lock);
+    encoder->stopping = true;
+    pthread_cond_signal(&encoder->queued);
+    pthread_mutex_unlock(&encoder->lock);
+    pthread_join(encoder->thread, NULL);
+    pthread_cond_destroy(&encoder->freed);
+    pthread_cond_destroy(&encoder->queued);
+    pthread_mutex_destroy(&encoder->lock);
+
+    bool failed = atomic_load(&encoder->failed);
+    if (encoder->file) {
+        int status = encoder->output == VIDEO_OUTPUT_PIPE ? pclose(encoder->file) : fclose(encoder->file);
+        failed = failed || status != 0;
+    }
+    int written = atomic_load(&encoder->written);
+    FreeVideoEncoder(encoder);
+    return failed ? -1 : written;
+}
@@ -0,0 +1,45 @@
+#ifndef VIDEO_H
+#define VIDEO_H
+#include "raylib.h"
+#include "types.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#define VIDEO_QUEUE_FRAMES 8
+
+typedef enum {
+    VIDEO_OUTPUT_Y4M,  // one .y4m file
+    VIDEO_OUTPUT_PIPE, // y4m on the stdin of an encoder command
+    VIDEO_OUTPUT_PNG   // numbered PNGs in a directory
+} VideoOutput;
+
+// Frames are copied into a bounded ring and encoded on a worker thread, so
+// the renderer only waits when it is a whole queue ahead of the encoder.
+typedef struct {
+    VideoOutput output;
+    char target[512];
+    int width;
+    int height;
+    int fps;
+    Color* slots[VIDEO_QUEUE_FRAMES];
+    int head;  // oldest queued frame
+    int count; // frames queued, including the one being encoded
+    bool stopping;
+    pthread_mutex_t lock;
+    pthread_cond_t queued;
+    pthread_cond_t freed;
+    pthread_t thread;
+    FILE* file;
+    unsigned char* planes; // worker's YUV 4:2:0 scratch
+    atomic_int written;
+    atomic_int stalls; // submits that had to wait for a free slot
+    atomic_bool failed;
+} VideoEncoder;
+
+VideoEncoder* StartVideoEncoder(const char* target, int width, int height, int fps);
+bool SubmitVideoFrame(VideoEncoder* encoder, const Color* pixels);
+int StopVideoEncoder(VideoEncoder* encoder);
+
+#endif
@@ -6,10 +6,8 @@
 
 void InitWindowState(WindowState* state);
 void UpdateScaleFactor(WindowState* window);
-void RescaleGame(GameState* game, WindowState* window);
-void ChangeResolution(WindowState* window, GameState* game, int width, int height, bool fullscreen);
+void RescaleGame(WindowState* window);
+void ChangeResolution(WindowState* window, int width, int height, bool fullscreen);
 void HandleFullscreenToggle(WindowState* window);
-void UpdateButtonPositions(WindowState* window);
-void UpdateResolutionButtonPositions(WindowState* window);
 
 #endif
@@ -0,0 +1,244 @@
+#include "src/types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Build step: cuts every frame out of the wide sprite strip, trims its
+// transparent border and shelf-packs what is left into the smallest
+// power-of-two atlas. Writes the atlas image and a header holding each
+// frame's packed rect, trim offset and opaque hitbox, so the sheet
+// coordinates below are the only place the strip's layout is known. A
+// second header holds the atlas's collision bits, so the simulation never
+// needs the image at run time.
+//
+//   AtlasPacker [sheet.png] [atlas.png] [header.h] [mask-header.h]
+
+#define ATLAS_PADDING 2
+#define ATLAS_MAX_SIZE 4096
+
+typedef struct {
+    const char* name;
+    Rectangle source; // frame on the sheet; may hang over its edges
+} SheetFrame;
+
+static const SheetFrame SHEET_FRAMES[SPRITE_COUNT] = {
+    [SPRITE_RUN_1]           = { "SPRITE_RUN_1",           { 1514, -4, 88, 94 } },
+    [SPRITE_RUN_2]           = { "SPRITE_RUN_2",           { 1602, -4, 88, 94 } },
+    [SPRITE_CROUCH_1]        = { "SPRITE_CROUCH_1",        { 1866, 34, 118, 60 } },
+    [SPRITE_CROUCH_2]        = { "SPRITE_CROUCH_2",        { 1984, 34, 118, 60 } },
+    [SPRITE_CACTUS_1]        = { "SPRITE_CACTUS_1",        { 446, 0, 34, 68 } },
+    [SPRITE_CACTUS_2]        = { "SPRITE_CACTUS_2",        { 480, 0, 68, 68 } },
+    [SPRITE_CACTUS_3]        = { "SPRITE_CACTUS_3",        { 548, 0, 102, 68 } },
+    [SPRITE_CACTUS_4]        = { "SPRITE_CACTUS_4",        { 650, 0, 50, 94 } },
+    [SPRITE_CACTUS_5]        = { "SPRITE_CACTUS_5",        { 700, 0, 100, 94 } },
+    [SPRITE_CACTUS_6]        = { "SPRITE_CACTUS_6",        { 800, 0, 150, 95 } },
+    [SPRITE_BIRD_1]          = { "SPRITE_BIRD_1",          { 260, 0, 93, 80 } },
+    [SPRITE_BIRD_2]          = { "SPRITE_BIRD_2",          { 353, 0, 93, 80 } },
+    [SPRITE_METEOR_FALL_1]   = { "SPRITE_METEOR_FALL_1",   { 2158, 6, 110, 120 } },
+    [SPRITE_METEOR_FALL_2]   = { "SPRITE_METEOR_FALL_2",   { 2275, 6, 110, 120 } },
+    [SPRITE_METEOR_IMPACT_1] = { "SPRITE_METEOR_IMPACT_1", { 2392, 34, 103, 68 } },
+    [SPRITE_METEOR_IMPACT_2] = { "SPRITE_METEOR_IMPACT_2", { 2497, 34, 129, 74 } },
+    [SPRITE_METEOR_IMPACT_3] = { "SPRITE_METEOR_IMPACT_3", { 2643, 34, 90, 51 } }
+};
+
+typedef struct {
+    int x, y, width, height;
+} Box;
+
+typedef struct {
+    Box trim;   // visible pixels, in frame coordinates
+    Box hitbox; // pixels at or above COLLISION_ALPHA_THRESHOLD
+    int x, y;   // position in the atlas
+} PackedFrame;
+
+typedef struct {
+    const Color* pixels;
+    int width;
+    int height;
+} Sheet;
+
+static Color FramePixel(const Sheet* sheet, Rectangle frame, int x, int y) {
+    int sx = (int)frame.x + x;
+    int sy = (int)frame.y + y;
+    if (sx < 0 || sy < 0 || sx >= sheet->width || sy >= sheet->height) return BLANK;
+    return sheet->pixels[sy * sheet->width + sx];
+}
+
+static Box AlphaBounds(const Sheet* sheet, Rectangle frame, int minAlpha) {
+    int minX = (int)frame.width, minY = (int)frame.height, maxX = -1, maxY = -1;
+    for (int y = 0; y < (int)frame.height; y++) {
+        for (int x = 0; x < (int)frame.width; x++) {
+            if (FramePixel(sheet, frame, x, y).a < minAlpha) continue;
+            if (x < minX) minX = x;
+            if (x > maxX) maxX = x;
+            if (y < minY) minY = y;
+            if (y > maxY) maxY = y;
+        }
+    }
+    if (maxX < 0) return (Box){ 0, 0, 0, 0 };
+    return (Box){ minX, minY, maxX - minX + 1, maxY - minY + 1 };
+}
+
+static int NextPowerOfTwo(int value) {
+    int power = 1;
+    while (power < value) power <<= 1;
+    return power;
+}
+
+// Shelves filled left to right in order of decreasing height. Returns the
+// height used at `width`, or -1 when some frame is wider than the atlas.
+static int PackShelves(PackedFrame* frames, const int* order, int width) {
+    int x = 0, y = 0, shelfHeight = 0;
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        PackedFrame* frame = &frames[order[i]];
+        if (frame->trim.width == 0) continue;
+        if (frame->trim.width > width) return -1;
+        if (x + frame->trim.width > width) {
+            y += shelfHeight + ATLAS_PADDING;
+            x = 0;
+            shelfHeight = 0;
+        }
+        frame->x = x;
+        frame->y = y;
+        x += frame->trim.width + ATLAS_PADDING;
+        if (frame->trim.height > shelfHeight) shelfHeight = frame->trim.height;
+    }
+    return y + shelfHeight;
+}
+
+static bool WriteHeader(const char* path, const char* atlasPath, const char* sheetPath,
+                        const PackedFrame* frames, int width, int height) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    fprintf(file, "// Generated by tools/atlas_packer.c from %s; do not edit.\n", sheetPath);
+    fprintf(file, "#ifndef ATLAS_H\n#define ATLAS_H\n#include \"types.h\"\n\n");
+    fprintf(file, "#define ATLAS_PATH \"%s\"\n", atlasPath);
+    fprintf(file, "#define ATLAS_WIDTH %d\n#define ATLAS_HEIGHT %d\n\n", width, height);
+    fprintf(file, "static const AtlasSprite ATLAS_SPRITES[SPRITE_COUNT] = {\n");
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        const PackedFrame* frame = &frames[i];
+        fprintf(file, "    [%s] = { { %d, %d }, { %d, %d }, { %d, %d, %d, %d }, { %d, %d, %d, %d } }%s\n",
+                SHEET_FRAMES[i].name,
+                (int)SHEET_FRAMES[i].source.width, (int)SHEET_FRAMES[i].source.height,
+                frame->trim.x, frame->trim.y,
+                frame->x, frame->y, frame->trim.width, frame->trim.height,
+                frame->hitbox.x, frame->hitbox.y, frame->hitbox.width, frame->hitbox.height,
+                i + 1 < SPRITE_COUNT ? "," : "");
+    }
+    fprintf(file, "};\n\n#endif\n");
+    return fclose(file) == 0;
+}
+
+// One bit per atlas pixel at or above COLLISION_ALPHA_THRESHOLD, laid out
+// like a CollisionMask row: bit (x & 63) of word (x >> 6)
+static bool WriteMaskHeader(const char* path, const char* sheetPath, const Color* atlas, int width, int height) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    int wordsPerRow = (width + 63) / 64;
+    fprintf(file, "// Generated by tools/atlas_packer.c from %s; do not edit.\n", sheetPath);
+    fprintf(file, "#ifndef ATLAS_MASK_H\n#define ATLAS_MASK_H\n#include \"atlas.h\"\n#include <stdint.h>\n\n");
+    fprintf(file, "#define ATLAS_MASK_WORDS_PER_ROW %d\n\n", wordsPerRow);
+    fprintf(file, "static const uint64_t ATLAS_MASK_BITS[ATLAS_HEIGHT][ATLAS_MASK_WORDS_PER_ROW] = {\n");
+    for (int y = 0; y < height; y++) {
+        fprintf(file, "    {");
+        for (int word = 0; word < wordsPerRow; word++) {
+            uint64_t bits = 0;
+            for (int bit = 0; bit < 64 && word * 64 + bit < width; bit++) {
+                if (atlas[y * width + word * 64 + bit].a >= COLLISION_ALPHA_THRESHOLD) bits |= 1ULL << bit;
+            }
+            const char* separator = word + 1 < wordsPerRow ? "," : "";
+            if (bits) {
+                fprintf(file, " 0x%016llxULL%s", (unsigned long long)bits, separator);
+            } else {
+                fprintf(file, " 0%s", separator);
+            }
+        }
+        fprintf(file, " }%s\n", y + 1 < height ? "," : "");
+    }
+    fprintf(file, "};\n\n#endif\n");
+    return fclose(file) == 0;
+}
+
+int main(int argc, char** argv) {
+    const char* sheetPath = argc > 1 ? argv[1] : "resources/sprite.png";
+    const char* atlasPath = argc > 2 ? argv[2] : "resources/atlas.png";
+    const char* headerPath = argc > 3 ? argv[3] : "src/atlas.h";
+    const char* maskPath = argc > 4 ? argv[4] : "src/atlas_mask.h";
+
+    Image image = LoadImage(sheetPath);
+    if (!image.data) {
+        fprintf(stderr, "cannot load %s\n", sheetPath);
+        return 1;
+    }
+    Color* pixels = LoadImageColors(image);
+    Sheet sheet = { pixels, image.width, image.height };
+
+    PackedFrame frames[SPRITE_COUNT] = { 0 };
+    int order[SPRITE_COUNT];
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        frames[i].trim = AlphaBounds(&sheet, SHEET_FRAMES[i].source, 1);
+        frames[i].hitbox = AlphaBounds(&sheet, SHEET_FRAMES[i].source, COLLISION_ALPHA_THRESHOLD);
+        order[i] = i;
+    }
+    // Insertion sort by height, ties kept in sprite order so output is stable
+    for (int i = 1; i < SPRITE_COUNT; i++) {
+        int key = order[i];
+        int j = i - 1;
+        while (j >= 0 && frames[order[j]].trim.height < frames[key].trim.height) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = key;
+    }
+
+    int bestWidth = 0, bestHeight = 0;
+    for (int width = 64; width <= ATLAS_MAX_SIZE; width <<= 1) {
+        int used = PackShelves(frames, order, width);
+        if (used < 0) continue;
+        int height = NextPowerOfTwo(used);
+        if (height > ATLAS_MAX_SIZE) continue;
+        long area = (long)width * height;
+        long bestArea = (long)bestWidth * bestHeight;
+        bool squarer = area == bestArea && (width > height ? width : height) < (bestWidth > bestHeight ? bestWidth : bestHeight);
+        if (bestWidth == 0 || area < bestArea || squarer) {
+            bestWidth = width;
+            bestHeight = height;
+        }
+    }
+    if (bestWidth == 0) {
+        fprintf(stderr, "frames do not fit in a %dx%d atlas\n", ATLAS_MAX_SIZE, ATLAS_MAX_SIZE);
+        return 1;
+    }
+    PackShelves(frames, order, bestWidth);
+
+    Color* atlas = calloc((size_t)bestWidth * bestHeight, sizeof(Color));
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        const PackedFrame* frame = &frames[i];
+        for (int y = 0; y < frame->trim.height; y++) {
+            for (int x = 0; x < frame->trim.width; x++) {
+                atlas[(frame->y + y) * bestWidth + frame->x + x] =
+                    FramePixel(&sheet, SHEET_FRAMES[i].source, frame->trim.x + x, frame->trim.y + y);
+            }
+        }
+    }
+    Image packed = {
+        .data = atlas,
+        .width = bestWidth,
+        .height = bestHeight,
+        .mipmaps = 1,
+        .format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8
+    };
+    bool ok = ExportImage(packed, atlasPath) && WriteHeader(headerPath, atlasPath, sheetPath, frames, bestWidth, bestHeight) &&
+              WriteMaskHeader(maskPath, sheetPath, atlas, bestWidth, bestHeight);
+    if (ok) {
+        printf("packed %d frames from %dx%d into %dx%d: %d KB -> %d KB of RGBA texture\n",
+               SPRITE_COUNT, image.width, image.height, bestWidth, bestHeight,
+               image.width * image.height * 4 / 1024, bestWidth * bestHeight * 4 / 1024);
+    } else {
+        fprintf(stderr, "cannot write %s, %s or %s\n", atlasPath, headerPath, maskPath);
+    }
+    free(atlas);
+    UnloadImageColors(pixels);
+    UnloadImage(image);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,63 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/autopilot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Headless soak run: the autopilot plays a series of seeded runs and the
+// tool reports how far it got and what each decision cost.
+//
+//   AutopilotSoak [runs] [max-seconds-per-run] [story]
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    int runs = argc > 1 ? atoi(argv[1]) : 100;
+    int maxSeconds = argc > 2 ? atoi(argv[2]) : 120;
+    bool storyMode = argc > 3 && strcmp(argv[3], "story") == 0;
+    uint32_t maxTicks = (uint32_t)maxSeconds * SIM_TICK_RATE;
+
+    long long totalTicks = 0;
+    long long totalScore = 0;
+    int deaths = 0;
+    int wins = 0;
+    int bestScore = 0;
+    double decisionTime = 0.0;
+    double worstDecision = 0.0;
+    AutopilotMemory autopilot = {0};
+
+    GameState game = {0};
+    InitSimState(&game, 1);
+    game.isStoryMode = storyMode;
+    for (int run = 0; run < runs; run++) {
+        ResetSimState(&game, 0xD1A0 + run);
+        while (!game.gameOver && game.tick < maxTicks) {
+            double start = NowSeconds();
+            PlayerInput input = ChooseAutopilotInput(&game, &autopilot);
+            double spent = NowSeconds() - start;
+            decisionTime += spent;
+            if (spent > worstDecision) worstDecision = spent;
+            StepGame(&game, input);
+        }
+        totalTicks += game.tick;
+        totalScore += game.score;
+        if (game.score > bestScore) bestScore = game.score;
+        if (game.gameWon) wins++;
+        else if (game.gameOver) deaths++;
+    }
+
+    printf("%d runs (%s), %d deaths, %d boss wins, %d survived %d s\n",
+           runs, storyMode ? "story" : "endless", deaths, wins, runs - deaths - wins, maxSeconds);
+    printf("mean score %.1f, best %d, mean survival %.1f s\n",
+           (double)totalScore / runs, bestScore, (double)totalTicks / runs / SIM_TICK_RATE);
+    printf("decision cost: mean %.2f us, worst %.2f us over %lld decisions\n",
+           decisionTime / totalTicks * 1e6, worstDecision * 1e6, totalTicks);
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/boss.h"
+#include "src/tuning.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Headless load test for the boss phase: pins the boss in a phase with
+// infinite player HP and times UpdateBoss() per tick, along with how many
+// projectiles the grid hands to the exact tests compared to the total.
+//
+//   BossBenchmark [boss-hp] [seconds]
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    int bossHP = argc > 1 ? atoi(argv[1]) : 2;
+    int seconds = argc > 2 ? atoi(argv[2]) : 60;
+    int ticks = seconds * SIM_TICK_RATE;
+
+    GameState* game = calloc(1, sizeof(GameState));
+    InitSimState(game, 0xB055);
+    game->isStoryMode = true;
+    game->bossActive = true;
+    game->score = (int)GetTuning()->bossThresholdScore;
+
+    double total = 0.0;
+    double worst = 0.0;
+    long long projectiles = 0;
+    long long candidates = 0;
+    int peak = 0;
+    for (int tick = 0; tick < ticks; tick++) {
+        game->bossHP = bossHP;
+        game->hp = PLAYER_HP_MAX;
+        game->effectCount = 0;
+        double start = NowSeconds();
+        UpdateBoss(game, SIM_DT);
+        double spent = NowSeconds() - start;
+        total += spent;
+        if (spent > worst) worst = spent;
+        projectiles += game->projectiles.count;
+        candidates += game->projectiles.candidatesTested;
+        if (game->projectiles.count > peak) peak = game->projectiles.count;
+    }
+
+    printf("boss HP %d, %d ticks: %.0f projectiles on average, peak %d of %d\n",
+           bossHP, ticks, (double)projectiles / ticks, peak, MAX_PROJECTILES);
+    printf("UpdateBoss: mean %.1f us, worst %.1f us per tick\n", total / ticks * 1e6, worst * 1e6);
+    printf("exact tests: %.1f per tick via the grid instead of %.0f\n",
+           (double)candidates / ticks, 2.0 * projectiles / ticks);
+    free(game);
+    return 0;
+}
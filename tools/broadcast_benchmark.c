@@ -0,0 +1,182 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/autopilot.h"
+#include "src/broadcast.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+// Spectator broadcast cost as the audience grows. An autopiloted game
+// (endless and story runs in turn) ticks at the real 60 Hz into a
+// broadcast server on loopback, watched by 1, 4, 16... in-process clients
+// that decode everything they get. Per step it prints the server's
+// encode and send time per tick and the bytes each spectator received;
+// encode should stay flat and only the send cost should grow. Exits
+// non-zero if any spectator ends a step on a different state.
+//
+//   BroadcastBenchmark [max-spectators] [seconds-per-step] [port]
+
+#define BENCHMARK_SEED 0xD1A0
+#define SETTLE_SECONDS 0.2
+
+typedef struct {
+    int socket;
+    uint8_t buffer[SPECTATOR_MAX_MESSAGE * 16];
+    int length;
+    SpectatorFrame state;
+    long long received;
+    bool broken;
+} TestClient;
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int ConnectClient(const char* port) {
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    struct addrinfo* addresses = NULL;
+    if (getaddrinfo("localhost", port, &hints, &addresses) != 0) return -1;
+    int fd = -1;
+    for (struct addrinfo* address = addresses; address; address = address->ai_next) {
+        fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd >= 0 && connect(fd, address->ai_addr, address->ai_addrlen) == 0) break;
+        if (fd >= 0) close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(addresses);
+    if (fd >= 0) fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+static void DrainClient(TestClient* client) {
+    while (!client->broken) {
+        ssize_t got = recv(client->socket, client->buffer + client->length, sizeof(client->buffer) - client->length, 0);
+        if (got < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        if (got <= 0) {
+            client->broken = true;
+            return;
+        }
+        client->length += (int)got;
+        client->received += got;
+        int offset = 0;
+        int used;
+        while ((used = DecodeSpectatorMessage(client->buffer + offset, client->length - offset, &client->state)) > 0) {
+            offset += used;
+        }
+        if (used < 0) client->broken = true;
+        memmove(client->buffer, client->buffer + offset, client->length - offset);
+        client->length -= offset;
+    }
+}
+
+static bool SameState(const SpectatorFrame* a, const SpectatorFrame* b) {
+    if (a->tick != b->tick || a->score != b->score || a->flags != b->flags || a->hp != b->hp ||
+        a->bossHP != b->bossHP || a->projectiles != b->projectiles || a->present != b->present) {
+        return false;
+    }
+    for (int id = 0; id < SPECTATOR_MAX_ENTITIES; id++) {
+        if (!(a->present & (1u << id))) continue;
+        const SpectatorEntity* x = &a->entities[id];
+        const SpectatorEntity* y = &b->entities[id];
+        if (x->sprite != y->sprite || x->x != y->x || x->y != y->y || x->width != y->width || x->height != y->height) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int maxSpectators = argc > 1 ? atoi(argv[1]) : BROADCAST_MAX_CLIENTS;
+    double seconds = argc > 2 ? atof(argv[2]) : 3.0;
+    const char* port = argc > 3 ? argv[3] : SPECTATOR_DEFAULT_PORT;
+    if (maxSpectators > BROADCAST_MAX_CLIENTS) maxSpectators = BROADCAST_MAX_CLIENTS;
+
+    BroadcastServer* server = StartBroadcast(port);
+    if (!server) {
+        fprintf(stderr, "cannot listen on port %s\n", port);
+        return 1;
+    }
+    GameState* game = calloc(1, sizeof(GameState));
+    TestClient* clients = calloc(BROADCAST_MAX_CLIENTS, sizeof(TestClient));
+    InitSimState(game, 1);
+    ResetSimState(game, BENCHMARK_SEED);
+    int run = 0;
+    AutopilotMemory autopilot = {0};
+
+    printf("spectators  ticks  skipped  encode us/tick  send us/tick  send us/spectator  bytes/s/spectator  dropped  state\n");
+    bool consistent = true;
+    int clientCount = 0;
+    for (int target = 1; clientCount < maxSpectators; target *= 4) {
+        if (target > maxSpectators) target = maxSpectators;
+        for (; clientCount < target; clientCount++) {
+            clients[clientCount].socket = ConnectClient(port);
+            if (clients[clientCount].socket < 0) {
+                fprintf(stderr, "cannot connect spectator %d\n", clientCount + 1);
+                return 1;
+            }
+        }
+        // Let the server take the newcomers in before measuring
+        double settle = NowSeconds() + SETTLE_SECONDS;
+        while (NowSeconds() < settle) {
+            for (int i = 0; i < clientCount; i++) DrainClient(&clients[i]);
+        }
+        atomic_store(&server->frames, 0);
+        atomic_store(&server->skipped, 0);
+        atomic_store(&server->bytesSent, 0);
+        atomic_store(&server->encodeNanoseconds, 0);
+        atomic_store(&server->sendNanoseconds, 0);
+        for (int i = 0; i < clientCount; i++) clients[i].received = 0;
+
+        const long long tick = 1000000000LL / SIM_TICK_RATE;
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long long next = (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+        double start = NowSeconds();
+        while (NowSeconds() - start < seconds) {
+            if (game->gameOver) {
+                ResetSimState(game, BENCHMARK_SEED + ++run);
+                game->isStoryMode = run % 2 == 1;
+            }
+            StepGame(game, ChooseAutopilotInput(game, &autopilot));
+            SubmitBroadcastFrame(server, game);
+            for (int i = 0; i < clientCount; i++) DrainClient(&clients[i]);
+            next += tick;
+            struct timespec deadline = { next / 1000000000LL, next % 1000000000LL };
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+        }
+        double elapsed = NowSeconds() - start;
+        settle = NowSeconds() + SETTLE_SECONDS;
+        while (NowSeconds() < settle) {
+            for (int i = 0; i < clientCount; i++) DrainClient(&clients[i]);
+        }
+
+        bool same = true;
+        long long received = 0;
+        for (int i = 0; i < clientCount; i++) {
+            same &= !clients[i].broken && clients[i].state.tick == game->tick && SameState(&clients[i].state, &clients[0].state);
+            received += clients[i].received;
+        }
+        consistent &= same;
+        int frames = atomic_load(&server->frames);
+        double encodeUs = frames ? atomic_load(&server->encodeNanoseconds) / 1e3 / frames : 0.0;
+        double sendUs = frames ? atomic_load(&server->sendNanoseconds) / 1e3 / frames : 0.0;
+        printf("%10d  %5d  %7d  %14.2f  %12.2f  %17.2f  %17.0f  %7d  %s\n", clientCount, frames,
+               atomic_load(&server->skipped), encodeUs, sendUs, sendUs / clientCount,
+               received / elapsed / clientCount, atomic_load(&server->dropped), same ? "ok" : "DIVERGED");
+    }
+
+    StopBroadcast(server);
+    for (int i = 0; i < clientCount; i++) close(clients[i].socket);
+    free(clients);
+    free(game);
+    return consistent ? 0 : 1;
+}
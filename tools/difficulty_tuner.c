@@ -0,0 +1,257 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/autopilot.h"
+#include "src/rng.h"
+#include "src/tuning.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Searches the tuning table (src/tuning.c) for values whose bot-played
+// difficulty follows the target curves below, and writes them as a tuning
+// file for the game to load.
+//
+// A candidate is scored on thousands of seeded headless runs spread over
+// every core: half endless, for the share of runs still alive at each
+// checkpoint, and half story, for the boss win rate. The player is the
+// autopilot with attention lapses (now and then it lets go of the keys
+// for a moment), since the autopilot alone never dies in endless mode.
+// Every candidate plays the same seeds, so what separates two candidates
+// is their parameters and not the luck of the draw.
+//
+// The search is a (1+lambda) evolution strategy over the parameters
+// scaled to their ranges: each generation tries a few random steps from
+// the best table so far and keeps the best of them if it scores better.
+// The step grows after a success and shrinks after a miss. A small pull
+// back toward the starting table keeps parameters the curves can't see
+// where they were.
+//
+//   DifficultyTuner [out-file] [generations] [runs-per-candidate] [threads]
+
+#define TUNER_SEED 0x7E57
+#define TUNER_OFFSPRING 6
+#define TUNER_START_STEP 0.15f
+#define TUNER_MIN_STEP 0.01f
+#define TUNER_MAX_STEP 0.5f
+#define TUNER_MAX_SECONDS 120
+#define TUNER_REGULARIZATION 0.02f
+#define TUNER_BOSS_WEIGHT 2.0f
+#define LAPSE_CHANCE (1.0f / (25 * SIM_TICK_RATE)) // per tick: one every ~25 s
+#define LAPSE_MIN_TICKS 15
+#define LAPSE_MAX_TICKS 45
+
+// Share of endless runs still going after each time, and story wins
+static const float SURVIVAL_SECONDS[] = { 15, 30, 60, 90, 120 };
+static const float SURVIVAL_TARGET[] = { 0.75f, 0.55f, 0.30f, 0.15f, 0.08f };
+#define SURVIVAL_POINTS (int)(sizeof(SURVIVAL_SECONDS) / sizeof(SURVIVAL_SECONDS[0]))
+#define BOSS_WIN_TARGET 0.25f
+
+typedef struct {
+    float survival[SURVIVAL_POINTS];
+    float bossWinRate;
+    float loss;
+} Evaluation;
+
+typedef struct {
+    int runs; // the first half endless, the rest story
+    atomic_int nextRun;
+    const uint64_t* gameSeeds;
+    const uint64_t* lapseSeeds;
+    uint32_t* ticks;
+    bool* won;
+} RunBatch;
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// The autopilot's choice, except during a lapse, when nothing is pressed
+static PlayerInput LapsingInput(const GameState* game, AutopilotMemory* autopilot, uint64_t* rng, int* lapseTicks) {
+    if (*lapseTicks > 0) {
+        (*lapseTicks)--;
+        return INPUT_NONE;
+    }
+    if (NextRandomFloat(rng) < LAPSE_CHANCE) {
+        *lapseTicks = NextRandomValue(rng, LAPSE_MIN_TICKS, LAPSE_MAX_TICKS);
+        return INPUT_NONE;
+    }
+    return ChooseAutopilotInput(game, autopilot);
+}
+
+static void* RunWorker(void* arg) {
+    RunBatch* batch = arg;
+    GameState* game = calloc(1, sizeof(GameState));
+    if (!game) return NULL;
+    InitSimState(game, 1);
+    const uint32_t maxTicks = TUNER_MAX_SECONDS * SIM_TICK_RATE;
+    for (;;) {
+        int run = atomic_fetch_add(&batch->nextRun, 1);
+        if (run >= batch->runs) break;
+        game->isStoryMode = run >= batch->runs / 2;
+        ResetSimState(game, batch->gameSeeds[run]);
+        uint64_t rng;
+        SeedRng(&rng, batch->lapseSeeds[run]);
+        int lapseTicks = 0;
+        AutopilotMemory autopilot = {0};
+        while (!game->gameOver && game->tick < maxTicks) {
+            StepGame(game, LapsingInput(game, &autopilot, &rng, &lapseTicks));
+        }
+        batch->ticks[run] = game->tick;
+        batch->won[run] = game->gameWon;
+    }
+    free(game);
+    return NULL;
+}
+
+static float Normalized(const TuningParams* params, int index) {
+    const TuningParamInfo* info = &TUNING_PARAMS[index];
+    return (ReadTuningValue(params, index) - info->min) / (info->max - info->min);
+}
+
+static Evaluation Evaluate(const TuningParams* params, const TuningParams* start, RunBatch* batch, int threadCount) {
+    SetTuning(params);
+    atomic_store(&batch->nextRun, 0);
+    pthread_t threads[threadCount];
+    for (int i = 0; i < threadCount; i++) pthread_create(&threads[i], NULL, RunWorker, batch);
+    for (int i = 0; i < threadCount; i++) pthread_join(threads[i], NULL);
+
+    Evaluation result = {0};
+    int endless = batch->runs / 2;
+    for (int run = 0; run < endless; run++) {
+        for (int p = 0; p < SURVIVAL_POINTS; p++) {
+            if (batch->ticks[run] >= SURVIVAL_SECONDS[p] * SIM_TICK_RATE) result.survival[p] += 1.0f / endless;
+        }
+    }
+    for (int run = endless; run < batch->runs; run++) {
+        if (batch->won[run]) result.bossWinRate += 1.0f / (batch->runs - endless);
+    }
+    for (int p = 0; p < SURVIVAL_POINTS; p++) {
+        float miss = result.survival[p] - SURVIVAL_TARGET[p];
+        result.loss += miss * miss;
+    }
+    float bossMiss = result.bossWinRate - BOSS_WIN_TARGET;
+    result.loss += TUNER_BOSS_WEIGHT * bossMiss * bossMiss;
+    for (int i = 0; i < TUNING_PARAM_COUNT; i++) {
+        float drift = Normalized(params, i) - Normalized(start, i);
+        result.loss += TUNER_REGULARIZATION * drift * drift;
+    }
+    return result;
+}
+
+static float Gaussian(uint64_t* rng) {
+    float u = fmaxf(NextRandomFloat(rng), 1e-7f);
+    float v = NextRandomFloat(rng);
+    return sqrtf(-2.0f * logf(u)) * cosf(2.0f * PI * v);
+}
+
+static TuningParams Mutate(const TuningParams* parent, float step, uint64_t* rng) {
+    TuningParams child = *parent;
+    for (int i = 0; i < TUNING_PARAM_COUNT; i++) {
+        const TuningParamInfo* info = &TUNING_PARAMS[i];
+        *TuningValue(&child, i) += Gaussian(rng) * step * (info->max - info->min);
+    }
+    ClampTuning(&child);
+    return child;
+}
+
+static void PrintEvaluation(const char* label, const Evaluation* evaluation) {
+    printf("%s loss %.4f  alive", label, evaluation->loss);
+    for (int p = 0; p < SURVIVAL_POINTS; p++) {
+        printf(" %.0fs:%.2f", SURVIVAL_SECONDS[p], evaluation->survival[p]);
+    }
+    printf("  boss wins %.2f\n", evaluation->bossWinRate);
+}
+
+int main(int argc, char** argv) {
+    const char* outPath = argc > 1 ? argv[1] : "tuning-tuned.txt";
+    int generations = argc > 2 ? atoi(argv[2]) : 15;
+    int runs = argc > 3 ? atoi(argv[3]) : 4000;
+    int threadCount = argc > 4 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (runs < 2) runs = 2;
+    if (threadCount < 1) threadCount = 1;
+
+    TuningParams start;
+    LoadTuning(TUNING_FILE, &start);
+    uint64_t* gameSeeds = calloc(runs, sizeof(uint64_t));
+    uint64_t* lapseSeeds = calloc(runs, sizeof(uint64_t));
+    RunBatch batch = {
+        .runs = runs, .gameSeeds = gameSeeds, .lapseSeeds = lapseSeeds,
+        .ticks = calloc(runs, sizeof(uint32_t)), .won = calloc(runs, sizeof(bool))
+    };
+    if (!gameSeeds || !lapseSeeds || !batch.ticks || !batch.won) {
+        fprintf(stderr, "cannot allocate %d runs\n", runs);
+        return 1;
+    }
+    // Seeds are drawn from one hashed stream, not stepped by a constant:
+    // SplitMix64 states a fixed step apart play the same numbers shifted by
+    // a draw, and neighbouring runs would die together
+    uint64_t rng;
+    SeedRng(&rng, TUNER_SEED);
+    for (int run = 0; run < runs; run++) {
+        gameSeeds[run] = NextRandom(&rng);
+        lapseSeeds[run] = NextRandom(&rng);
+    }
+
+    printf("%d runs per candidate on %d threads, %d offspring per generation\n", runs, threadCount, TUNER_OFFSPRING);
+    printf("target            alive");
+    for (int p = 0; p < SURVIVAL_POINTS; p++) printf(" %.0fs:%.2f", SURVIVAL_SECONDS[p], SURVIVAL_TARGET[p]);
+    printf("  boss wins %.2f\n", BOSS_WIN_TARGET);
+
+    double begin = NowSeconds();
+    TuningParams best = start;
+    Evaluation bestEvaluation = Evaluate(&best, &start, &batch, threadCount);
+    PrintEvaluation("start  ", &bestEvaluation);
+    float step = TUNER_START_STEP;
+    int candidates = 1;
+    for (int generation = 1; generation <= generations; generation++) {
+        TuningParams parent = best;
+        bool improved = false;
+        for (int child = 0; child < TUNER_OFFSPRING; child++) {
+            TuningParams candidate = Mutate(&parent, step, &rng);
+            Evaluation evaluation = Evaluate(&candidate, &start, &batch, threadCount);
+            candidates++;
+            if (evaluation.loss < bestEvaluation.loss) {
+                best = candidate;
+                bestEvaluation = evaluation;
+                improved = true;
+            }
+        }
+        step = improved ? fminf(step * 1.5f, TUNER_MAX_STEP) : fmaxf(step * 0.6f, TUNER_MIN_STEP);
+        char label[16];
+        snprintf(label, sizeof(label), "gen %-3d", generation);
+        PrintEvaluation(label, &bestEvaluation);
+    }
+    double elapsed = NowSeconds() - begin;
+    printf("%d candidates, %lld runs in %.1f s (%.0f runs/s)\n", candidates, (long long)candidates * runs, elapsed,
+           candidates * runs / elapsed);
+
+    char comment[512];
+    int length = snprintf(comment, sizeof(comment), "Written by DifficultyTuner: %d runs per candidate, %d candidates\n"
+                          "alive", runs, candidates);
+    for (int p = 0; p < SURVIVAL_POINTS && length < (int)sizeof(comment); p++) {
+        length += snprintf(comment + length, sizeof(comment) - length, " %.0fs:%.2f (target %.2f)",
+                           SURVIVAL_SECONDS[p], bestEvaluation.survival[p], SURVIVAL_TARGET[p]);
+    }
+    if (length < (int)sizeof(comment)) {
+        snprintf(comment + length, sizeof(comment) - length, "\nboss wins %.2f (target %.2f)",
+                 bestEvaluation.bossWinRate, BOSS_WIN_TARGET);
+    }
+    bool saved = SaveTuning(outPath, &best, comment);
+    if (saved) {
+        printf("wrote %s\n", outPath);
+    } else {
+        fprintf(stderr, "cannot write %s\n", outPath);
+    }
+    free(gameSeeds);
+    free(lapseSeeds);
+    free(batch.ticks);
+    free(batch.won);
+    return saved ? 0 : 1;
+}
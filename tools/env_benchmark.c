@@ -0,0 +1,61 @@
+#include "src/types.h"
+#include "src/env.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Steps a batch of headless environments with a fixed pseudo-random policy
+// and reports throughput, as a smoke test for the vectorized env API.
+//
+//   EnvBenchmark [envs] [threads] [steps]
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    int envCount = argc > 1 ? atoi(argv[1]) : 256;
+    int threadCount = argc > 2 ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int steps = argc > 3 ? atoi(argv[3]) : 10000;
+
+    VecEnv* env = CreateVecEnv(envCount, threadCount, 1234, false);
+    if (!env) {
+        fprintf(stderr, "invalid environment count %d\n", envCount);
+        return 2;
+    }
+    uint8_t* actions = calloc(envCount, sizeof(uint8_t));
+    unsigned int policy = 1;
+    long long episodes = 0;
+    double totalReward = 0.0;
+
+    double start = NowSeconds();
+    for (int step = 0; step < steps; step++) {
+        for (int i = 0; i < envCount; i++) {
+            // Jump whenever the nearest obstacle is close, otherwise idle
+            const float* obs = &env->observations[i * ENV_OBSERVATION_SIZE];
+            policy = policy * 1103515245u + 12345u;
+            float distance = obs[ENV_PLAYER_FEATURES];
+            actions[i] = (distance < 0.12f || (policy >> 16) % 97 == 0) ? ENV_ACTION_JUMP : ENV_ACTION_NONE;
+        }
+        EnvStep(env, actions);
+        for (int i = 0; i < envCount; i++) {
+            totalReward += env->rewards[i];
+            episodes += env->dones[i];
+        }
+    }
+    double elapsed = NowSeconds() - start;
+
+    double stepsPerSecond = (double)envCount * steps / elapsed;
+    printf("%d envs x %d steps on %d threads in %.3f s\n", envCount, steps, env->threadCount, elapsed);
+    printf("%.0f steps/s total, %.0f steps/s per thread\n", stepsPerSecond, stepsPerSecond / env->threadCount);
+    printf("%lld episodes finished, mean reward per episode %.1f\n",
+           episodes, episodes ? totalReward / episodes : 0.0);
+
+    free(actions);
+    DestroyVecEnv(env);
+    return 0;
+}
@@ -0,0 +1,251 @@
+#define _GNU_SOURCE
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// Local stand-in for the shared leaderboard, for testing the game's
+// client. Accepts POST /scores batches, keeps each run once (by seed and
+// replay hash) in a text file, and serves the top ten on GET /scores.
+// A failure rate makes it answer 503 at random to exercise the retries.
+//
+//   LeaderboardServer [port] [file] [fail-percent]
+
+#define MAX_HEAD 8192
+#define MAX_BODY 65536
+#define TOP_SCORES 10
+
+typedef struct {
+    char machine[64];
+    char seed[17];
+    char replay[17];
+    int score;
+    unsigned ticks;
+    char mode[8];
+    bool won;
+} Entry;
+
+static Entry* entries;
+static int entryCount;
+static int entryCapacity;
+
+static bool AddEntry(const Entry* entry) {
+    for (int i = 0; i < entryCount; i++) {
+        if (strcmp(entries[i].seed, entry->seed) == 0 && strcmp(entries[i].replay, entry->replay) == 0) return false;
+    }
+    if (entryCount == entryCapacity) {
+        int capacity = entryCapacity ? entryCapacity * 2 : 256;
+        Entry* grown = realloc(entries, capacity * sizeof(Entry));
+        if (!grown) return false;
+        entries = grown;
+        entryCapacity = capacity;
+    }
+    entries[entryCount++] = *entry;
+    return true;
+}
+
+static void LoadEntries(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) return;
+    Entry entry;
+    int won;
+    while (fscanf(file, "%63s %16s %16s %d %u %7s %d", entry.machine, entry.seed, entry.replay, &entry.score,
+                  &entry.ticks, entry.mode, &won) == 7) {
+        entry.won = won != 0;
+        AddEntry(&entry);
+    }
+    fclose(file);
+}
+
+// Value of "key" inside [start, end): a string copied into `out`, or a
+// bare number/literal. False when the key is missing.
+static bool JsonField(const char* start, const char* end, const char* key, char* out, size_t size) {
+    char pattern[32];
+    snprintf(pattern, sizeof(pattern), "\"%s\":", key);
+    const char* found = strstr(start, pattern);
+    if (!found || found >= end) return false;
+    const char* value = found + strlen(pattern);
+    bool quoted = *value == '"';
+    if (quoted) value++;
+    size_t length = 0;
+    while (value + length < end && length + 1 < size) {
+        char c = value[length];
+        if (quoted ? c == '"' : (c == ',' || c == '}' || c == ' ')) break;
+        if (c == ' ' || c == '\t' || c == '\n') return false;
+        out[length++] = c;
+    }
+    out[length] = '\0';
+    return length > 0;
+}
+
+static bool IsHex16(const char* text) {
+    if (strlen(text) != 16) return false;
+    for (const char* c = text; *c; c++) {
+        if (!strchr("0123456789abcdef", *c)) return false;
+    }
+    return true;
+}
+
+static int ParseScores(const char* body, FILE* store, int* duplicates) {
+    char machine[64] = "unknown";
+    const char* bodyEnd = body + strlen(body);
+    JsonField(body, bodyEnd, "machine", machine, sizeof(machine));
+    for (char* c = machine; *c; c++) {
+        if (*c == ' ') *c = '_';
+    }
+    const char* cursor = strstr(body, "\"scores\"");
+    int accepted = 0;
+    *duplicates = 0;
+    while (cursor && (cursor = strchr(cursor, '{'))) {
+        const char* end = strchr(cursor, '}');
+        if (!end) break;
+        Entry entry = {0};
+        char number[24], won[8];
+        snprintf(entry.machine, sizeof(entry.machine), "%s", machine);
+        bool ok = JsonField(cursor, end, "seed", entry.seed, sizeof(entry.seed)) && IsHex16(entry.seed) &&
+                  JsonField(cursor, end, "replay", entry.replay, sizeof(entry.replay)) && IsHex16(entry.replay) &&
+                  JsonField(cursor, end, "mode", entry.mode, sizeof(entry.mode)) &&
+                  JsonField(cursor, end, "won", won, sizeof(won)) &&
+                  JsonField(cursor, end, "score", number, sizeof(number));
+        if (ok) {
+            entry.score = atoi(number);
+            entry.won = strcmp(won, "true") == 0;
+            ok = JsonField(cursor, end, "ticks", number, sizeof(number));
+            entry.ticks = ok ? (unsigned)strtoul(number, NULL, 10) : 0;
+        }
+        if (ok && (strcmp(entry.mode, "story") == 0 || strcmp(entry.mode, "endless") == 0)) {
+            if (AddEntry(&entry)) {
+                fprintf(store, "%s %s %s %d %u %s %d\n", entry.machine, entry.seed, entry.replay, entry.score,
+                        entry.ticks, entry.mode, entry.won);
+                accepted++;
+            } else {
+                (*duplicates)++;
+            }
+        }
+        cursor = end + 1;
+    }
+    fflush(store);
+    return accepted;
+}
+
+static int CompareScores(const void* a, const void* b) {
+    return ((const Entry*)b)->score - ((const Entry*)a)->score;
+}
+
+static void Respond(int fd, int status, const char* reason, const char* body) {
+    char head[256];
+    int length = snprintf(head, sizeof(head),
+                          "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %zu\r\n"
+                          "Connection: close\r\n\r\n",
+                          status, reason, strlen(body));
+    send(fd, head, length, MSG_NOSIGNAL);
+    send(fd, body, strlen(body), MSG_NOSIGNAL);
+}
+
+static void ServeTop(int fd) {
+    Entry* sorted = malloc((entryCount ? entryCount : 1) * sizeof(Entry));
+    if (!sorted) {
+        Respond(fd, 500, "Internal Server Error", "{}");
+        return;
+    }
+    memcpy(sorted, entries, entryCount * sizeof(Entry));
+    qsort(sorted, entryCount, sizeof(Entry), CompareScores);
+    char body[4096];
+    int length = snprintf(body, sizeof(body), "[");
+    for (int i = 0; i < entryCount && i < TOP_SCORES; i++) {
+        length += snprintf(body + length, sizeof(body) - length,
+                           "%s{\"machine\":\"%s\",\"score\":%d,\"mode\":\"%s\",\"won\":%s,\"replay\":\"%s\"}",
+                           i ? "," : "", sorted[i].machine, sorted[i].score, sorted[i].mode,
+                           sorted[i].won ? "true" : "false", sorted[i].replay);
+    }
+    snprintf(body + length, sizeof(body) - length, "]");
+    free(sorted);
+    Respond(fd, 200, "OK", body);
+}
+
+static void HandleClient(int fd, FILE* store, int failPercent) {
+    static char request[MAX_HEAD + MAX_BODY + 1];
+    int received = 0;
+    char* bodyStart = NULL;
+    request[0] = '\0';
+    while (received < MAX_HEAD && !(bodyStart = strstr(request, "\r\n\r\n"))) {
+        ssize_t got = recv(fd, request + received, MAX_HEAD - received, 0);
+        if (got <= 0) return;
+        received += got;
+        request[received] = '\0';
+    }
+    if (!bodyStart) {
+        Respond(fd, 431, "Request Header Fields Too Large", "{}");
+        return;
+    }
+    bodyStart += 4;
+    char method[8] = "", path[64] = "";
+    sscanf(request, "%7s %63s", method, path);
+    const char* lengthHeader = strcasestr(request, "Content-Length:");
+    int contentLength = lengthHeader && lengthHeader < bodyStart ? atoi(lengthHeader + 15) : 0;
+    if (contentLength < 0 || contentLength > MAX_BODY) {
+        Respond(fd, 413, "Payload Too Large", "{}");
+        return;
+    }
+    int have = received - (int)(bodyStart - request);
+    while (have < contentLength) {
+        ssize_t got = recv(fd, bodyStart + have, contentLength - have, 0);
+        if (got <= 0) return;
+        have += got;
+    }
+    bodyStart[contentLength] = '\0';
+
+    if (failPercent > 0 && rand() % 100 < failPercent) {
+        Respond(fd, 503, "Service Unavailable", "{}");
+        printf("%s %s -> 503 (injected)\n", method, path);
+    } else if (strcmp(method, "POST") == 0 && strcmp(path, "/scores") == 0) {
+        int duplicates;
+        int accepted = ParseScores(bodyStart, store, &duplicates);
+        char body[96];
+        snprintf(body, sizeof(body), "{\"accepted\":%d,\"duplicates\":%d}", accepted, duplicates);
+        Respond(fd, 200, "OK", body);
+        printf("POST /scores -> %d new, %d duplicate, %d total\n", accepted, duplicates, entryCount);
+    } else if (strcmp(method, "GET") == 0 && strcmp(path, "/scores") == 0) {
+        ServeTop(fd);
+    } else {
+        Respond(fd, 404, "Not Found", "{}");
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    int port = argc > 1 ? atoi(argv[1]) : 8787;
+    const char* path = argc > 2 ? argv[2] : "leaderboard-server.txt";
+    int failPercent = argc > 3 ? atoi(argv[3]) : 0;
+    signal(SIGPIPE, SIG_IGN);
+
+    LoadEntries(path);
+    FILE* store = fopen(path, "a");
+    if (!store) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    struct sockaddr_in address = { .sin_family = AF_INET, .sin_port = htons(port), .sin_addr.s_addr = htonl(INADDR_ANY) };
+    if (bind(listener, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(listener, 16) != 0) {
+        perror("listen");
+        return 1;
+    }
+    printf("leaderboard on port %d, %d runs in %s\n", port, entryCount, path);
+    fflush(stdout);
+    for (;;) {
+        int fd = accept(listener, NULL, NULL);
+        if (fd < 0) continue;
+        struct timeval timeout = { 3, 0 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        HandleClient(fd, store, failPercent);
+        close(fd);
+    }
+}
@@ -0,0 +1,56 @@
+#include "src/livestate.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Example reader for the shared-memory live state: attaches to a running
+// game, follows every frame it publishes and prints a line per second
+// with the newest frame and how many frames were read or missed.
+//
+//   LiveMonitor [seconds]
+
+static void SleepSeconds(double seconds) {
+    struct timespec ts = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+    nanosleep(&ts, NULL);
+}
+
+int main(int argc, char** argv) {
+    int seconds = argc > 1 ? atoi(argv[1]) : 10;
+
+    LiveState* live = OpenLiveStateReader(LIVE_STATE_NAME);
+    if (!live) {
+        fprintf(stderr, "no live state at %s, is the game running?\n", LIVE_STATE_NAME);
+        return 1;
+    }
+
+    uint64_t next = LatestLiveFrame(live);
+    long long read = 0;
+    long long missed = 0;
+    LiveFrame frame = {0};
+    const int pollsPerSecond = 250;
+    for (int poll = 0; poll < seconds * pollsPerSecond; poll++) {
+        uint64_t latest = LatestLiveFrame(live);
+        // Anything older than the ring is gone; skip ahead
+        if (latest - next > LIVE_RING_SLOTS) {
+            missed += latest - LIVE_RING_SLOTS - next;
+            next = latest - LIVE_RING_SLOTS;
+        }
+        for (; next < latest; next++) {
+            if (ReadLiveFrame(live, next, &frame)) {
+                read++;
+            } else {
+                missed++;
+            }
+        }
+        if (poll % pollsPerSecond == pollsPerSecond - 1) {
+            printf("frame %llu tick %u score %d hp %d boss %d obstacles %d meteors %d projectiles %d%s | read %lld missed %lld\n",
+                   (unsigned long long)frame.frame, frame.tick, frame.score, frame.hp, frame.bossHP,
+                   frame.obstacleCount, frame.meteorCount, frame.projectileCount,
+                   frame.flags & LIVE_FLAG_GAME_OVER ? " (game over)" : "", read, missed);
+        }
+        SleepSeconds(1.0 / pollsPerSecond);
+    }
+    CloseLiveState(live);
+    return 0;
+}
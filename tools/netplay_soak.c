@@ -0,0 +1,138 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/netplay.h"
+#include "src/rng.h"
+#include "src/scheduler.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+// Headless versus soak: one end of a rollback match with a bot at the
+// keys, ticking at the real 60 Hz. Start two of them, e.g. on loopback
+// with a bad link:
+//
+//   NetplaySoak listen 60 100,20,5 & NetplaySoak 127.0.0.1 60 100,20,5
+//
+// Each end reports its rollbacks and the checksums it compared with the
+// peer, and exits non-zero if any of them disagreed.
+//
+//   NetplaySoak <listen[:port] | host[:port]> [seconds] [latency,jitter,loss%]
+
+#define CONNECT_TIMEOUT_SECONDS 10
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Taps and holds at random like a person would, and holds jump on the
+// game-over screen to ask for the rematch.
+static PlayerInput BotInput(const GameState* game, uint64_t* rng, int* holdTicks, PlayerInput* held) {
+    if (game->gameOver) return INPUT_JUMP;
+    if (*holdTicks > 0) {
+        (*holdTicks)--;
+        return *held;
+    }
+    int roll = NextRandomValue(rng, 0, 99);
+    if (roll < 3) {
+        *held = INPUT_JUMP;
+        *holdTicks = NextRandomValue(rng, 2, 20);
+    } else if (roll < 4) {
+        *held = INPUT_CROUCH;
+        *holdTicks = NextRandomValue(rng, 10, 40);
+    } else {
+        *held = INPUT_NONE;
+        *holdTicks = NextRandomValue(rng, 0, 10);
+    }
+    return *held;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <listen[:port] | host[:port]> [seconds] [latency,jitter,loss%%]\n", argv[0]);
+        return 1;
+    }
+    int seconds = argc > 2 ? atoi(argv[2]) : 60;
+    NetplaySession* session = StartNetplay(argv[1], argc > 3 ? argv[3] : NULL);
+    if (!session) {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    GameState* game = calloc(1, sizeof(GameState));
+    ObstacleScheduler scheduler = {0};
+    InitSimState(game, 1);
+    game->scheduler = &scheduler;
+    game->netplay = session;
+    uint64_t rng;
+    SeedRng(&rng, (uint64_t)getpid() * 0x9E3779B97F4A7C15ULL);
+    int holdTicks = 0;
+    PlayerInput held = INPUT_NONE;
+
+    const long long tick = 1000000000LL / SIM_TICK_RATE;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    long long next = (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+    double start = NowSeconds();
+    double matchStart = 0.0;
+    double stepTime = 0.0;
+    int steps = 0;
+    int rematches = 0;
+    uint64_t runSeed = 0;
+    for (;;) {
+        PollNetplay(session);
+        NetplayPhase phase = GetNetplayPhase(session);
+        if (phase == NETPLAY_DISCONNECTED) break;
+        if (phase == NETPLAY_CONNECTED) {
+            BeginNetplayMatch(session, game);
+            runSeed = game->runSeed;
+            matchStart = NowSeconds();
+            printf("%s, seed %016llx\n", session->hosting ? "peer joined" : "joined",
+                   (unsigned long long)session->seed);
+        }
+        if (!session->inMatch && NowSeconds() - start > CONNECT_TIMEOUT_SECONDS) {
+            fprintf(stderr, "no peer after %d s\n", CONNECT_TIMEOUT_SECONDS);
+            break;
+        }
+        if (session->inMatch && NowSeconds() - matchStart >= seconds) break;
+
+        double stepStart = NowSeconds();
+        if (TickNetplay(session, game, BotInput(game, &rng, &holdTicks, &held), true)) {
+            stepTime += NowSeconds() - stepStart;
+            steps++;
+        }
+        if (game->runSeed != runSeed) {
+            runSeed = game->runSeed;
+            rematches++;
+        }
+
+        next += tick;
+        struct timespec deadline = { next / 1000000000LL, next % 1000000000LL };
+        clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+    }
+
+    int desyncs = atomic_load(&session->desyncs);
+    int checks = atomic_load(&session->checks);
+    bool played = session->frame > 0;
+    if (played) {
+        int rollbacks = atomic_load(&session->rollbacks);
+        int resimulated = atomic_load(&session->resimulated);
+        printf("%u ticks as P%d, %d rematches, %d stalled ticks, %d packets dropped by the conditioner\n",
+               session->frame, session->localPlayer + 1, rematches, atomic_load(&session->stalls),
+               atomic_load(&session->dropped));
+        printf("%d rollbacks re-ran %d ticks (%.1f per rollback), worst rollback %.3f ms\n",
+               rollbacks, resimulated, rollbacks ? (double)resimulated / rollbacks : 0.0,
+               atomic_load(&session->worstRollbackUs) / 1000.0);
+        printf("tick incl. rollback: mean %.1f us over %d ticks\n", steps ? stepTime / steps * 1e6 : 0.0, steps);
+        printf("%d checksums compared with the peer, %d mismatched\n", checks, desyncs);
+        printf("obstacle chunks: %d from the scheduler, %d built on the tick\n", atomic_load(&scheduler.hits),
+               atomic_load(&scheduler.misses));
+    }
+    StopNetplay(session);
+    StopObstacleScheduler(&scheduler);
+    free(game);
+    return played && desyncs == 0 ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+#include "src/types.h"
+#include "src/particles.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Headless particle load test: keeps the pools topped up with meteor
+// impact bursts and times the per-frame integration at 60 FPS steps.
+//
+//   ParticleBenchmark [live-target] [frames]
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    int target = argc > 1 ? atoi(argv[1]) : 24000;
+    int frames = argc > 2 ? atoi(argv[2]) : 3600;
+
+    ParticleSystem* system = CreateParticleSystem();
+    if (!system) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    double total = 0.0;
+    double worst = 0.0;
+    long long liveSum = 0;
+    int minLive = target;
+    for (int frame = 0; frame < frames; frame++) {
+        int x = 200 + (frame * 37) % 1200;
+        while (system->stats.live + system->pendingSpawned < target) {
+            if (EmitEffect(system, EFFECT_METEOR_IMPACT, (Vector2){ x, BASE_RESOLUTION.y - GROUND_HEIGHT }, METEOR_MAX_SIZE) == 0) break;
+        }
+        double start = NowSeconds();
+        UpdateParticles(system, SIM_DT);
+        double spent = NowSeconds() - start;
+        total += spent;
+        if (spent > worst) worst = spent;
+        if (frame >= 60) {
+            liveSum += system->stats.live;
+            if (system->stats.live < minLive) minLive = system->stats.live;
+        }
+    }
+
+    int measured = frames > 60 ? frames - 60 : 1;
+    printf("%d frames, %.0f live on average (min %d), capacity %d\n",
+           frames, (double)liveSum / measured, minLive, PARTICLE_POOL_CAPACITY * PARTICLE_TEXTURE_COUNT);
+    printf("update: mean %.3f ms, worst %.3f ms per frame (budget %.1f ms incl. draw)\n",
+           total / frames * 1e3, worst * 1e3, PARTICLE_FRAME_BUDGET_MS);
+    DestroyParticleSystem(system);
+    return 0;
+}
@@ -0,0 +1,171 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/window.h"
+#include "src/menu.h"
+#include "src/draw.h"
+#include "src/render.h"
+#include "src/particles.h"
+#include "src/autopilot.h"
+#include "src/rng.h"
+#include "src/arena.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Headless render check: draws the menu and seeded, autopiloted runs
+// through the software backend, with no window or GPU. Times every
+// DrawGame() call and writes the frames listed below as PNGs; given a
+// golden directory it compares against those and exits non-zero when a
+// frame drifts past the tolerance.
+//
+//   RenderCapture [out-dir] [golden-dir] [width] [height]
+
+#define CAPTURE_SEED 0xD1A0
+#define CAPTURE_CHANNEL_TOLERANCE 8   // per channel, absorbs rounding differences
+#define CAPTURE_MAX_BAD_PIXELS 0.001  // fraction of the frame allowed past it
+
+typedef struct {
+    const char* name;
+    bool storyMode;
+    uint32_t tick; // 0 is the main menu
+} CaptureFrame;
+
+// A frame with a different mode, or an earlier tick, starts a new run
+static const CaptureFrame CAPTURE_FRAMES[] = {
+    { "menu", false, 0 },
+    { "day", false, 6 * SIM_TICK_RATE },
+    { "night", false, 23 * SIM_TICK_RATE },
+    { "boss", true, 12 * SIM_TICK_RATE }
+};
+#define CAPTURE_FRAME_COUNT (int)(sizeof(CAPTURE_FRAMES) / sizeof(CAPTURE_FRAMES[0]))
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Returns false only when a golden frame exists and doesn't match
+static bool SaveFrame(const char* name, const char* outDir, const char* goldenDir) {
+    const SoftCanvas* frame = GetRenderFramebuffer();
+    Image image = { frame->pixels, frame->width, frame->height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.png", outDir, name);
+    if (!ExportImage(image, path)) fprintf(stderr, "cannot write %s\n", path);
+    if (!goldenDir) {
+        printf("%-6s -> %s\n", name, path);
+        return true;
+    }
+
+    snprintf(path, sizeof(path), "%s/%s.png", goldenDir, name);
+    Image golden = LoadImage(path);
+    if (!golden.data || golden.width != frame->width || golden.height != frame->height) {
+        printf("%-6s MISSING %s at %dx%d\n", name, path, frame->width, frame->height);
+        UnloadImage(golden);
+        return false;
+    }
+    Color* expected = LoadImageColors(golden);
+    int count = frame->width * frame->height;
+    int bad = 0;
+    for (int i = 0; i < count; i++) {
+        Color a = frame->pixels[i], b = expected[i];
+        if (abs(a.r - b.r) > CAPTURE_CHANNEL_TOLERANCE || abs(a.g - b.g) > CAPTURE_CHANNEL_TOLERANCE ||
+            abs(a.b - b.b) > CAPTURE_CHANNEL_TOLERANCE) {
+            bad++;
+        }
+    }
+    UnloadImageColors(expected);
+    UnloadImage(golden);
+    bool match = bad <= count * CAPTURE_MAX_BAD_PIXELS;
+    printf("%-6s %s: %d of %d pixels differ\n", name, match ? "ok" : "MISMATCH", bad, count);
+    return match;
+}
+
+int main(int argc, char** argv) {
+    const char* outDir = argc > 1 ? argv[1] : ".";
+    const char* goldenDir = argc > 2 && argv[2][0] ? argv[2] : NULL;
+    int width = argc > 3 ? atoi(argv[3]) : BASE_RESOLUTION.x;
+    int height = argc > 4 ? atoi(argv[4]) : BASE_RESOLUTION.y;
+
+    if (!InitRenderBackend(RENDER_BACKEND_SOFTWARE, width, height)) {
+        fprintf(stderr, "cannot allocate a %dx%d framebuffer\n", width, height);
+        return 1;
+    }
+    GameState* game = calloc(1, sizeof(GameState));
+    LoadGameTextures(game);
+    InitSimState(game, CAPTURE_SEED);
+    game->autopilotEnabled = true;
+    game->particles = CreateParticleSystem();
+    if (game->particles) LoadParticleTextures(game->particles);
+
+    WindowState window = {0};
+    InitWindowState(&window);
+    window.width = width;
+    window.height = height;
+    RescaleGame(&window);
+
+    bool match = true;
+    double start = NowSeconds();
+    DrawMenu(&window);
+    printf("menu frame %.2f ms\n", (NowSeconds() - start) * 1e3);
+    match &= SaveFrame(CAPTURE_FRAMES[0].name, outDir, goldenDir);
+
+    double total = 0.0;
+    double worst = 0.0;
+    uint32_t frames = 0;
+    uint32_t tick = 0;
+    AutopilotMemory autopilot = {0};
+    for (int f = 1; f < CAPTURE_FRAME_COUNT; f++) {
+        const CaptureFrame* capture = &CAPTURE_FRAMES[f];
+        if (f == 1 || capture->storyMode != game->isStoryMode || capture->tick < tick) {
+            // Clouds draw from raylib's generator, screen shake from its own
+            SetRandomSeed(CAPTURE_SEED);
+            SeedScreenShake(CAPTURE_SEED);
+            ResetSimState(game, CAPTURE_SEED);
+            game->isStoryMode = capture->storyMode;
+            game->highScore = 0;
+            InitClouds(game);
+            if (game->particles) {
+                ClearParticles(game->particles);
+                SeedRng(&game->particles->rngState, CAPTURE_SEED);
+            }
+            tick = 0;
+        }
+        // One render frame per tick; after a game over the last frame repeats
+        for (; tick < capture->tick; tick++) {
+            StepGame(game, ChooseAutopilotInput(game, &autopilot));
+            for (int i = 0; i < game->effectCount; i++) {
+                const EffectEvent* effect = &game->effects[i];
+                if (game->particles) EmitEffect(game->particles, effect->type, effect->position, effect->size);
+            }
+            UpdateClouds(game, NULL, SIM_DT);
+            if (game->particles) {
+                UpdateParticles(game->particles, SIM_DT);
+                // The emit throttle follows wall time; pinned so frames repeat
+                game->particles->emitScale = 1.0f;
+            }
+
+            BeginMemoryFrame();
+            start = NowSeconds();
+            DrawGame(&window, game);
+            double spent = NowSeconds() - start;
+            EndMemoryFrame();
+            total += spent;
+            if (spent > worst) worst = spent;
+            frames++;
+        }
+        match &= SaveFrame(capture->name, outDir, goldenDir);
+        if (game->gameOver) printf("       run ended at score %d\n", game->score);
+    }
+
+    printf("DrawGame at %dx%d: mean %.2f ms, worst %.2f ms over %u frames\n", width, height,
+           total / frames * 1e3, worst * 1e3, frames);
+    printf("%ld frames allocated from the heap, frame arena peak %zu bytes\n", GetMemoryStats()->allocatingFrames,
+           GetMemoryStats()->arenaPeak);
+    DestroyParticleSystem(game->particles);
+    CloseRenderBackend();
+    free(game);
+    return match ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+#include "src/types.h"
+#include "src/replay.h"
+#include "src/tuning.h"
+
+#include <dirent.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Re-simulates every replay in a directory headlessly and reports whether
+// the claimed score and boss outcome match what the inputs really produce.
+// Runs under the tuning in TUNING_FILE, like the game.
+//
+//   ReplayVerifier <replay-dir> [threads]
+
+typedef struct {
+    char path[512];
+    ReplayHeader claimed;
+    ReplayResult result;
+} VerifyJob;
+
+typedef struct {
+    VerifyJob* jobs;
+    int jobCount;
+    atomic_int nextJob;
+} VerifyQueue;
+
+static bool HasReplayExtension(const char* name) {
+    size_t length = strlen(name);
+    size_t extLength = strlen(REPLAY_EXTENSION);
+    return length > extLength && strcmp(name + length - extLength, REPLAY_EXTENSION) == 0;
+}
+
+static int CompareJobs(const void* a, const void* b) {
+    return strcmp(((const VerifyJob*)a)->path, ((const VerifyJob*)b)->path);
+}
+
+static int CollectJobs(const char* dirPath, VerifyJob** jobs) {
+    DIR* dir = opendir(dirPath);
+    if (!dir) return -1;
+    int count = 0;
+    int capacity = 0;
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!HasReplayExtension(entry->d_name)) continue;
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            *jobs = realloc(*jobs, capacity * sizeof(VerifyJob));
+        }
+        VerifyJob* job = &(*jobs)[count++];
+        memset(job, 0, sizeof(*job));
+        snprintf(job->path, sizeof(job->path), "%s/%s", dirPath, entry->d_name);
+    }
+    closedir(dir);
+    qsort(*jobs, count, sizeof(VerifyJob), CompareJobs);
+    return count;
+}
+
+static void* VerifyWorker(void* arg) {
+    VerifyQueue* queue = arg;
+    for (;;) {
+        int index = atomic_fetch_add(&queue->nextJob, 1);
+        if (index >= queue->jobCount) break;
+        VerifyJob* job = &queue->jobs[index];
+        Replay replay;
+        if (!LoadReplay(job->path, &replay)) {
+            job->result.verdict = REPLAY_VERDICT_INVALID;
+            continue;
+        }
+        job->claimed = replay.header;
+        job->result = VerifyReplay(&replay);
+        UnloadReplay(&replay);
+    }
+    return NULL;
+}
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <replay-dir> [threads]\n", argv[0]);
+        return 2;
+    }
+    int threadCount = argc > 2 ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threadCount < 1) threadCount = 1;
+    TuningParams tuning;
+    LoadTuning(TUNING_FILE, &tuning);
+    SetTuning(&tuning);
+
+    VerifyQueue queue = {0};
+    queue.jobCount = CollectJobs(argv[1], &queue.jobs);
+    if (queue.jobCount < 0) {
+        fprintf(stderr, "cannot open directory %s\n", argv[1]);
+        return 2;
+    }
+    atomic_init(&queue.nextJob, 0);
+    if (threadCount > queue.jobCount) threadCount = queue.jobCount > 0 ? queue.jobCount : 1;
+
+    double start = NowSeconds();
+    pthread_t* threads = malloc(threadCount * sizeof(pthread_t));
+    for (int i = 0; i < threadCount; i++) {
+        pthread_create(&threads[i], NULL, VerifyWorker, &queue);
+    }
+    for (int i = 0; i < threadCount; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    double elapsed = NowSeconds() - start;
+    free(threads);
+
+    int counts[REPLAY_VERDICT_INVALID + 1] = {0};
+    unsigned long long totalTicks = 0;
+    for (int i = 0; i < queue.jobCount; i++) {
+        const VerifyJob* job = &queue.jobs[i];
+        counts[job->result.verdict]++;
+        totalTicks += job->result.ticks;
+        if (job->result.verdict == REPLAY_VERDICT_INVALID || job->result.verdict == REPLAY_VERDICT_TUNING_MISMATCH) {
+            printf("%-16s %s\n", ReplayVerdictName(job->result.verdict), job->path);
+            continue;
+        }
+        printf("%-16s %s claimed score=%d won=%d ticks=%u, simulated score=%d won=%d ticks=%u\n",
+               ReplayVerdictName(job->result.verdict), job->path,
+               job->claimed.score, job->claimed.won, job->claimed.tickCount,
+               job->result.score, job->result.won, job->result.ticks);
+    }
+
+    int rejected = queue.jobCount - counts[REPLAY_VERDICT_OK];
+    printf("\n%d replays, %d ok, %d rejected (%d score, %d outcome, %d length, %d tuning, %d invalid)\n",
+           queue.jobCount, counts[REPLAY_VERDICT_OK], rejected,
+           counts[REPLAY_VERDICT_SCORE_MISMATCH], counts[REPLAY_VERDICT_OUTCOME_MISMATCH],
+           counts[REPLAY_VERDICT_LENGTH_MISMATCH], counts[REPLAY_VERDICT_TUNING_MISMATCH],
+           counts[REPLAY_VERDICT_INVALID]);
+    printf("%.3f s on %d threads, %.0f replays/min, %.1f Mticks/s\n",
+           elapsed, threadCount,
+           elapsed > 0 ? queue.jobCount * 60.0 / elapsed : 0.0,
+           elapsed > 0 ? totalTicks / elapsed / 1e6 : 0.0);
+
+    free(queue.jobs);
+    return rejected ? 1 : 0;
+}
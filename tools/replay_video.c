@@ -0,0 +1,135 @@
+#include "src/types.h"
+#include "src/game.h"
+#include "src/window.h"
+#include "src/draw.h"
+#include "src/render.h"
+#include "src/particles.h"
+#include "src/replay.h"
+#include "src/rng.h"
+#include "src/video.h"
+#include "src/arena.h"
+#include "src/tuning.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Renders a replay to video offline: the run is re-simulated headlessly,
+// drawn by the software backend and handed to the encoder thread (see
+// src/video.c for the targets). Nothing waits on a clock, so it runs as
+// fast as the renderer and encoder allow.
+//
+//   ReplayVideo <replay.rpl> <out.y4m | out-dir | "|encoder command">
+//               [fps] [from-seconds] [to-seconds] [width] [height]
+
+#define VIDEO_TAIL_SECONDS 1 // the game-over frame is held this long
+
+static double NowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <replay.rpl> <out.y4m | out-dir | \"|encoder command\"> "
+                        "[fps] [from-seconds] [to-seconds] [width] [height]\n", argv[0]);
+        return 1;
+    }
+    int fps = argc > 3 ? atoi(argv[3]) : 30;
+    if (fps <= 0 || fps > SIM_TICK_RATE || SIM_TICK_RATE % fps != 0) {
+        fprintf(stderr, "fps must divide %d\n", SIM_TICK_RATE);
+        return 1;
+    }
+    uint32_t fromTick = argc > 4 ? (uint32_t)(atof(argv[4]) * SIM_TICK_RATE) : 0;
+    uint32_t toTick = argc > 5 ? (uint32_t)(atof(argv[5]) * SIM_TICK_RATE) : UINT32_MAX;
+    int width = argc > 6 ? atoi(argv[6]) : BASE_RESOLUTION.x;
+    int height = argc > 7 ? atoi(argv[7]) : BASE_RESOLUTION.y;
+    int ticksPerFrame = SIM_TICK_RATE / fps;
+
+    Replay replay;
+    if (!LoadReplay(argv[1], &replay)) {
+        fprintf(stderr, "cannot load replay %s\n", argv[1]);
+        return 1;
+    }
+    TuningParams tuning;
+    LoadTuning(TUNING_FILE, &tuning);
+    SetTuning(&tuning);
+    if (replay.header.tuningHash != HashTuning(GetTuning())) {
+        fprintf(stderr, "%s was played under a different %s; the video won't show the same run\n", argv[1], TUNING_FILE);
+    }
+    if (!InitRenderBackend(RENDER_BACKEND_SOFTWARE, width, height)) {
+        fprintf(stderr, "cannot allocate a %dx%d framebuffer\n", width, height);
+        return 1;
+    }
+    VideoEncoder* encoder = StartVideoEncoder(argv[2], width, height, fps);
+    if (!encoder) {
+        fprintf(stderr, "cannot open %s\n", argv[2]);
+        return 1;
+    }
+
+    // Clouds draw from raylib's generator, screen shake from its own
+    SetRandomSeed((unsigned int)replay.header.seed);
+    SeedScreenShake(replay.header.seed);
+    GameState* game = calloc(1, sizeof(GameState));
+    LoadGameTextures(game);
+    InitSimState(game, replay.header.seed);
+    game->isStoryMode = replay.header.storyMode != 0;
+    InitClouds(game);
+    game->particles = CreateParticleSystem();
+    if (game->particles) {
+        SeedRng(&game->particles->rngState, replay.header.seed);
+        LoadParticleTextures(game->particles);
+    }
+    WindowState window = {0};
+    InitWindowState(&window);
+    window.width = width;
+    window.height = height;
+    RescaleGame(&window);
+
+    double start = NowSeconds();
+    double drawTime = 0.0;
+    int frames = 0;
+    uint32_t endTick = replay.header.tickCount + VIDEO_TAIL_SECONDS * SIM_TICK_RATE;
+    if (toTick > endTick) toTick = endTick;
+    for (uint32_t tick = 0; tick < toTick; tick++) {
+        PlayerInput input = tick < replay.header.tickCount ? replay.inputs[tick] : INPUT_NONE;
+        StepGame(game, input);
+        if (game->particles) {
+            for (int i = 0; i < game->effectCount; i++) {
+                const EffectEvent* effect = &game->effects[i];
+                EmitEffect(game->particles, effect->type, effect->position, effect->size);
+            }
+            UpdateParticles(game->particles, SIM_DT);
+            // The emit throttle follows wall time; pinned so the video is the run
+            game->particles->emitScale = 1.0f;
+        }
+        UpdateClouds(game, NULL, SIM_DT);
+        if (tick < fromTick || tick % ticksPerFrame != 0) continue;
+
+        BeginMemoryFrame();
+        double drawStart = NowSeconds();
+        DrawGame(&window, game);
+        drawTime += NowSeconds() - drawStart;
+        if (!SubmitVideoFrame(encoder, GetRenderFramebuffer()->pixels)) break;
+        frames++;
+    }
+    int stalls = atomic_load(&encoder->stalls);
+    int written = StopVideoEncoder(encoder);
+    double elapsed = NowSeconds() - start;
+    double videoSeconds = (double)frames / fps;
+
+    if (written < 0) {
+        fprintf(stderr, "writing %s failed\n", argv[2]);
+    } else {
+        printf("%d frames at %d fps (%.1f s of video) in %.1f s: %.1fx real time\n",
+               written, fps, videoSeconds, elapsed, elapsed > 0 ? videoSeconds / elapsed : 0.0);
+        printf("draw %.2f ms per frame, renderer waited on a full queue %d times\n",
+               frames ? drawTime / frames * 1e3 : 0.0, stalls);
+    }
+    DestroyParticleSystem(game->particles);
+    CloseRenderBackend();
+    UnloadReplay(&replay);
+    free(game);
+    return written < 0 ? 1 : 0;
+}
@@ -0,0 +1,217 @@
+#include "raylib.h"
+#include "src/types.h"
+#include "src/atlas.h"
+#include "src/livestate.h"
+#include "src/spectator.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Thin spectator client for a game started with DINO_BROADCAST=port. It
+// keeps the last few ticks it was sent and draws a little behind the
+// newest, interpolating positions between the two ticks either side, so
+// network jitter doesn't show as stutter. Nothing is simulated here.
+//
+//   Spectator [host[:port]]
+
+#define HISTORY_FRAMES 32
+#define INTERPOLATION_DELAY_TICKS 6 // ~100 ms of jitter absorbed
+#define RECONNECT_SECONDS 1.0
+#define RECEIVE_BUFFER (SPECTATOR_MAX_MESSAGE * 16)
+
+typedef struct {
+    SpectatorFrame frame;
+    double arrival;
+} ReceivedFrame;
+
+typedef struct {
+    char host[128];
+    const char* port;
+    int socket;
+    double nextAttempt;
+    uint8_t buffer[RECEIVE_BUFFER];
+    int length;
+    SpectatorFrame state;
+    ReceivedFrame history[HISTORY_FRAMES]; // oldest first
+    int historyCount;
+    double renderTick;
+} Spectator;
+
+static void Connect(Spectator* spectator) {
+    spectator->nextAttempt = GetTime() + RECONNECT_SECONDS;
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    struct addrinfo* addresses = NULL;
+    if (getaddrinfo(spectator->host, spectator->port, &hints, &addresses) != 0) return;
+    for (struct addrinfo* address = addresses; address; address = address->ai_next) {
+        int fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) continue;
+        if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            spectator->socket = fd;
+            spectator->length = 0;
+            spectator->historyCount = 0;
+            break;
+        }
+        close(fd);
+    }
+    freeaddrinfo(addresses);
+}
+
+static void Disconnect(Spectator* spectator) {
+    close(spectator->socket);
+    spectator->socket = -1;
+}
+
+static void Remember(Spectator* spectator, const SpectatorFrame* frame) {
+    // A tick going backwards is a new run; the old one can't be blended in
+    if (spectator->historyCount > 0 && frame->tick < spectator->history[spectator->historyCount - 1].frame.tick) {
+        spectator->historyCount = 0;
+    }
+    if (spectator->historyCount == HISTORY_FRAMES) {
+        memmove(spectator->history, spectator->history + 1, (HISTORY_FRAMES - 1) * sizeof(ReceivedFrame));
+        spectator->historyCount--;
+    }
+    spectator->history[spectator->historyCount++] = (ReceivedFrame){ *frame, GetTime() };
+}
+
+// The server always opens the stream with a keyframe, so every message
+// can be applied in order as it arrives
+static void Receive(Spectator* spectator) {
+    for (;;) {
+        ssize_t got = recv(spectator->socket, spectator->buffer + spectator->length,
+                           RECEIVE_BUFFER - spectator->length, 0);
+        if (got == 0 || (got < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            Disconnect(spectator);
+            return;
+        }
+        if (got < 0) break;
+        spectator->length += (int)got;
+        int offset = 0;
+        for (;;) {
+            int used = DecodeSpectatorMessage(spectator->buffer + offset, spectator->length - offset, &spectator->state);
+            if (used < 0) {
+                Disconnect(spectator);
+                return;
+            }
+            if (used == 0) break;
+            Remember(spectator, &spectator->state);
+            offset += used;
+        }
+        memmove(spectator->buffer, spectator->buffer + offset, spectator->length - offset);
+        spectator->length -= offset;
+    }
+}
+
+// Eases the playback clock toward a fixed delay behind the newest tick
+// instead of snapping, unless it is far off (joined, or a new run)
+static void AdvanceClock(Spectator* spectator, float deltaTime) {
+    const ReceivedFrame* newest = &spectator->history[spectator->historyCount - 1];
+    double target = newest->frame.tick + (GetTime() - newest->arrival) * SIM_TICK_RATE - INTERPOLATION_DELAY_TICKS;
+    if (target > newest->frame.tick) target = newest->frame.tick;
+    spectator->renderTick += deltaTime * SIM_TICK_RATE;
+    if (fabs(target - spectator->renderTick) > SIM_TICK_RATE / 2) {
+        spectator->renderTick = target;
+    } else {
+        spectator->renderTick += (target - spectator->renderTick) * 0.1;
+    }
+}
+
+static void DrawEntity(Texture2D atlas, const SpectatorEntity* from, const SpectatorEntity* to, float t, float scale) {
+    int sprite = to->sprite & ~SPECTATOR_FADED;
+    if (sprite >= SPRITE_COUNT) return;
+    const AtlasSprite* entry = &ATLAS_SPRITES[sprite];
+    float x = (from->x + (to->x - from->x) * t) * SPECTATOR_QUANTUM * scale;
+    float y = (from->y + (to->y - from->y) * t) * SPECTATOR_QUANTUM * scale;
+    float scaleX = to->width * SPECTATOR_QUANTUM * scale / entry->frame.x;
+    float scaleY = to->height * SPECTATOR_QUANTUM * scale / entry->frame.y;
+    Rectangle dest = {
+        x + entry->offset.x * scaleX,
+        y + entry->offset.y * scaleY,
+        entry->source.width * scaleX,
+        entry->source.height * scaleY
+    };
+    Color tint = to->sprite & SPECTATOR_FADED ? Fade(WHITE, 0.3f) : WHITE;
+    DrawTexturePro(atlas, entry->source, dest, (Vector2){ 0, 0 }, 0.0f, tint);
+}
+
+static void DrawSpectated(const Spectator* spectator, Texture2D atlas) {
+    // The two received ticks either side of the playback clock
+    int later = 0;
+    while (later < spectator->historyCount && spectator->history[later].frame.tick <= spectator->renderTick) later++;
+    const SpectatorFrame* a = &spectator->history[later > 0 ? later - 1 : 0].frame;
+    const SpectatorFrame* b = later < spectator->historyCount ? &spectator->history[later].frame : a;
+    float t = b->tick > a->tick ? (float)((spectator->renderTick - a->tick) / (b->tick - a->tick)) : 0.0f;
+    if (t < 0.0f) t = 0.0f;
+
+    float scale = GetScreenWidth() / BASE_RESOLUTION.x;
+    bool night = a->flags & LIVE_FLAG_NIGHT;
+    ClearBackground(night ? (Color){ 30, 30, 45, 255 } : RAYWHITE);
+    DrawRectangle(0, (int)((BASE_RESOLUTION.y - GROUND_HEIGHT) * scale), GetScreenWidth(),
+                  (int)(GROUND_HEIGHT * scale), DARKGRAY);
+    // Entities that exist on only one side of the pair are drawn as they were
+    for (int id = 0; id < SPECTATOR_MAX_ENTITIES; id++) {
+        uint32_t bit = 1u << id;
+        if (!(a->present & bit)) continue;
+        bool both = b->present & bit;
+        DrawEntity(atlas, &a->entities[id], both ? &b->entities[id] : &a->entities[id], both ? t : 0.0f, scale);
+    }
+
+    Color text = night ? RAYWHITE : DARKGRAY;
+    int fontSize = (int)(30 * scale);
+    DrawText(TextFormat("Score: %d", a->score), (int)(20 * scale), (int)(20 * scale), fontSize, text);
+    if (a->flags & LIVE_FLAG_STORY) {
+        DrawText(TextFormat("HP: %d", a->hp), (int)(20 * scale), (int)(60 * scale), fontSize, text);
+    }
+    if (a->flags & LIVE_FLAG_BOSS) {
+        DrawText(TextFormat("Boss: %d  Projectiles: %d", a->bossHP, a->projectiles), (int)(20 * scale),
+                 (int)(100 * scale), fontSize, text);
+    }
+    if (a->flags & LIVE_FLAG_PAUSED) DrawText("PAUSED", (int)(700 * scale), (int)(400 * scale), (int)(50 * scale), text);
+    if (a->flags & LIVE_FLAG_GAME_OVER) {
+        DrawText(a->flags & LIVE_FLAG_GAME_WON ? "YOU WIN!" : "GAME OVER", (int)(640 * scale), (int)(400 * scale),
+                 (int)(60 * scale), RED);
+    }
+}
+
+int main(int argc, char** argv) {
+    Spectator spectator = { .socket = -1, .port = SPECTATOR_DEFAULT_PORT };
+    const char* address = argc > 1 ? argv[1] : "127.0.0.1";
+    const char* colon = strrchr(address, ':');
+    if (colon && (size_t)(colon - address) < sizeof(spectator.host)) {
+        snprintf(spectator.host, sizeof(spectator.host), "%.*s", (int)(colon - address), address);
+        spectator.port = colon + 1;
+    } else {
+        snprintf(spectator.host, sizeof(spectator.host), "%s", address);
+    }
+
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    InitWindow(800, 450, "DinoGame spectator");
+    SetTargetFPS(60);
+    Texture2D atlas = LoadTexture(ATLAS_PATH);
+
+    while (!WindowShouldClose()) {
+        if (spectator.socket < 0 && GetTime() >= spectator.nextAttempt) Connect(&spectator);
+        if (spectator.socket >= 0) Receive(&spectator);
+        bool watching = spectator.socket >= 0 && spectator.historyCount > 0;
+        if (watching) AdvanceClock(&spectator, GetFrameTime());
+
+        BeginDrawing();
+        if (watching) {
+            DrawSpectated(&spectator, atlas);
+        } else {
+            ClearBackground(RAYWHITE);
+            DrawText(TextFormat("Waiting for %s:%s...", spectator.host, spectator.port), 20, 20, 20, DARKGRAY);
+        }
+        EndDrawing();
+    }
+    if (spectator.socket >= 0) Disconnect(&spectator);
+    UnloadTexture(atlas);
+    CloseWindow();
+    return 0;
+}
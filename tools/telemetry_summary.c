@@ -0,0 +1,168 @@
+#include "src/types.h"
+#include "src/telemetry.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Reads the telemetry file the game appends to and answers the usual
+// questions: how long runs last, what kills the dino (per obstacle type,
+// relative to how often each type spawns), how runs fare at night and
+// how the boss fight plays out.
+//
+//   TelemetrySummary [file]
+
+#define OBSTACLE_TYPES (OBSTACLE_BIRD + 1)
+#define BOSS_HP_LEVELS 11
+
+static const char* OBSTACLE_NAMES[OBSTACLE_TYPES] = {
+    "cactus 1", "cactus 2", "cactus 3", "cactus 4", "cactus 5", "cactus 6", "bird"
+};
+static const char* DEATH_NAMES[DEATH_CAUSE_COUNT] = { "obstacle", "meteor", "projectile" };
+
+typedef struct {
+    int runs;
+    int finished;
+    int won;
+    double survivalSeconds;
+    int deaths[DEATH_CAUSE_COUNT];
+    int obstacleDeaths[OBSTACLE_TYPES];
+    int spawns[OBSTACLE_TYPES];
+    long long jumps;
+    long long jumpsWithGap;
+    double jumpGapSum;
+    int nightRuns;
+    int nightDeaths;
+    int nightRunsFinished;
+    double afterNightfallSeconds;
+    int bossRuns;
+    double bossHitSeconds[BOSS_HP_LEVELS];
+    int bossHitCount[BOSS_HP_LEVELS];
+    long long playerHits;
+    long long events;
+} Summary;
+
+// Per-run state while walking the event stream
+typedef struct {
+    bool active;
+    bool atNight;
+    int64_t firstNightfall;
+    int64_t firstBossHit;
+} Run;
+
+static void Apply(Summary* summary, Run* run, const TelemetryEvent* event) {
+    summary->events++;
+    if (event->type == TELEMETRY_RUN_START) {
+        summary->runs++;
+        *run = (Run){ .active = true, .firstNightfall = -1, .firstBossHit = -1 };
+        return;
+    }
+    if (!run->active) return;
+    switch (event->type) {
+        case TELEMETRY_SPAWN:
+            if (event->detail < OBSTACLE_TYPES) summary->spawns[event->detail]++;
+            break;
+        case TELEMETRY_JUMP:
+            summary->jumps++;
+            if (event->value >= 0) {
+                summary->jumpsWithGap++;
+                summary->jumpGapSum += event->value;
+            }
+            break;
+        case TELEMETRY_DEATH:
+            if (event->detail < DEATH_CAUSE_COUNT) summary->deaths[event->detail]++;
+            if (event->detail == DEATH_OBSTACLE && event->value >= 0 && event->value < OBSTACLE_TYPES) {
+                summary->obstacleDeaths[event->value]++;
+            }
+            if (run->atNight) summary->nightDeaths++;
+            break;
+        case TELEMETRY_NIGHT:
+            run->atNight = event->detail != 0;
+            if (run->atNight && run->firstNightfall < 0) {
+                run->firstNightfall = event->tick;
+                summary->nightRuns++;
+            }
+            break;
+        case TELEMETRY_BOSS_DAMAGE:
+            if (run->firstBossHit < 0) {
+                run->firstBossHit = event->tick;
+                summary->bossRuns++;
+            }
+            if (event->value >= 0 && event->value < BOSS_HP_LEVELS) {
+                summary->bossHitSeconds[event->value] += (double)(event->tick - run->firstBossHit) / SIM_TICK_RATE;
+                summary->bossHitCount[event->value]++;
+            }
+            break;
+        case TELEMETRY_PLAYER_HIT:
+            summary->playerHits++;
+            break;
+        case TELEMETRY_RUN_END:
+            summary->finished++;
+            summary->won += event->detail != 0;
+            summary->survivalSeconds += (double)event->tick / SIM_TICK_RATE;
+            if (run->firstNightfall >= 0) {
+                summary->nightRunsFinished++;
+                summary->afterNightfallSeconds += (double)(event->tick - run->firstNightfall) / SIM_TICK_RATE;
+            }
+            run->active = false;
+            break;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : TELEMETRY_FILE;
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+
+    static TelemetryEvent events[TELEMETRY_BLOCK_EVENTS];
+    Summary summary = {0};
+    Run run = {0};
+    int blocks = 0;
+    int count;
+    while ((count = ReadTelemetryBlock(file, events, TELEMETRY_BLOCK_EVENTS)) > 0) {
+        blocks++;
+        for (int i = 0; i < count; i++) Apply(&summary, &run, &events[i]);
+    }
+    long bytes = ftell(file);
+    fclose(file);
+    if (count < 0) fprintf(stderr, "stopped at a damaged block after %d blocks\n", blocks);
+
+    printf("%lld events in %d blocks, %.1f bytes per event\n", summary.events, blocks,
+           summary.events ? (double)bytes / summary.events : 0.0);
+    printf("runs: %d started, %d finished, %d won, %d abandoned\n", summary.runs, summary.finished,
+           summary.won, summary.runs - summary.finished);
+    if (summary.finished) {
+        printf("survival: %.1f s on average\n", summary.survivalSeconds / summary.finished);
+    }
+    printf("deaths:");
+    for (int c = 0; c < DEATH_CAUSE_COUNT; c++) printf(" %s %d", DEATH_NAMES[c], summary.deaths[c]);
+    printf("\n");
+    printf("%-10s %8s %8s %12s\n", "obstacle", "spawned", "deaths", "per 100");
+    for (int t = 0; t < OBSTACLE_TYPES; t++) {
+        printf("%-10s %8d %8d %12.2f\n", OBSTACLE_NAMES[t], summary.spawns[t], summary.obstacleDeaths[t],
+               summary.spawns[t] ? 100.0 * summary.obstacleDeaths[t] / summary.spawns[t] : 0.0);
+    }
+    printf("jumps: %lld, taking off %.0f px before the nearest obstacle on average\n", summary.jumps,
+           summary.jumpsWithGap ? summary.jumpGapSum / summary.jumpsWithGap : 0.0);
+    if (summary.nightRuns) {
+        printf("night: %d runs reached it, %d deaths in the dark", summary.nightRuns, summary.nightDeaths);
+        if (summary.nightRunsFinished) {
+            printf(", finished runs lasted %.1f s past nightfall on average",
+                   summary.afterNightfallSeconds / summary.nightRunsFinished);
+        }
+        printf("\n");
+    }
+    if (summary.bossRuns) {
+        printf("boss: %d fights, %lld projectile hits taken; seconds from first hit to boss HP:\n",
+               summary.bossRuns, summary.playerHits);
+        for (int hp = BOSS_HP_LEVELS - 1; hp >= 0; hp--) {
+            if (summary.bossHitCount[hp]) {
+                printf("  %2d: %.1f s (%d fights)\n", hp, summary.bossHitSeconds[hp] / summary.bossHitCount[hp],
+                       summary.bossHitCount[hp]);
+            }
+        }
+    }
+    return 0;
+}